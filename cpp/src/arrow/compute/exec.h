@@ -82,12 +82,15 @@ class ARROW_EXPORT ExecContext {
   // smaller chunks.
   int64_t exec_chunksize() const { return exec_chunksize_; }
 
-  /// \brief Set whether to use multiple threads for function execution. This
-  /// is not yet used.
+  /// \brief Set whether to use multiple threads for function execution.
+  ///
+  /// This is currently only honored by the sort_indices, rank and
+  /// select_k_unstable functions on chunked arrays and tables, which
+  /// spread work over executor().
   void set_use_threads(bool use_threads = true) { use_threads_ = use_threads; }
 
   /// \brief If true, then utilize multiple threads where relevant for function
-  /// execution. This is not yet used.
+  /// execution. See set_use_threads().
   bool use_threads() const { return use_threads_; }
 
   // Set the preallocation strategy for kernel execution as it relates to
@@ -21,10 +21,16 @@
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <tuple>
 #include <vector>
 
+#include "arrow/array/concatenate.h"
+#include "arrow/array/util.h"
 #include "arrow/compute/api_vector.h"
+#include "arrow/compute/exec_internal.h"
+#include "arrow/compute/kernels/ree_util_internal.h"
 #include "arrow/type_fwd.h"
+#include "arrow/util/ree_util.h"
 
 namespace arrow {
 namespace compute {
@@ -551,6 +557,338 @@ void PromoteIntegerForDurationArithmetic(std::vector<TypeHolder>* types) {
   }
 }
 
+namespace {
+
+// ----------------------------------------------------------------------
+// Run-end encoded execution
+
+struct RunEndEncodedKernelData : public KernelState {
+  explicit RunEndEncodedKernelData(ScalarKernel values_kernel)
+      : values_kernel(std::move(values_kernel)) {}
+
+  ScalarKernel values_kernel;
+};
+
+// Match run-end encoded types whose value type matches an InputType
+class RunEndEncodedValuesMatcher : public TypeMatcher {
+ public:
+  explicit RunEndEncodedValuesMatcher(InputType value_type)
+      : value_type_(std::move(value_type)) {}
+
+  bool Matches(const DataType& type) const override {
+    return type.id() == Type::RUN_END_ENCODED &&
+           value_type_.Matches(
+               *checked_cast<const RunEndEncodedType&>(type).value_type());
+  }
+
+  std::string ToString() const override {
+    return "run_end_encoded(" + value_type_.ToString() + ")";
+  }
+
+  bool Equals(const TypeMatcher& other) const override {
+    if (this == &other) {
+      return true;
+    }
+    const auto* casted = dynamic_cast<const RunEndEncodedValuesMatcher*>(&other);
+    return casted != nullptr && value_type_.Equals(casted->value_type_);
+  }
+
+ private:
+  const InputType value_type_;
+};
+
+std::vector<TypeHolder> ValueTypes(const std::vector<TypeHolder>& types) {
+  std::vector<TypeHolder> value_types;
+  value_types.reserve(types.size());
+  for (const auto& type : types) {
+    if (type.id() == Type::RUN_END_ENCODED) {
+      value_types.emplace_back(
+          checked_cast<const RunEndEncodedType&>(*type.type).value_type());
+    } else {
+      value_types.push_back(type);
+    }
+  }
+  return value_types;
+}
+
+int64_t RunEndAt(const ArraySpan& run_ends, int64_t physical_index) {
+  switch (run_ends.type->id()) {
+    case Type::INT16:
+      return run_ends.GetValues<int16_t>(1)[physical_index];
+    case Type::INT32:
+      return run_ends.GetValues<int32_t>(1)[physical_index];
+    default:
+      DCHECK_EQ(run_ends.type->id(), Type::INT64);
+      return run_ends.GetValues<int64_t>(1)[physical_index];
+  }
+}
+
+// The runs of an array argument in the logical range of a batch.  Arrays that
+// are not run-end encoded are made of runs of length one.
+struct ArgumentRuns {
+  explicit ArgumentRuns(const ArraySpan& span)
+      : span(span), ree(span.type->id() == Type::RUN_END_ENCODED) {
+    if (ree) {
+      std::tie(physical_offset, physical_length) =
+          ::arrow::ree_util::FindPhysicalRange(span, span.offset, span.length);
+    } else {
+      physical_offset = 0;
+      physical_length = span.length;
+    }
+  }
+
+  // The logical end of the run at `physical_index`, relative to the span
+  int64_t RunEnd(int64_t physical_index) const {
+    if (!ree) {
+      return physical_index + 1;
+    }
+    const int64_t run_end =
+        RunEndAt(::arrow::ree_util::RunEndsArray(span), physical_index) - span.offset;
+    return std::min(run_end, span.length);
+  }
+
+  // The values of the runs in [physical_offset, physical_offset + physical_length)
+  std::shared_ptr<Array> Values() const {
+    if (!ree) {
+      return span.ToArray();
+    }
+    return ::arrow::ree_util::ValuesArray(span).ToArray()->Slice(physical_offset,
+                                                                 physical_length);
+  }
+
+  const ArraySpan& span;
+  const bool ree;
+  int64_t physical_offset;
+  int64_t physical_length;
+};
+
+Result<std::shared_ptr<ArrayData>> MakeRunEnds(
+    const std::shared_ptr<DataType>& run_end_type, const std::vector<int64_t>& run_ends,
+    MemoryPool* pool) {
+  const auto num_runs = static_cast<int64_t>(run_ends.size());
+  ARROW_ASSIGN_OR_RAISE(auto data,
+                        ree_util::PreallocateRunEndsArray(run_end_type, num_runs, pool));
+  auto write = [&](auto* out) {
+    using RunEndCType = std::remove_pointer_t<decltype(out)>;
+    for (int64_t i = 0; i < num_runs; ++i) {
+      out[i] = static_cast<RunEndCType>(run_ends[i]);
+    }
+  };
+  switch (run_end_type->id()) {
+    case Type::INT16:
+      write(data->GetMutableValues<int16_t>(1));
+      break;
+    case Type::INT32:
+      write(data->GetMutableValues<int32_t>(1));
+      break;
+    default:
+      DCHECK_EQ(run_end_type->id(), Type::INT64);
+      write(data->GetMutableValues<int64_t>(1));
+      break;
+  }
+  return data;
+}
+
+// Execute the values kernel on the values of the aligned runs
+Result<std::shared_ptr<ArrayData>> ExecuteOnRuns(KernelContext* ctx,
+                                                 const ScalarKernel& values_kernel,
+                                                 std::vector<Datum> values,
+                                                 int64_t num_runs) {
+  KernelContext values_ctx(ctx->exec_context(), &values_kernel);
+  values_ctx.SetState(ctx->state());
+
+  std::vector<TypeHolder> value_types;
+  value_types.reserve(values.size());
+  for (const auto& value : values) {
+    value_types.emplace_back(value.type());
+  }
+  auto executor = ::arrow::compute::detail::KernelExecutor::MakeScalar();
+  RETURN_NOT_OK(executor->Init(&values_ctx, {&values_kernel, value_types, NULLPTR}));
+
+  ::arrow::compute::detail::DatumAccumulator listener;
+  ExecBatch batch(std::move(values), num_runs);
+  RETURN_NOT_OK(executor->Execute(batch, &listener));
+  const Datum result = executor->WrapResults(batch.values, listener.values());
+
+  MemoryPool* pool = ctx->memory_pool();
+  switch (result.kind()) {
+    case Datum::SCALAR: {
+      ARROW_ASSIGN_OR_RAISE(auto array,
+                            MakeArrayFromScalar(*result.scalar(), num_runs, pool));
+      return array->data();
+    }
+    case Datum::CHUNKED_ARRAY: {
+      ARROW_ASSIGN_OR_RAISE(auto array,
+                            Concatenate(result.chunked_array()->chunks(), pool));
+      return array->data();
+    }
+    default:
+      return result.array();
+  }
+}
+
+Status ExecRunEndEncoded(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
+  const auto& values_kernel =
+      checked_cast<const RunEndEncodedKernelData&>(*ctx->kernel()->data).values_kernel;
+  const int64_t length = batch.length;
+
+  std::vector<Datum> values(batch.num_values());
+  std::vector<int> array_args;
+  std::vector<ArgumentRuns> runs;
+  for (int i = 0; i < batch.num_values(); ++i) {
+    const ExecValue& arg = batch[i];
+    if (arg.is_scalar()) {
+      if (arg.type()->id() == Type::RUN_END_ENCODED) {
+        values[i] = checked_cast<const RunEndEncodedScalar&>(*arg.scalar).value;
+      } else {
+        values[i] = arg.scalar->GetSharedPtr();
+      }
+    } else {
+      array_args.push_back(i);
+      runs.emplace_back(arg.array);
+    }
+  }
+
+  // Align the runs of all array arguments: each output run ends where the
+  // first of the current input runs ends.
+  std::vector<int64_t> run_ends;
+  std::vector<std::vector<int64_t>> physical_indices(runs.size());
+  if (runs.empty()) {
+    if (length > 0) {
+      run_ends.push_back(length);
+    }
+  } else if (runs.size() == 1) {
+    // The runs of the only array argument are used as-is
+    const auto& arg_runs = runs[0];
+    run_ends.reserve(arg_runs.physical_length);
+    for (int64_t j = 0; j < arg_runs.physical_length; ++j) {
+      run_ends.push_back(arg_runs.RunEnd(arg_runs.physical_offset + j));
+    }
+  } else {
+    std::vector<int64_t> positions(runs.size(), 0);
+    int64_t logical_pos = 0;
+    while (logical_pos < length) {
+      int64_t run_end = length;
+      for (size_t k = 0; k < runs.size(); ++k) {
+        run_end =
+            std::min(run_end, runs[k].RunEnd(runs[k].physical_offset + positions[k]));
+      }
+      for (size_t k = 0; k < runs.size(); ++k) {
+        physical_indices[k].push_back(positions[k]);
+        if (runs[k].RunEnd(runs[k].physical_offset + positions[k]) == run_end) {
+          ++positions[k];
+        }
+      }
+      run_ends.push_back(run_end);
+      logical_pos = run_end;
+    }
+  }
+  const auto num_runs = static_cast<int64_t>(run_ends.size());
+
+  for (size_t k = 0; k < runs.size(); ++k) {
+    std::shared_ptr<Array> arg_values = runs[k].Values();
+    if (arg_values->length() != num_runs) {
+      // Repeat the values of runs split by the runs of other arguments
+      auto indices = std::make_shared<Int64Array>(
+          num_runs, Buffer::FromVector(std::move(physical_indices[k])));
+      ARROW_ASSIGN_OR_RAISE(auto taken,
+                            Take(arg_values, indices, TakeOptions::NoBoundsCheck(),
+                                 ctx->exec_context()));
+      values[array_args[k]] = std::move(taken);
+    } else {
+      values[array_args[k]] = std::move(arg_values);
+    }
+  }
+
+  ARROW_ASSIGN_OR_RAISE(auto values_data,
+                        ExecuteOnRuns(ctx, values_kernel, std::move(values), num_runs));
+
+  const auto& out_type = out->array_data()->type;
+  const auto& run_end_type =
+      checked_cast<const RunEndEncodedType&>(*out_type).run_end_type();
+  ARROW_ASSIGN_OR_RAISE(auto run_ends_data,
+                        MakeRunEnds(run_end_type, run_ends, ctx->memory_pool()));
+  out->value = ArrayData::Make(out_type, length, {NULLPTR},
+                               {std::move(run_ends_data), std::move(values_data)},
+                               /*null_count=*/0);
+  return Status::OK();
+}
+
+}  // namespace
+
+ScalarKernel MakeRunEndEncodedKernel(const ScalarKernel& values_kernel,
+                                     const std::vector<bool>& ree_args) {
+  const auto& values_signature = *values_kernel.signature;
+  DCHECK_EQ(values_signature.in_types().size(), ree_args.size());
+  DCHECK(!values_signature.is_varargs());
+
+  std::vector<InputType> in_types;
+  for (size_t i = 0; i < ree_args.size(); ++i) {
+    const auto& value_type = values_signature.in_types()[i];
+    if (ree_args[i]) {
+      in_types.emplace_back(std::make_shared<RunEndEncodedValuesMatcher>(value_type));
+    } else {
+      in_types.push_back(value_type);
+    }
+  }
+
+  auto data = std::make_shared<RunEndEncodedKernelData>(values_kernel);
+  auto resolve_out_type = [data](KernelContext* ctx, const std::vector<TypeHolder>& types)
+      -> Result<TypeHolder> {
+    ARROW_ASSIGN_OR_RAISE(
+        auto value_type,
+        data->values_kernel.signature->out_type().Resolve(ctx, ValueTypes(types)));
+    for (const auto& type : types) {
+      if (type.id() == Type::RUN_END_ENCODED) {
+        const auto& ree_type = checked_cast<const RunEndEncodedType&>(*type.type);
+        return run_end_encoded(ree_type.run_end_type(), value_type.GetSharedPtr());
+      }
+    }
+    return Status::Invalid("Expected a run-end encoded argument");
+  };
+
+  ScalarKernel kernel(std::move(in_types), OutputType(std::move(resolve_out_type)),
+                      ExecRunEndEncoded);
+  if (values_kernel.init) {
+    kernel.init = [data](KernelContext* ctx, const KernelInitArgs& args) {
+      const auto value_types = ValueTypes(args.inputs);
+      return data->values_kernel.init(
+          ctx, {&data->values_kernel, value_types, args.options});
+    };
+  }
+  kernel.data = std::move(data);
+  kernel.parallelizable = values_kernel.parallelizable;
+  kernel.simd_level = values_kernel.simd_level;
+  // The kernel allocates its output, which is never null at the top level
+  kernel.null_handling = NullHandling::OUTPUT_NOT_NULL;
+  kernel.mem_allocation = MemAllocation::NO_PREALLOCATE;
+  kernel.can_write_into_slices = false;
+  return kernel;
+}
+
+Status AddRunEndEncodedKernels(ScalarFunction* func) {
+  const Arity& arity = func->arity();
+  if (arity.is_varargs || arity.num_args < 1 || arity.num_args > 2 || !func->is_pure()) {
+    return Status::OK();
+  }
+  std::vector<ScalarKernel> values_kernels;
+  for (const ScalarKernel* kernel : func->kernels()) {
+    values_kernels.push_back(*kernel);
+  }
+  for (const auto& values_kernel : values_kernels) {
+    // Any combination of run-end encoded and other arguments, with at least one
+    // run-end encoded argument
+    for (int mask = 1; mask < (1 << arity.num_args); ++mask) {
+      std::vector<bool> ree_args(arity.num_args);
+      for (int i = 0; i < arity.num_args; ++i) {
+        ree_args[i] = (mask >> i) & 1;
+      }
+      RETURN_NOT_OK(func->AddKernel(MakeRunEndEncodedKernel(values_kernel, ree_args)));
+    }
+  }
+  return Status::OK();
+}
+
 }  // namespace internal
 }  // namespace compute
 }  // namespace arrow
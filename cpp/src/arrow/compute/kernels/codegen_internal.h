@@ -30,6 +30,7 @@
 #include "arrow/array/data.h"
 #include "arrow/buffer.h"
 #include "arrow/buffer_builder.h"
+#include "arrow/compute/function.h"
 #include "arrow/compute/kernel.h"
 #include "arrow/datum.h"
 #include "arrow/result.h"
@@ -1449,6 +1450,29 @@ void PromoteIntegerForDurationArithmetic(std::vector<TypeHolder>* types);
 
 // END of DispatchBest helpers
 // ----------------------------------------------------------------------
+// Run-end encoded execution
+
+/// \brief Make a kernel executing another kernel on run-end encoded inputs
+///
+/// The returned kernel accepts a run-end encoded argument wherever
+/// `ree_args` is true, and the argument types of `values_kernel` elsewhere.
+/// Runs of all array arguments are aligned (other arrays count as runs of
+/// length one), `values_kernel` is executed once per aligned run rather than
+/// once per logical value, and the output is run-end encoded with the run-end
+/// type of the first run-end encoded argument.  Inputs are never decoded.
+///
+/// This is only valid for elementwise kernels without side effects.
+ARROW_EXPORT
+ScalarKernel MakeRunEndEncodedKernel(const ScalarKernel& values_kernel,
+                                     const std::vector<bool>& ree_args);
+
+/// \brief Add run-end encoded variants of all kernels of a unary or binary
+/// function
+///
+/// Does nothing for varargs or impure functions.
+ARROW_EXPORT
+Status AddRunEndEncodedKernels(ScalarFunction* func);
+
 }  // namespace internal
 }  // namespace compute
 }  // namespace arrow
@@ -18,6 +18,9 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include "arrow/compute/api_scalar.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/exec.h"
 #include "arrow/compute/kernels/codegen_internal.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/type.h"
@@ -324,6 +327,100 @@ TEST(TestDispatchBest, ReplaceTemporalTypes) {
   AssertTypeEqual(*args[1], *int64());
 }
 
+std::shared_ptr<Array> RunEndEncodedFromJSON(
+    const std::shared_ptr<DataType>& type, std::string_view json,
+    const std::shared_ptr<DataType>& run_end_type) {
+  EXPECT_OK_AND_ASSIGN(auto encoded, RunEndEncode(ArrayFromJSON(type, json),
+                                                  RunEndEncodeOptions(run_end_type)));
+  return encoded.make_array();
+}
+
+void CheckRunEndEncodedCall(const std::string& func_name,
+                            const std::vector<Datum>& encoded_args,
+                            const std::vector<Datum>& decoded_args,
+                            const FunctionOptions* options = nullptr) {
+  ASSERT_OK_AND_ASSIGN(auto expected, CallFunction(func_name, decoded_args, options));
+  ASSERT_OK_AND_ASSIGN(auto actual, CallFunction(func_name, encoded_args, options));
+  ASSERT_EQ(actual.type()->id(), Type::RUN_END_ENCODED);
+  ASSERT_OK(actual.make_array()->ValidateFull());
+  ASSERT_OK_AND_ASSIGN(auto decoded, RunEndDecode(actual));
+  AssertDatumsEqual(expected, decoded, /*verbose=*/true);
+}
+
+TEST(TestRunEndEncodedKernels, Unary) {
+  const auto input = R"([1, 1, 2, 2, 2, null, null, 3])";
+  for (const auto& run_end_type : {int16(), int32(), int64()}) {
+    auto encoded = RunEndEncodedFromJSON(int32(), input, run_end_type);
+    auto decoded = ArrayFromJSON(int32(), input);
+    CheckRunEndEncodedCall("negate", {encoded}, {decoded});
+    CheckRunEndEncodedCall("is_null", {encoded}, {decoded});
+    CheckRunEndEncodedCall("negate", {encoded->Slice(1, 6)}, {decoded->Slice(1, 6)});
+
+    ASSERT_OK_AND_ASSIGN(auto negated, CallFunction("negate", {encoded}));
+    const auto& out_type = checked_cast<const RunEndEncodedType&>(*negated.type());
+    AssertTypeEqual(*out_type.run_end_type(), *run_end_type);
+    // Values are computed once per run
+    ASSERT_EQ(checked_cast<const RunEndEncodedArray&>(*negated.make_array())
+                  .values()
+                  ->length(),
+              4);
+  }
+
+  const auto strings = R"(["ab", "ab", null, "Cd", "Cd", "Cd"])";
+  CheckRunEndEncodedCall("ascii_upper", {RunEndEncodedFromJSON(utf8(), strings, int32())},
+                         {ArrayFromJSON(utf8(), strings)});
+
+  const auto doubles = R"([1.26, 1.26, 2.5, NaN, NaN])";
+  RoundOptions options(/*ndigits=*/1);
+  CheckRunEndEncodedCall("round", {RunEndEncodedFromJSON(float64(), doubles, int32())},
+                         {ArrayFromJSON(float64(), doubles)}, &options);
+}
+
+TEST(TestRunEndEncodedKernels, Binary) {
+  const auto left = R"([1, 1, 2, 2, 2, null, null, 3, 3, 3])";
+  const auto right = R"([10, 10, 10, 10, 20, 20, 20, 20, null, 30])";
+  auto left_decoded = ArrayFromJSON(int32(), left);
+  auto right_decoded = ArrayFromJSON(int32(), right);
+  auto left_encoded = RunEndEncodedFromJSON(int32(), left, int32());
+  auto right_encoded = RunEndEncodedFromJSON(int32(), right, int16());
+
+  for (const auto& func_name : {"add", "subtract_checked", "greater", "equal"}) {
+    ARROW_SCOPED_TRACE(func_name);
+    // Both arguments run-end encoded, with misaligned runs
+    CheckRunEndEncodedCall(func_name, {left_encoded, right_encoded},
+                           {left_decoded, right_decoded});
+    CheckRunEndEncodedCall(func_name,
+                           {left_encoded->Slice(3, 6), right_encoded->Slice(3, 6)},
+                           {left_decoded->Slice(3, 6), right_decoded->Slice(3, 6)});
+    // One run-end encoded argument
+    CheckRunEndEncodedCall(func_name, {left_encoded, right_decoded},
+                           {left_decoded, right_decoded});
+    CheckRunEndEncodedCall(func_name, {left_decoded, right_encoded},
+                           {left_decoded, right_decoded});
+    CheckRunEndEncodedCall(func_name, {left_encoded, Datum(int32_t(5))},
+                           {left_decoded, Datum(int32_t(5))});
+  }
+
+  // The output uses the run-end type of the first run-end encoded argument
+  ASSERT_OK_AND_ASSIGN(auto sum, CallFunction("add", {right_decoded, right_encoded}));
+  AssertTypeEqual(*sum.type(), *run_end_encoded(int16(), int32()));
+}
+
+TEST(TestRunEndEncodedKernels, ChunkedArray) {
+  const auto input = R"([1, 1, 2, 2, 2, null, null, 3])";
+  auto encoded = RunEndEncodedFromJSON(int32(), input, int32());
+  auto decoded = ArrayFromJSON(int32(), input);
+  ASSERT_OK_AND_ASSIGN(
+      auto actual, CallFunction("negate", {std::make_shared<ChunkedArray>(ArrayVector{
+                                              encoded, encoded->Slice(2, 4)})}));
+  ASSERT_OK_AND_ASSIGN(auto expected, CallFunction("negate", {decoded}));
+  ASSERT_EQ(actual.kind(), Datum::CHUNKED_ARRAY);
+  ASSERT_EQ(actual.chunked_array()->num_chunks(), 2);
+  ASSERT_OK_AND_ASSIGN(auto first_chunk,
+                       RunEndDecode(actual.chunked_array()->chunk(0)));
+  AssertDatumsEqual(expected, first_chunk, /*verbose=*/true);
+}
+
 }  // namespace internal
 }  // namespace compute
 }  // namespace arrow
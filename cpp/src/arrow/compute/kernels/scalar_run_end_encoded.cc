@@ -0,0 +1,44 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include <unordered_set>
+
+#include "arrow/compute/kernels/common_internal.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+namespace internal {
+
+void RegisterScalarRunEndEncoded(FunctionRegistry* registry) {
+  // Aliases share a function, only add kernels once per function
+  std::unordered_set<const Function*> visited;
+  for (const auto& name : registry->GetFunctionNames()) {
+    auto func = registry->GetFunction(name).ValueOrDie();
+    if (func->kind() != Function::SCALAR || !visited.insert(func.get()).second) {
+      continue;
+    }
+    DCHECK_OK(AddRunEndEncodedKernels(checked_cast<ScalarFunction*>(func.get())));
+  }
+}
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
@@ -16,8 +16,10 @@
 // under the License.
 
 #include <algorithm>
+#include <array>
 #include <cctype>
 #include <iterator>
+#include <limits>
 #include <memory>
 #include <string>
 
@@ -31,6 +33,7 @@
 
 #ifdef ARROW_WITH_RE2
 #  include <re2/re2.h>
+#  include <re2/set.h>
 #endif
 
 namespace arrow {
@@ -1667,6 +1670,394 @@ void AddAsciiStringMatchSubstring(FunctionRegistry* registry) {
 #endif
 }
 
+// ----------------------------------------------------------------------
+// Multi-pattern detection
+
+// Aho-Corasick automaton over a set of literal patterns.
+//
+// The automaton is compiled into a dense DFA whose alphabet is reduced to the
+// byte classes that actually occur in the patterns (all other bytes share
+// class 0), which keeps the transition table small even for thousands of
+// patterns.  ASCII case folding, if requested, is folded into the byte classes.
+class AhoCorasickMatcher {
+ public:
+  static Result<std::unique_ptr<AhoCorasickMatcher>> Make(
+      const std::vector<std::string>& patterns, bool ignore_case) {
+    if (patterns.size() > static_cast<size_t>(std::numeric_limits<int32_t>::max())) {
+      return Status::Invalid("Too many patterns: ", patterns.size());
+    }
+    auto matcher = std::make_unique<AhoCorasickMatcher>();
+    matcher->Build(patterns, ignore_case);
+    return matcher;
+  }
+
+  /// Whether any pattern occurs in `current`
+  bool Match(std::string_view current) const {
+    int32_t state = 0;
+    if (match_index_[state] >= 0) return true;
+    for (const auto c : current) {
+      state = Next(state, static_cast<uint8_t>(c));
+      if (match_index_[state] >= 0) return true;
+    }
+    return false;
+  }
+
+  /// The smallest index of the patterns occurring in `current`, or -1
+  int32_t MatchIndex(std::string_view current) const {
+    int32_t state = 0;
+    int32_t index = match_index_[state];
+    for (const auto c : current) {
+      if (index == 0) break;
+      state = Next(state, static_cast<uint8_t>(c));
+      const int32_t state_index = match_index_[state];
+      if (state_index >= 0 && (index < 0 || state_index < index)) {
+        index = state_index;
+      }
+    }
+    return index;
+  }
+
+ private:
+  int32_t Next(int32_t state, uint8_t c) const {
+    return transitions_[static_cast<int64_t>(state) * num_classes_ + byte_classes_[c]];
+  }
+
+  void Build(const std::vector<std::string>& patterns, bool ignore_case) {
+    auto fold = [&](uint8_t c) -> uint8_t {
+      return ignore_case ? static_cast<uint8_t>(std::tolower(c)) : c;
+    };
+
+    // Assign byte classes
+    std::array<int32_t, 256> folded_classes{};
+    num_classes_ = 1;
+    for (const auto& pattern : patterns) {
+      for (const auto c : pattern) {
+        auto& cls = folded_classes[fold(static_cast<uint8_t>(c))];
+        if (cls == 0) cls = num_classes_++;
+      }
+    }
+    for (int c = 0; c < 256; ++c) {
+      byte_classes_[c] = folded_classes[fold(static_cast<uint8_t>(c))];
+    }
+
+    // Build the trie, using -1 for missing transitions
+    transitions_.assign(num_classes_, -1);
+    match_index_.assign(1, -1);
+    for (size_t i = 0; i < patterns.size(); ++i) {
+      int32_t state = 0;
+      for (const auto c : patterns[i]) {
+        const int64_t slot = static_cast<int64_t>(state) * num_classes_ +
+                             byte_classes_[static_cast<uint8_t>(c)];
+        if (transitions_[slot] < 0) {
+          transitions_[slot] = static_cast<int32_t>(match_index_.size());
+          transitions_.resize(transitions_.size() + num_classes_, -1);
+          match_index_.push_back(-1);
+        }
+        state = transitions_[slot];
+      }
+      if (match_index_[state] < 0) {
+        match_index_[state] = static_cast<int32_t>(i);
+      }
+    }
+
+    // Compute failure links in breadth-first order and turn the trie into a DFA
+    std::vector<int32_t> failure(match_index_.size(), 0);
+    std::vector<int32_t> queue;
+    queue.reserve(match_index_.size());
+    for (int32_t cls = 0; cls < num_classes_; ++cls) {
+      auto& next = transitions_[cls];
+      if (next < 0) {
+        next = 0;
+      } else {
+        queue.push_back(next);
+      }
+    }
+    for (size_t pos = 0; pos < queue.size(); ++pos) {
+      const int32_t state = queue[pos];
+      const int32_t fail = failure[state];
+      // Inherit matches from the longest proper suffix (already final, as it
+      // is shallower and thus was dequeued earlier)
+      const int32_t fail_index = match_index_[fail];
+      if (fail_index >= 0 &&
+          (match_index_[state] < 0 || fail_index < match_index_[state])) {
+        match_index_[state] = fail_index;
+      }
+      const int64_t base = static_cast<int64_t>(state) * num_classes_;
+      const int64_t fail_base = static_cast<int64_t>(fail) * num_classes_;
+      for (int32_t cls = 0; cls < num_classes_; ++cls) {
+        auto& next = transitions_[base + cls];
+        if (next < 0) {
+          next = transitions_[fail_base + cls];
+        } else {
+          failure[next] = transitions_[fail_base + cls];
+          queue.push_back(next);
+        }
+      }
+    }
+  }
+
+  int32_t num_classes_ = 1;
+  std::array<int32_t, 256> byte_classes_{};
+  // Dense DFA: transitions_[state * num_classes_ + byte class]
+  std::vector<int32_t> transitions_;
+  // Smallest index of the patterns ending in each state, or -1
+  std::vector<int32_t> match_index_;
+};
+
+#ifdef ARROW_WITH_RE2
+// Matches a set of regexes in a single pass using RE2::Set
+class RegexSetMatcher {
+ public:
+  static Result<std::unique_ptr<RegexSetMatcher>> Make(
+      const std::vector<std::string>& patterns, bool is_utf8, bool ignore_case,
+      bool literal = false) {
+    auto matcher = std::make_unique<RegexSetMatcher>(
+        MakeRE2Options(is_utf8, ignore_case, literal), patterns.size());
+    for (const auto& pattern : patterns) {
+      std::string error;
+      if (matcher->set_.Add(pattern, &error) < 0) {
+        return Status::Invalid("Invalid regular expression: ", error);
+      }
+    }
+    if (!matcher->set_.Compile()) {
+      return Status::Invalid("Could not compile regular expression set of ",
+                             patterns.size(), " patterns (out of memory?)");
+    }
+    return matcher;
+  }
+
+  RegexSetMatcher(const RE2::Options& options, size_t num_patterns)
+      : set_(options, RE2::UNANCHORED), num_patterns_(num_patterns) {}
+
+  bool Match(std::string_view current) const {
+    // RE2::Set refuses to match against an empty set
+    if (num_patterns_ == 0) return false;
+    return set_.Match(ToStringPiece(current), nullptr);
+  }
+
+  int32_t MatchIndex(std::string_view current) const {
+    if (num_patterns_ == 0) return -1;
+    // RE2::Set reports all matching patterns, we only need the smallest one
+    std::vector<int> indices;
+    if (!set_.Match(ToStringPiece(current), &indices)) return -1;
+    return *std::min_element(indices.begin(), indices.end());
+  }
+
+ private:
+  RE2::Set set_;
+  const size_t num_patterns_;
+};
+#endif
+
+// Literal multi-pattern matcher: Aho-Corasick, except for case-insensitive
+// matching of non-ASCII patterns which needs RE2's case folding.
+class AnySubstringMatcher {
+ public:
+  static Result<std::unique_ptr<AnySubstringMatcher>> Make(
+      const MatchAnySubstringOptions& options, bool is_utf8) {
+    auto matcher = std::make_unique<AnySubstringMatcher>();
+    const bool all_ascii =
+        std::all_of(options.patterns.begin(), options.patterns.end(),
+                    [](const std::string& pattern) {
+                      return std::all_of(pattern.begin(), pattern.end(), [](char c) {
+                        return static_cast<uint8_t>(c) < 0x80;
+                      });
+                    });
+    if (options.ignore_case && !all_ascii) {
+#ifdef ARROW_WITH_RE2
+      ARROW_ASSIGN_OR_RAISE(matcher->regex_,
+                            RegexSetMatcher::Make(options.patterns, is_utf8,
+                                                  /*ignore_case=*/true,
+                                                  /*literal=*/true));
+      return matcher;
+#else
+      return Status::NotImplemented("ignore_case with non-ASCII patterns requires RE2");
+#endif
+    }
+    ARROW_ASSIGN_OR_RAISE(
+        matcher->aho_corasick_,
+        AhoCorasickMatcher::Make(options.patterns, options.ignore_case));
+    return matcher;
+  }
+
+  bool Match(std::string_view current) const {
+#ifdef ARROW_WITH_RE2
+    if (regex_) return regex_->Match(current);
+#endif
+    return aho_corasick_->Match(current);
+  }
+
+  int32_t MatchIndex(std::string_view current) const {
+#ifdef ARROW_WITH_RE2
+    if (regex_) return regex_->MatchIndex(current);
+#endif
+    return aho_corasick_->MatchIndex(current);
+  }
+
+ private:
+  std::unique_ptr<AhoCorasickMatcher> aho_corasick_;
+#ifdef ARROW_WITH_RE2
+  std::unique_ptr<RegexSetMatcher> regex_;
+#endif
+};
+
+#ifdef ARROW_WITH_RE2
+struct AnyRegexMatcher {
+  static Result<std::unique_ptr<RegexSetMatcher>> Make(
+      const MatchAnySubstringOptions& options, bool is_utf8) {
+    return RegexSetMatcher::Make(options.patterns, is_utf8, options.ignore_case);
+  }
+};
+#endif
+
+// Compiles the pattern set once per kernel invocation, so that it is reused
+// across all batches of the input.
+template <typename Matcher, typename MatcherFactory = Matcher>
+struct MatchAnyState : public KernelState {
+  using MatcherType = Matcher;
+
+  std::unique_ptr<Matcher> matcher;
+
+  explicit MatchAnyState(std::unique_ptr<Matcher> matcher)
+      : matcher(std::move(matcher)) {}
+
+  static Result<std::unique_ptr<KernelState>> Init(KernelContext* ctx,
+                                                   const KernelInitArgs& args) {
+    auto options = static_cast<const MatchAnySubstringOptions*>(args.options);
+    if (options == nullptr) {
+      return Status::Invalid(
+          "Attempted to initialize KernelState from null FunctionOptions");
+    }
+    const bool is_utf8 = is_string(args.inputs[0].id());
+    ARROW_ASSIGN_OR_RAISE(auto matcher, MatcherFactory::Make(*options, is_utf8));
+    return std::make_unique<MatchAnyState>(std::move(matcher));
+  }
+
+  static const Matcher& Get(KernelContext* ctx) {
+    return *checked_cast<const MatchAnyState&>(*ctx->state()).matcher;
+  }
+};
+
+template <typename Type, typename State>
+struct MatchAny {
+  static Status Exec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
+    return MatchSubstringImpl<Type, typename State::MatcherType>::Exec(
+        ctx, batch, out, &State::Get(ctx));
+  }
+};
+
+template <typename Type, typename State>
+struct IndexAny {
+  static Status Exec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
+    const auto& matcher = State::Get(ctx);
+    const ArraySpan& input = batch[0].array;
+    ARROW_ASSIGN_OR_RAISE(auto validity, ctx->AllocateBitmap(input.length));
+    ARROW_ASSIGN_OR_RAISE(auto values, ctx->Allocate(input.length * sizeof(int32_t)));
+    uint8_t* out_validity = validity->mutable_data();
+    int32_t* out_values = values->mutable_data_as<int32_t>();
+    int64_t position = 0;
+    int64_t null_count = 0;
+    VisitArraySpanInline<Type>(
+        input,
+        [&](std::string_view value) {
+          const int32_t index = matcher.MatchIndex(value);
+          const bool found = index >= 0;
+          bit_util::SetBitTo(out_validity, position, found);
+          out_values[position++] = found ? index : 0;
+          null_count += !found;
+        },
+        [&]() {
+          bit_util::ClearBit(out_validity, position);
+          out_values[position++] = 0;
+          ++null_count;
+        });
+    out->value = ArrayData::Make(int32(), input.length,
+                                 {std::move(validity), std::move(values)}, null_count);
+    return Status::OK();
+  }
+};
+
+using AnySubstringState = MatchAnyState<AnySubstringMatcher>;
+#ifdef ARROW_WITH_RE2
+using AnyRegexState = MatchAnyState<RegexSetMatcher, AnyRegexMatcher>;
+#endif
+
+const FunctionDoc match_any_substring_doc(
+    "Match strings against a set of literal patterns",
+    ("For each string in `strings`, emit true iff it contains any of the given\n"
+     "patterns.  Null inputs emit null.\n"
+     "The patterns must be given in MatchAnySubstringOptions; they are compiled\n"
+     "once into an Aho-Corasick automaton.\n"
+     "If ignore_case is set, only simple case folding is performed."),
+    {"strings"}, "MatchAnySubstringOptions", /*options_required=*/true);
+
+const FunctionDoc index_any_substring_doc(
+    "Return the index of the first literal pattern found in strings",
+    ("For each string in `strings`, emit the index (in the pattern list) of\n"
+     "the first of the given patterns it contains, or null if it contains none\n"
+     "of them.  Null inputs emit null.\n"
+     "The patterns must be given in MatchAnySubstringOptions.\n"
+     "If ignore_case is set, only simple case folding is performed."),
+    {"strings"}, "MatchAnySubstringOptions", /*options_required=*/true);
+
+#ifdef ARROW_WITH_RE2
+const FunctionDoc match_any_regex_doc(
+    "Match strings against a set of regex patterns",
+    ("For each string in `strings`, emit true iff any of the given patterns\n"
+     "matches it at any position.  Null inputs emit null.\n"
+     "The patterns must be given in MatchAnySubstringOptions; they are compiled\n"
+     "once into a single RE2::Set.\n"
+     "If ignore_case is set, only simple case folding is performed."),
+    {"strings"}, "MatchAnySubstringOptions", /*options_required=*/true);
+
+const FunctionDoc index_any_regex_doc(
+    "Return the index of the first regex pattern matching strings",
+    ("For each string in `strings`, emit the index (in the pattern list) of\n"
+     "the first of the given patterns matching it at any position, or null\n"
+     "if none of them matches.  Null inputs emit null.\n"
+     "The patterns must be given in MatchAnySubstringOptions.\n"
+     "If ignore_case is set, only simple case folding is performed."),
+    {"strings"}, "MatchAnySubstringOptions", /*options_required=*/true);
+#endif
+
+template <typename State>
+void AddMatchAnyFunctions(FunctionRegistry* registry, std::string match_name,
+                          const FunctionDoc& match_doc, std::string index_name,
+                          const FunctionDoc& index_doc) {
+  {
+    auto func = std::make_shared<ScalarFunction>(std::move(match_name), Arity::Unary(),
+                                                 match_doc);
+    for (const auto& ty : BaseBinaryTypes()) {
+      auto exec = GenerateVarBinaryToVarBinary<MatchAny, State>(ty);
+      DCHECK_OK(func->AddKernel({ty}, boolean(), std::move(exec), State::Init));
+    }
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
+  {
+    auto func = std::make_shared<ScalarFunction>(std::move(index_name), Arity::Unary(),
+                                                 index_doc);
+    for (const auto& ty : BaseBinaryTypes()) {
+      ScalarKernel kernel{{ty}, int32(),
+                          GenerateVarBinaryToVarBinary<IndexAny, State>(ty), State::Init};
+      // Null values will be computed based on whether a pattern matched
+      kernel.null_handling = NullHandling::COMPUTED_NO_PREALLOCATE;
+      kernel.mem_allocation = MemAllocation::NO_PREALLOCATE;
+      DCHECK_OK(func->AddKernel(std::move(kernel)));
+    }
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
+}
+
+void AddAsciiStringMatchAny(FunctionRegistry* registry) {
+  AddMatchAnyFunctions<AnySubstringState>(registry, "match_any_substring",
+                                          match_any_substring_doc, "index_any_substring",
+                                          index_any_substring_doc);
+#ifdef ARROW_WITH_RE2
+  AddMatchAnyFunctions<AnyRegexState>(registry, "match_any_regex", match_any_regex_doc,
+                                      "index_any_regex", index_any_regex_doc);
+#endif
+}
+
 // ----------------------------------------------------------------------
 // Substring find - lfind/index/etc.
 
@@ -3445,6 +3836,7 @@ void RegisterScalarStringAscii(FunctionRegistry* registry) {
   AddAsciiStringTrim(registry);
   AddAsciiStringPad(registry);
   AddAsciiStringMatchSubstring(registry);
+  AddAsciiStringMatchAny(registry);
   AddAsciiStringFindSubstring(registry);
   AddAsciiStringCountSubstring(registry);
   AddAsciiStringReplaceSubstring(registry);
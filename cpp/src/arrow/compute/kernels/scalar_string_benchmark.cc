@@ -16,6 +16,8 @@
 // under the License.
 
 #include <functional>
+#include <string>
+#include <vector>
 
 #include "benchmark/benchmark.h"
 
@@ -34,6 +36,7 @@
 namespace arrow {
 
 using internal::checked_cast;
+using internal::checked_pointer_cast;
 
 namespace compute {
 
@@ -77,6 +80,23 @@ static void MatchSubstring(benchmark::State& state) {
   UnaryStringBenchmark(state, "match_substring", &options);
 }
 
+static std::vector<std::string> MakeBenchmarkPatterns(int64_t num_patterns) {
+  random::RandomArrayGenerator rng(kSeed + 1);
+  auto patterns = checked_pointer_cast<StringArray>(
+      rng.String(num_patterns, /*min_length=*/4, /*max_length=*/12,
+                 /*null_probability=*/0));
+  std::vector<std::string> result;
+  for (int64_t i = 0; i < num_patterns; ++i) {
+    result.push_back(patterns->GetString(i));
+  }
+  return result;
+}
+
+static void MatchAnySubstring(benchmark::State& state) {
+  MatchAnySubstringOptions options(MakeBenchmarkPatterns(state.range(0)));
+  UnaryStringBenchmark(state, "match_any_substring", &options);
+}
+
 static void SplitPattern(benchmark::State& state) {
   SplitPatternOptions options("a");
   UnaryStringBenchmark(state, "split_pattern", &options);
@@ -93,6 +113,11 @@ static void TrimManyAscii(benchmark::State& state) {
 }
 
 #ifdef ARROW_WITH_RE2
+static void MatchAnyRegex(benchmark::State& state) {
+  MatchAnySubstringOptions options(MakeBenchmarkPatterns(state.range(0)));
+  UnaryStringBenchmark(state, "match_any_regex", &options);
+}
+
 static void MatchLike(benchmark::State& state) {
   MatchSubstringOptions options("ab%ac");
   UnaryStringBenchmark(state, "match_like", &options);
@@ -242,10 +267,12 @@ BENCHMARK(AsciiLower);
 BENCHMARK(AsciiUpper);
 BENCHMARK(IsAlphaNumericAscii);
 BENCHMARK(MatchSubstring);
+BENCHMARK(MatchAnySubstring)->RangeMultiplier(10)->Range(10, 10000);
 BENCHMARK(SplitPattern);
 BENCHMARK(TrimSingleAscii);
 BENCHMARK(TrimManyAscii);
 #ifdef ARROW_WITH_RE2
+BENCHMARK(MatchAnyRegex)->RangeMultiplier(10)->Range(10, 1000);
 BENCHMARK(MatchLike);
 BENCHMARK(MatchLikeSubstring);
 BENCHMARK(MatchLikePrefix);
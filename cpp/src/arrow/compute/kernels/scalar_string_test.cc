@@ -1541,6 +1541,81 @@ TYPED_TEST(TestBaseBinaryKernels, MatchSubstringIgnoreCase) {
 }
 #endif
 
+TYPED_TEST(TestBaseBinaryKernels, MatchAnySubstring) {
+  MatchAnySubstringOptions options{{"ab", "cd", "bcd"}};
+  this->CheckUnary("match_any_substring", "[]", boolean(), "[]", &options);
+  this->CheckUnary("match_any_substring",
+                   R"(["abc", "acb", "xcd", null, "bc", "AB", "", "bcbcd"])", boolean(),
+                   "[true, false, true, null, false, false, false, true]", &options);
+  this->CheckUnary("index_any_substring",
+                   R"(["abc", "acb", "xcd", null, "bc", "AB", "", "bcbcd", "cdab"])",
+                   int32(), "[0, null, 1, null, null, null, null, 1, 0]", &options);
+
+  // Overlapping patterns: matches found through failure links
+  MatchAnySubstringOptions options_overlap{{"aab", "abc", "b"}};
+  this->CheckUnary("index_any_substring", R"(["aaab", "aabc", "ab", "ac"])", int32(),
+                   "[0, 0, 2, null]", &options_overlap);
+  this->CheckUnary("match_any_substring", R"(["aaab", "aabc", "ab", "ac"])", boolean(),
+                   "[true, true, true, false]", &options_overlap);
+
+  MatchAnySubstringOptions options_ignore_case{{"aB", "CD"}, /*ignore_case=*/true};
+  this->CheckUnary("index_any_substring", R"(["xAb", "cD", "ac", "ABCD", null])", int32(),
+                   "[0, 1, null, 0, null]", &options_ignore_case);
+
+  MatchAnySubstringOptions options_empty_pattern{{"ab", ""}};
+  this->CheckUnary("index_any_substring", R"(["ab", "", null, "x"])", int32(),
+                   "[0, 1, null, 1]", &options_empty_pattern);
+
+  MatchAnySubstringOptions options_no_patterns{std::vector<std::string>{}};
+  this->CheckUnary("match_any_substring", R"(["ab", "", null])", boolean(),
+                   "[false, false, null]", &options_no_patterns);
+  this->CheckUnary("index_any_substring", R"(["ab", "", null])", int32(),
+                   "[null, null, null]", &options_no_patterns);
+}
+
+TYPED_TEST(TestBaseBinaryKernels, MatchAnySubstringNoOptions) {
+  Datum input = ArrayFromJSON(this->type(), "[]");
+  ASSERT_RAISES(Invalid, CallFunction("match_any_substring", {input}));
+}
+
+#ifdef ARROW_WITH_RE2
+TYPED_TEST(TestStringKernels, MatchAnySubstringIgnoreCaseNonAscii) {
+  MatchAnySubstringOptions options{{"xyz", "aé("}, /*ignore_case=*/true};
+  this->CheckUnary("index_any_substring",
+                   R"(["abc", "aEb", "baÉ(", "aé(", "ae(", "Aé(", "XyZ"])", int32(),
+                   "[null, null, 1, 1, null, 1, 0]", &options);
+}
+
+TYPED_TEST(TestStringKernels, MatchAnyRegex) {
+  MatchAnySubstringOptions options{{"a+b", "\\d", "^x"}};
+  this->CheckUnary("match_any_regex", "[]", boolean(), "[]", &options);
+  this->CheckUnary("match_any_regex", R"(["aab", "b", "a2", null, "yx", "xy", ""])",
+                   boolean(), "[true, false, true, null, false, true, false]",
+                   &options);
+  this->CheckUnary("index_any_regex", R"(["aab", "b", "a2", null, "yx", "x1", ""])",
+                   int32(), "[0, null, 1, null, null, 1, null]", &options);
+
+  MatchAnySubstringOptions options_insensitive{{"ab|é"}, /*ignore_case=*/true};
+  this->CheckUnary("match_any_regex", R"(["abc", "acb", "É", null, "bac", "AB"])",
+                   boolean(), "[true, false, true, null, false, true]",
+                   &options_insensitive);
+
+  MatchAnySubstringOptions options_no_patterns{std::vector<std::string>{}};
+  this->CheckUnary("match_any_regex", R"(["ab", "", null])", boolean(),
+                   "[false, false, null]", &options_no_patterns);
+  this->CheckUnary("index_any_regex", R"(["ab", "", null])", int32(),
+                   "[null, null, null]", &options_no_patterns);
+}
+
+TYPED_TEST(TestBaseBinaryKernels, MatchAnyRegexInvalid) {
+  Datum input = ArrayFromJSON(this->type(), "[null]");
+  MatchAnySubstringOptions options{{"a", "invalid["}};
+  EXPECT_RAISES_WITH_MESSAGE_THAT(Invalid,
+                                  ::testing::HasSubstr("Invalid regular expression"),
+                                  CallFunction("match_any_regex", {input}, &options));
+}
+#endif
+
 TYPED_TEST(TestBaseBinaryKernels, MatchStartsWith) {
   MatchSubstringOptions options{"abab"};
   this->CheckUnary("starts_with", "[]", boolean(), "[]", &options);
@@ -353,6 +353,56 @@ TYPED_TEST_SUITE(TestBottomKChunkedArrayRandom, SelectKableTypes);
 
 TYPED_TEST(TestBottomKChunkedArrayRandom, BottomK) { this->TestSelectK(1000); }
 
+// Chunked arrays and tables large enough to be split into concurrent selections:
+// the selected values should be the same as with a serial selection.
+class TestParallelSelectK : public ::testing::Test {
+ protected:
+  void SetUp() override { serial_ctx_.set_use_threads(false); }
+
+  void Check(const Datum& values, const SelectKOptions& options) {
+    ASSERT_OK_AND_ASSIGN(auto expected_indices,
+                         SelectKUnstable(values, options, &serial_ctx_));
+    ASSERT_OK_AND_ASSIGN(auto actual_indices, SelectKUnstable(values, options));
+    ValidateOutput(*actual_indices);
+    ASSERT_EQ(actual_indices->length(), expected_indices->length());
+    ASSERT_OK_AND_ASSIGN(auto expected, Take(values, expected_indices));
+    ASSERT_OK_AND_ASSIGN(auto actual, Take(values, actual_indices));
+    AssertDatumsEqual(expected, actual, /*verbose=*/true);
+  }
+
+  ExecContext serial_ctx_;
+};
+
+TEST_F(TestParallelSelectK, ChunkedArray) {
+  ::arrow::random::RandomArrayGenerator rng(/*seed=*/0x5487660);
+  ArrayVector chunks;
+  for (int64_t length : {100000, 0, 150000, 3, 70000}) {
+    chunks.push_back(rng.Int64(length, -1000000, 1000000, /*null_probability=*/0.2));
+  }
+  ASSERT_OK_AND_ASSIGN(auto chunked_array, ChunkedArray::Make(chunks));
+  for (int64_t k : {1, 10, 1000}) {
+    Check(chunked_array, SelectKOptions::TopKDefault(k));
+    Check(chunked_array, SelectKOptions::BottomKDefault(k));
+  }
+}
+
+TEST_F(TestParallelSelectK, Table) {
+  ::arrow::random::RandomArrayGenerator rng(/*seed=*/0x5487661);
+  auto schema = ::arrow::schema({field("a", int32()), field("b", float64())});
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  for (int64_t length : {90000, 120000, 0, 60000}) {
+    batches.push_back(RecordBatch::Make(
+        schema, length,
+        {rng.Int32(length, -100, 100, /*null_probability=*/0.1),
+         rng.Float64(length, -1.0, 1.0, /*null_probability=*/0.1)}));
+  }
+  ASSERT_OK_AND_ASSIGN(auto table, Table::FromRecordBatches(schema, batches));
+  for (int64_t k : {1, 10, 1000}) {
+    Check(table, SelectKOptions::TopKDefault(k, {"a", "b"}));
+    Check(table, SelectKOptions::BottomKDefault(k, {"a", "b"}));
+  }
+}
+
 // // Test basic cases for record batch.
 class TestSelectKWithRecordBatch : public ::testing::Test {
  public:
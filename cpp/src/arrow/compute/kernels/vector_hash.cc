@@ -15,9 +15,11 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <cstring>
 #include <memory>
 #include <mutex>
+#include <vector>
 
 #include "arrow/array/array_base.h"
 #include "arrow/array/array_dict.h"
@@ -33,7 +35,7 @@
 #include "arrow/result.h"
 #include "arrow/util/hashing.h"
 #include "arrow/util/int_util.h"
-#include "arrow/util/unreachable.h"
+#include "arrow/util/ree_util.h"
 
 namespace arrow {
 
@@ -85,6 +87,12 @@ class UniqueAction final : public ActionBase {
   template <class Index>
   void ObserveNotFound(Index index) {}
 
+  template <class Index>
+  void ObserveNullFound(Index index, int64_t count) {}
+
+  template <class Index>
+  void ObserveFound(Index index, int64_t count) {}
+
   bool ShouldEncodeNulls() { return true; }
 
   Status Flush(ExecResult* out) { return Status::OK(); }
@@ -150,6 +158,16 @@ class ValueCountsAction final : ActionBase {
     count_builder_[slot]++;
   }
 
+  template <class Index>
+  void ObserveNullFound(Index index, int64_t count) {
+    count_builder_[index] += count;
+  }
+
+  template <class Index>
+  void ObserveFound(Index slot, int64_t count) {
+    count_builder_[slot] += count;
+  }
+
   template <class Index>
   void ObserveNotFound(Index slot, Status* status) {
     Status s = count_builder_.Append(1);
@@ -212,6 +230,20 @@ class DictEncodeAction final : public ActionBase {
     ObserveFound(index);
   }
 
+  template <class Index>
+  void ObserveNullFound(Index index, int64_t count) {
+    for (int64_t i = 0; i < count; ++i) {
+      ObserveNullFound(index);
+    }
+  }
+
+  template <class Index>
+  void ObserveFound(Index index, int64_t count) {
+    for (int64_t i = 0; i < count; ++i) {
+      indices_builder_.UnsafeAppend(index);
+    }
+  }
+
   bool ShouldEncodeNulls() {
     return encode_options_.null_encoding_behavior == DictionaryEncodeOptions::ENCODE;
   }
@@ -281,7 +313,10 @@ class RegularHashKernel : public HashKernel {
 
   Status Append(const ArraySpan& arr) override {
     RETURN_NOT_OK(action_.Reserve(arr.length));
-    return DoAppend(arr);
+    if (arr.type->id() == ::arrow::Type::RUN_END_ENCODED) {
+      return AppendRuns(arr);
+    }
+    return DoAppend(arr, [] { return int64_t{1}; });
   }
 
   Status Flush(ExecResult* out) override { return action_.Flush(out); }
@@ -296,11 +331,48 @@ class RegularHashKernel : public HashKernel {
 
   std::shared_ptr<DataType> value_type() const override { return type_; }
 
-  template <bool HasError = with_error_status>
-  enable_if_t<!HasError, Status> DoAppend(const ArraySpan& arr) {
+  // Visit the values of a run-end encoded array, hashing each run only once
+  Status AppendRuns(const ArraySpan& arr) {
+    const auto run_end_type_id =
+        checked_cast<const RunEndEncodedType&>(*arr.type).run_end_type()->id();
+    switch (run_end_type_id) {
+      case ::arrow::Type::INT16:
+        return AppendRuns<int16_t>(arr);
+      case ::arrow::Type::INT32:
+        return AppendRuns<int32_t>(arr);
+      default:
+        DCHECK_EQ(run_end_type_id, ::arrow::Type::INT64);
+        return AppendRuns<int64_t>(arr);
+    }
+  }
+
+  template <typename RunEndCType>
+  Status AppendRuns(const ArraySpan& arr) {
+    const ree_util::RunEndEncodedArraySpan<RunEndCType> ree_span(arr);
+    auto it = ree_span.begin();
+    const auto end = ree_span.end();
+    // Visit the physical values referenced by the logical slice in lockstep
+    // with the runs
+    ArraySpan values = ree_util::ValuesArray(arr);
+    values.SetSlice(values.offset + it.index_into_array(),
+                    end.index_into_array() - it.index_into_array());
+    return DoAppend(values, [&it]() {
+      const int64_t run_length = it.run_length();
+      ++it;
+      return run_length;
+    });
+  }
+
+  // Visit `arr` with the Action.  `next_run_length` returns the number of
+  // logical occurrences of each visited value: always 1, except when visiting
+  // the physical values of a run-end encoded array.
+  template <bool HasError = with_error_status, typename RunLengthFunc>
+  enable_if_t<!HasError, Status> DoAppend(const ArraySpan& arr,
+                                          RunLengthFunc&& next_run_length) {
     return VisitArraySpanInline<Type>(
         arr,
-        [this](Scalar v) {
+        [&](Scalar v) {
+          const int64_t run_length = next_run_length();
           auto on_found = [this](int32_t memo_index) {
             action_.ObserveFound(memo_index);
           };
@@ -308,11 +380,16 @@ class RegularHashKernel : public HashKernel {
             action_.ObserveNotFound(memo_index);
           };
 
-          int32_t unused_memo_index;
-          return memo_table_->GetOrInsert(v, std::move(on_found), std::move(on_not_found),
-                                          &unused_memo_index);
+          int32_t memo_index;
+          RETURN_NOT_OK(memo_table_->GetOrInsert(v, std::move(on_found),
+                                                 std::move(on_not_found), &memo_index));
+          if (run_length > 1) {
+            action_.ObserveFound(memo_index, run_length - 1);
+          }
+          return Status::OK();
         },
-        [this]() {
+        [&]() {
+          const int64_t run_length = next_run_length();
           if (action_.ShouldEncodeNulls()) {
             auto on_found = [this](int32_t memo_index) {
               action_.ObserveNullFound(memo_index);
@@ -320,19 +397,28 @@ class RegularHashKernel : public HashKernel {
             auto on_not_found = [this](int32_t memo_index) {
               action_.ObserveNullNotFound(memo_index);
             };
-            memo_table_->GetOrInsertNull(std::move(on_found), std::move(on_not_found));
+            const int32_t memo_index = memo_table_->GetOrInsertNull(
+                std::move(on_found), std::move(on_not_found));
+            if (run_length > 1) {
+              action_.ObserveNullFound(memo_index, run_length - 1);
+            }
           } else {
             action_.ObserveNullNotFound(-1);
+            if (run_length > 1) {
+              action_.ObserveNullFound(-1, run_length - 1);
+            }
           }
           return Status::OK();
         });
   }
 
-  template <bool HasError = with_error_status>
-  enable_if_t<HasError, Status> DoAppend(const ArraySpan& arr) {
+  template <bool HasError = with_error_status, typename RunLengthFunc>
+  enable_if_t<HasError, Status> DoAppend(const ArraySpan& arr,
+                                         RunLengthFunc&& next_run_length) {
     return VisitArraySpanInline<Type>(
         arr,
-        [this](Scalar v) {
+        [&](Scalar v) {
+          const int64_t run_length = next_run_length();
           Status s = Status::OK();
           auto on_found = [this](int32_t memo_index) {
             action_.ObserveFound(memo_index);
@@ -341,13 +427,17 @@ class RegularHashKernel : public HashKernel {
             action_.ObserveNotFound(memo_index, &s);
           };
 
-          int32_t unused_memo_index;
-          RETURN_NOT_OK(memo_table_->GetOrInsert(
-              v, std::move(on_found), std::move(on_not_found), &unused_memo_index));
+          int32_t memo_index;
+          RETURN_NOT_OK(memo_table_->GetOrInsert(v, std::move(on_found),
+                                                 std::move(on_not_found), &memo_index));
+          if (s.ok() && run_length > 1) {
+            action_.ObserveFound(memo_index, run_length - 1);
+          }
           return s;
         },
-        [this]() {
+        [&]() {
           // Null
+          const int64_t run_length = next_run_length();
           Status s = Status::OK();
           auto on_found = [this](int32_t memo_index) {
             action_.ObserveNullFound(memo_index);
@@ -356,7 +446,11 @@ class RegularHashKernel : public HashKernel {
             action_.ObserveNullNotFound(memo_index, &s);
           };
           if (action_.ShouldEncodeNulls()) {
-            memo_table_->GetOrInsertNull(std::move(on_found), std::move(on_not_found));
+            const int32_t memo_index = memo_table_->GetOrInsertNull(
+                std::move(on_found), std::move(on_not_found));
+            if (s.ok() && run_length > 1) {
+              action_.ObserveNullFound(memo_index, run_length - 1);
+            }
           }
           return s;
         });
@@ -442,59 +536,8 @@ class NullHashKernel : public HashKernel {
 
 class DictionaryHashKernel : public HashKernel {
  public:
-  explicit DictionaryHashKernel(std::unique_ptr<HashKernel> indices_kernel,
-                                std::shared_ptr<DataType> dictionary_value_type)
-      : indices_kernel_(std::move(indices_kernel)),
-        dictionary_value_type_(std::move(dictionary_value_type)) {}
-
-  Status Reset() override { return indices_kernel_->Reset(); }
-
-  Status Append(const ArraySpan& arr) override {
-    auto arr_dict = arr.dictionary().ToArray();
-    if (!first_dictionary_) {
-      first_dictionary_ = arr_dict;
-    } else if (!first_dictionary_->Equals(*arr_dict)) {
-      // NOTE: This approach computes a new dictionary unification per chunk.
-      // This is in effect O(n*k) where n is the total chunked array length and
-      // k is the number of chunks (therefore O(n**2) if chunks have a fixed size).
-      //
-      // A better approach may be to run the kernel over each individual chunk,
-      // and then hash-aggregate all results (for example sum-group-by for
-      // the "value_counts" kernel).
-      if (dictionary_unifier_ == nullptr) {
-        ARROW_ASSIGN_OR_RAISE(dictionary_unifier_,
-                              DictionaryUnifier::Make(first_dictionary_->type()));
-        RETURN_NOT_OK(dictionary_unifier_->Unify(*first_dictionary_));
-      }
-      auto out_dict_type = first_dictionary_->type();
-      std::shared_ptr<Buffer> transpose_map;
-
-      RETURN_NOT_OK(dictionary_unifier_->Unify(*arr_dict, &transpose_map));
-
-      auto transpose = reinterpret_cast<const int32_t*>(transpose_map->data());
-      auto in_array = arr.ToArray();
-      const auto& in_dict_array =
-          arrow::internal::checked_cast<const DictionaryArray&>(*in_array);
-      ARROW_ASSIGN_OR_RAISE(
-          auto tmp, in_dict_array.Transpose(arr.type->GetSharedPtr(),
-                                            in_dict_array.dictionary(), transpose));
-      return indices_kernel_->Append(*tmp->data());
-    }
-
-    return indices_kernel_->Append(arr);
-  }
-
-  Status Flush(ExecResult* out) override { return indices_kernel_->Flush(out); }
-
-  Status FlushFinal(ExecResult* out) override { return indices_kernel_->FlushFinal(out); }
-
-  Status GetDictionary(std::shared_ptr<ArrayData>* out) override {
-    return indices_kernel_->GetDictionary(out);
-  }
-
-  std::shared_ptr<DataType> value_type() const override {
-    return indices_kernel_->value_type();
-  }
+  explicit DictionaryHashKernel(std::shared_ptr<DataType> dictionary_value_type)
+      : dictionary_value_type_(std::move(dictionary_value_type)) {}
 
   std::shared_ptr<DataType> dictionary_value_type() const {
     return dictionary_value_type_;
@@ -516,13 +559,142 @@ class DictionaryHashKernel : public HashKernel {
     return out_dict;
   }
 
- private:
-  std::unique_ptr<HashKernel> indices_kernel_;
+ protected:
+  /// Record the dictionary of `arr`.  If it differs from the first dictionary
+  /// seen, unify it and return the transposition map from its indices to
+  /// the unified dictionary indices, otherwise return null.
+  Result<std::shared_ptr<Buffer>> UnifyDictionary(const ArraySpan& arr) {
+    auto arr_dict = arr.dictionary().ToArray();
+    if (!first_dictionary_) {
+      first_dictionary_ = arr_dict;
+      return nullptr;
+    }
+    if (first_dictionary_->Equals(*arr_dict)) {
+      return nullptr;
+    }
+    // NOTE: This approach computes a new dictionary unification per chunk.
+    // This is in effect O(n*k) where n is the total chunked array length and
+    // k is the number of chunks (therefore O(n**2) if chunks have a fixed size).
+    //
+    // A better approach may be to run the kernel over each individual chunk,
+    // and then hash-aggregate all results (for example sum-group-by for
+    // the "value_counts" kernel).
+    if (dictionary_unifier_ == nullptr) {
+      ARROW_ASSIGN_OR_RAISE(dictionary_unifier_,
+                            DictionaryUnifier::Make(first_dictionary_->type()));
+      RETURN_NOT_OK(dictionary_unifier_->Unify(*first_dictionary_));
+    }
+    std::shared_ptr<Buffer> transpose_map;
+    RETURN_NOT_OK(dictionary_unifier_->Unify(*arr_dict, &transpose_map));
+    return transpose_map;
+  }
+
   std::shared_ptr<Array> first_dictionary_;
   std::shared_ptr<DataType> dictionary_value_type_;
   std::unique_ptr<DictionaryUnifier> dictionary_unifier_;
 };
 
+// The indices are already a dense encoding of the values, so instead of
+// hashing them, occurrences are counted directly in a table indexed by the
+// (unified) dictionary index.  This serves both "unique" and "value_counts".
+template <typename IndexType>
+class TypedDictionaryHashKernel : public DictionaryHashKernel {
+ public:
+  using IndexCType = typename IndexType::c_type;
+
+  TypedDictionaryHashKernel(std::shared_ptr<DataType> index_type,
+                            std::shared_ptr<DataType> dictionary_value_type,
+                            MemoryPool* pool)
+      : DictionaryHashKernel(std::move(dictionary_value_type)),
+        pool_(pool),
+        index_type_(std::move(index_type)) {}
+
+  Status Reset() override {
+    counts_.clear();
+    null_count_ = 0;
+    uniques_.clear();
+    return Status::OK();
+  }
+
+  Status Append(const ArraySpan& arr) override {
+    ARROW_ASSIGN_OR_RAISE(auto transpose_map, UnifyDictionary(arr));
+    if (transpose_map == nullptr) {
+      counts_.resize(std::max<size_t>(counts_.size(), arr.dictionary().length), 0);
+      AppendIndices(arr, [](IndexCType index) { return static_cast<int64_t>(index); });
+      return Status::OK();
+    }
+    const auto transpose = transpose_map->data_as<int32_t>();
+    const int64_t transpose_length = transpose_map->size() / sizeof(int32_t);
+    for (int64_t i = 0; i < transpose_length; ++i) {
+      counts_.resize(std::max<size_t>(counts_.size(), transpose[i] + 1), 0);
+    }
+    AppendIndices(arr, [transpose](IndexCType index) {
+      return static_cast<int64_t>(transpose[index]);
+    });
+    return Status::OK();
+  }
+
+  Status Flush(ExecResult* out) override { return Status::OK(); }
+
+  // Return the counts corresponding to the uniques, in order of appearance
+  Status FlushFinal(ExecResult* out) override {
+    Int64Builder builder(pool_);
+    RETURN_NOT_OK(builder.Reserve(static_cast<int64_t>(uniques_.size())));
+    for (const int64_t slot : uniques_) {
+      builder.UnsafeAppend(slot == kNullSlot ? null_count_ : counts_[slot]);
+    }
+    std::shared_ptr<ArrayData> result;
+    RETURN_NOT_OK(builder.FinishInternal(&result));
+    out->value = std::move(result);
+    return Status::OK();
+  }
+
+  // Return the unique indices (into the unified dictionary), in order of appearance
+  Status GetDictionary(std::shared_ptr<ArrayData>* out) override {
+    NumericBuilder<IndexType> builder(index_type_, pool_);
+    RETURN_NOT_OK(builder.Reserve(static_cast<int64_t>(uniques_.size())));
+    for (const int64_t slot : uniques_) {
+      if (slot == kNullSlot) {
+        builder.UnsafeAppendNull();
+      } else {
+        builder.UnsafeAppend(static_cast<IndexCType>(slot));
+      }
+    }
+    return builder.FinishInternal(out);
+  }
+
+  std::shared_ptr<DataType> value_type() const override { return index_type_; }
+
+ private:
+  static constexpr int64_t kNullSlot = -1;
+
+  template <typename MapIndex>
+  void AppendIndices(const ArraySpan& indices, MapIndex&& map_index) {
+    VisitArraySpanInline<IndexType>(
+        indices,
+        [&](IndexCType index) {
+          const int64_t slot = map_index(index);
+          if (counts_[slot]++ == 0) {
+            uniques_.push_back(slot);
+          }
+        },
+        [&]() {
+          if (null_count_++ == 0) {
+            uniques_.push_back(kNullSlot);
+          }
+        });
+  }
+
+  MemoryPool* pool_;
+  std::shared_ptr<DataType> index_type_;
+  // Number of occurrences of each (unified) dictionary index
+  std::vector<int64_t> counts_;
+  // Number of null indices
+  int64_t null_count_ = 0;
+  // Dictionary indices (or kNullSlot) in order of first appearance
+  std::vector<int64_t> uniques_;
+};
+
 // ----------------------------------------------------------------------
 template <typename HashKernel>
 Result<std::unique_ptr<KernelState>> HashInit(KernelContext* ctx,
@@ -581,21 +753,60 @@ KernelInit GetHashInit(Type::type type_id) {
     case Type::INTERVAL_MONTH_DAY_NANO:
       return HashInit<RegularHashKernel<MonthDayNanoIntervalType, Action>>;
     default:
-      Unreachable("non hashable type");
+      // Non hashable type
+      return nullptr;
   }
 }
 
 using DictionaryEncodeState = OptionsWrapper<DictionaryEncodeOptions>;
 
-template <typename Action>
+template <typename IndexType>
+Result<std::unique_ptr<KernelState>> MakeDictionaryHashKernel(
+    KernelContext* ctx, const DictionaryType& dict_type) {
+  auto result = std::make_unique<TypedDictionaryHashKernel<IndexType>>(
+      dict_type.index_type(), dict_type.value_type(), ctx->memory_pool());
+  RETURN_NOT_OK(result->Reset());
+  return std::unique_ptr<KernelState>(std::move(result));
+}
+
 Result<std::unique_ptr<KernelState>> DictionaryHashInit(KernelContext* ctx,
                                                         const KernelInitArgs& args) {
   const auto& dict_type = checked_cast<const DictionaryType&>(*args.inputs[0].type);
-  ARROW_ASSIGN_OR_RAISE(auto indices_hasher,
-                        GetHashInit<Action>(dict_type.index_type()->id())(ctx, args));
-  return std::make_unique<DictionaryHashKernel>(
-      checked_pointer_cast<HashKernel>(std::move(indices_hasher)),
-      dict_type.value_type());
+  switch (dict_type.index_type()->id()) {
+    case Type::INT8:
+      return MakeDictionaryHashKernel<Int8Type>(ctx, dict_type);
+    case Type::UINT8:
+      return MakeDictionaryHashKernel<UInt8Type>(ctx, dict_type);
+    case Type::INT16:
+      return MakeDictionaryHashKernel<Int16Type>(ctx, dict_type);
+    case Type::UINT16:
+      return MakeDictionaryHashKernel<UInt16Type>(ctx, dict_type);
+    case Type::INT32:
+      return MakeDictionaryHashKernel<Int32Type>(ctx, dict_type);
+    case Type::UINT32:
+      return MakeDictionaryHashKernel<UInt32Type>(ctx, dict_type);
+    case Type::INT64:
+      return MakeDictionaryHashKernel<Int64Type>(ctx, dict_type);
+    case Type::UINT64:
+      return MakeDictionaryHashKernel<UInt64Type>(ctx, dict_type);
+    default:
+      return Status::TypeError("Invalid dictionary index type: ",
+                               *dict_type.index_type());
+  }
+}
+
+// Run-end encoded arrays are hashed by their values, visiting each run once
+template <typename Action>
+Result<std::unique_ptr<KernelState>> RunEndEncodedHashInit(KernelContext* ctx,
+                                                           const KernelInitArgs& args) {
+  const auto& ree_type = checked_cast<const RunEndEncodedType&>(*args.inputs[0].type);
+  auto init = GetHashInit<Action>(ree_type.value_type()->id());
+  if (!init) {
+    return Status::NotImplemented("Hashing run-end encoded arrays of ",
+                                  *ree_type.value_type());
+  }
+  const std::vector<TypeHolder> value_types = {ree_type.value_type()};
+  return init(ctx, KernelInitArgs{args.kernel, value_types, args.options});
 }
 
 Status HashExec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
@@ -679,19 +890,33 @@ Status ValueCountsFinalizeDictionary(KernelContext* ctx, std::vector<Datum>* out
   return Status::OK();
 }
 
+// Run-end encoded inputs are hashed by their values, so the results are
+// expressed in terms of the value type.
+std::shared_ptr<DataType> HashedValueType(const TypeHolder& type) {
+  if (type.id() == Type::RUN_END_ENCODED) {
+    return checked_cast<const RunEndEncodedType&>(*type.type).value_type();
+  }
+  return type.GetSharedPtr();
+}
+
+Result<TypeHolder> UniqueOutput(KernelContext*, const std::vector<TypeHolder>& types) {
+  return HashedValueType(types[0]);
+}
+
 Result<TypeHolder> DictEncodeOutput(KernelContext*,
                                     const std::vector<TypeHolder>& types) {
-  return dictionary(int32(), types[0].GetSharedPtr());
+  return dictionary(int32(), HashedValueType(types[0]));
 }
 
 Result<TypeHolder> ValueCountsOutput(KernelContext*,
                                      const std::vector<TypeHolder>& types) {
-  return struct_({field(kValuesFieldName, types[0].GetSharedPtr()),
+  return struct_({field(kValuesFieldName, HashedValueType(types[0])),
                   field(kCountsFieldName, int64())});
 }
 
 template <typename Action>
-void AddHashKernels(VectorFunction* func, VectorKernel base, OutputType out_ty) {
+void AddHashKernels(VectorFunction* func, VectorKernel base, OutputType out_ty,
+                    OutputType ree_out_ty) {
   for (const auto& ty : PrimitiveTypes()) {
     base.init = GetHashInit<Action>(ty->id());
     base.signature = KernelSignature::Make({ty}, out_ty);
@@ -718,6 +943,10 @@ void AddHashKernels(VectorFunction* func, VectorKernel base, OutputType out_ty)
     base.signature = KernelSignature::Make({ty}, out_ty);
     DCHECK_OK(func->AddKernel(base));
   }
+
+  base.init = RunEndEncodedHashInit<Action>;
+  base.signature = KernelSignature::Make({Type::RUN_END_ENCODED}, std::move(ree_out_ty));
+  DCHECK_OK(func->AddKernel(base));
 }
 
 const FunctionDoc unique_doc("Compute unique elements",
@@ -787,10 +1016,10 @@ void RegisterVectorHash(FunctionRegistry* registry) {
   base.finalize = UniqueFinalize;
   base.output_chunked = false;
   auto unique = std::make_shared<VectorFunction>("unique", Arity::Unary(), unique_doc);
-  AddHashKernels<UniqueAction>(unique.get(), base, FirstType);
+  AddHashKernels<UniqueAction>(unique.get(), base, FirstType, UniqueOutput);
 
   // Dictionary unique
-  base.init = DictionaryHashInit<UniqueAction>;
+  base.init = DictionaryHashInit;
   base.finalize = UniqueFinalizeDictionary;
   base.signature = KernelSignature::Make({Type::DICTIONARY}, FirstType);
   DCHECK_OK(unique->AddKernel(base));
@@ -803,10 +1032,11 @@ void RegisterVectorHash(FunctionRegistry* registry) {
   base.finalize = ValueCountsFinalize;
   auto value_counts =
       std::make_shared<VectorFunction>("value_counts", Arity::Unary(), value_counts_doc);
-  AddHashKernels<ValueCountsAction>(value_counts.get(), base, ValueCountsOutput);
+  AddHashKernels<ValueCountsAction>(value_counts.get(), base, ValueCountsOutput,
+                                    ValueCountsOutput);
 
   // Dictionary value counts
-  base.init = DictionaryHashInit<ValueCountsAction>;
+  base.init = DictionaryHashInit;
   base.finalize = ValueCountsFinalizeDictionary;
   base.signature = KernelSignature::Make({Type::DICTIONARY}, ValueCountsOutput);
   DCHECK_OK(value_counts->AddKernel(base));
@@ -823,7 +1053,8 @@ void RegisterVectorHash(FunctionRegistry* registry) {
   auto dict_encode = std::make_shared<VectorFunction>(
       "dictionary_encode", Arity::Unary(), dictionary_encode_doc,
       GetDefaultDictionaryEncodeOptions());
-  AddHashKernels<DictEncodeAction>(dict_encode.get(), base, DictEncodeOutput);
+  AddHashKernels<DictEncodeAction>(dict_encode.get(), base, DictEncodeOutput,
+                                   DictEncodeOutput);
 
   auto no_op = [](KernelContext*, const ExecSpan& span, ExecResult* out) {
     out->value = span[0].array.ToArrayData();
@@ -226,6 +226,31 @@ static void ValueCountsDictionaryChunks(benchmark::State& state) {
       state, HashParams<StringType>{general_bench_cases[state.range(0)], 10});
 }
 
+template <typename ParamType>
+void BenchValueCountsRunEndEncoded(benchmark::State& state, const ParamType& params) {
+  std::shared_ptr<Array> arr;
+  params.GenerateTestData(&arr);
+  // Sort the values so that each distinct value forms a single run
+  auto indices = SortIndices(*arr).ValueOrDie();
+  auto sorted = Take(*arr, *indices).ValueOrDie();
+  auto ree = RunEndEncode(sorted).ValueOrDie().make_array();
+
+  while (state.KeepRunning()) {
+    ABORT_NOT_OK(ValueCounts(ree).status());
+  }
+  params.SetMetadata(state);
+}
+
+static void ValueCountsRunEndEncodedInt64(benchmark::State& state) {
+  BenchValueCountsRunEndEncoded(
+      state, HashParams<Int64Type>{general_bench_cases[state.range(0)]});
+}
+
+static void ValueCountsRunEndEncodedString10bytes(benchmark::State& state) {
+  BenchValueCountsRunEndEncoded(
+      state, HashParams<StringType>{general_bench_cases[state.range(0)], 10});
+}
+
 void HashSetArgs(benchmark::internal::Benchmark* bench) {
   for (int i = 0; i < static_cast<int>(general_bench_cases.size()); ++i) {
     bench->Arg(i);
@@ -246,6 +271,8 @@ void DictionaryChunksHashSetArgs(benchmark::internal::Benchmark* bench) {
 }
 
 BENCHMARK(ValueCountsDictionaryChunks)->Apply(DictionaryChunksHashSetArgs);
+BENCHMARK(ValueCountsRunEndEncodedInt64)->Apply(HashSetArgs);
+BENCHMARK(ValueCountsRunEndEncodedString10bytes)->Apply(HashSetArgs);
 
 void UInt8SetArgs(benchmark::internal::Benchmark* bench) {
   for (int i = 0; i < static_cast<int>(uint8_bench_cases.size()); ++i) {
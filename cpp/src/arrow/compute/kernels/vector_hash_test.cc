@@ -766,6 +766,46 @@ TEST_F(TestHashKernel, DictionaryUniqueAndValueCounts) {
   }
 }
 
+TEST_F(TestHashKernel, RunEndEncodedUniqueAndValueCounts) {
+  auto values =
+      ArrayFromJSON(utf8(), R"(["b", "b", "a", null, null, "b", "c", "c", "c", "a"])");
+  for (const auto& run_end_type : {int16(), int32(), int64()}) {
+    ARROW_SCOPED_TRACE("run_end_type = ", *run_end_type);
+    ASSERT_OK_AND_ASSIGN(Datum ree,
+                         RunEndEncode(values, RunEndEncodeOptions{run_end_type}));
+    auto input = ree.make_array();
+
+    auto ex_uniques = ArrayFromJSON(utf8(), R"(["b", "a", null, "c"])");
+    CheckUnique(input, ex_uniques);
+    CheckValueCounts(input, ex_uniques, ArrayFromJSON(int64(), "[3, 2, 2, 3]"));
+    CheckDictEncode(input, ArrayFromJSON(utf8(), R"(["b", "a", "c"])"),
+                    ArrayFromJSON(int32(), "[0, 0, 1, null, null, 0, 2, 2, 2, 1]"));
+
+    // Slice starting and ending in the middle of runs
+    auto sliced = input->Slice(1, 7);
+    CheckUnique(sliced, ex_uniques);
+    CheckValueCounts(sliced, ex_uniques, ArrayFromJSON(int64(), "[2, 1, 2, 2]"));
+    CheckDictEncode(sliced, ArrayFromJSON(utf8(), R"(["b", "a", "c"])"),
+                    ArrayFromJSON(int32(), "[0, 1, null, null, 0, 2, 2]"));
+
+    // Chunked array
+    auto chunked = *ChunkedArray::Make({input->Slice(0, 4), input->Slice(4)});
+    CheckUnique(chunked, ex_uniques);
+    CheckValueCounts(chunked, ex_uniques, ArrayFromJSON(int64(), "[3, 2, 2, 3]"));
+
+    // Empty array
+    CheckUnique(input->Slice(0, 0), ArrayFromJSON(utf8(), "[]"));
+    CheckValueCounts(input->Slice(0, 0), ArrayFromJSON(utf8(), "[]"),
+                     ArrayFromJSON(int64(), "[]"));
+  }
+}
+
+TEST_F(TestHashKernel, RunEndEncodedUnsupportedValueType) {
+  auto values = ArrayFromJSON(list(int32()), "[[1], [1], [2]]");
+  ASSERT_OK_AND_ASSIGN(Datum ree, RunEndEncode(values));
+  ASSERT_RAISES(NotImplemented, ValueCounts(ree.make_array()));
+}
+
 /* TODO(ARROW-4124): Determine if we want to do something that is reproducible with
  * floats.
 TEST_F(TestHashKernel, ValueCountsFloat) {
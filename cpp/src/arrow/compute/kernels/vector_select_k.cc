@@ -47,6 +47,33 @@ const FunctionDoc select_k_unstable_doc(
      "greater than any other non-null value, but smaller than null values."),
     {"input"}, "SelectKOptions", /*options_required=*/true);
 
+// Minimum number of rows handled by each task of a parallel selection
+constexpr int64_t kMinParallelSelectLength = 1 << 16;
+
+// Number of concurrent tasks to split the selection of `length` rows into
+int NumSelectTasks(const SortParallelism& parallelism, int64_t length) {
+  return static_cast<int>(
+      std::min<int64_t>(parallelism.num_threads(),
+                        std::max<int64_t>(1, length / kMinParallelSelectLength)));
+}
+
+// Move the entries of heap `from` into heap `to`, keeping the first `k` entries
+// according to `cmp`.
+template <typename HeapContainer, typename Compare>
+void MergeSelectKHeaps(HeapContainer* from, HeapContainer* to, int64_t k,
+                       const Compare& cmp) {
+  while (!from->empty()) {
+    const auto item = from->top();
+    from->pop();
+    if (to->size() < static_cast<size_t>(k)) {
+      to->push(item);
+    } else if (cmp(item, to->top())) {
+      to->pop();
+      to->push(item);
+    }
+  }
+}
+
 template <SortOrder order>
 class SelectKComparator {
  public:
@@ -164,6 +191,10 @@ struct TypedHeapItem {
   ArrayType* array;
 };
 
+// Select the first `k` values of a chunked array.
+//
+// Contiguous groups of chunks are each processed with their own heap,
+// concurrently if the ExecContext allows it, and the heaps are merged at the end.
 class ChunkedArraySelector : public TypeVisitor {
  public:
   ChunkedArraySelector(ExecContext* ctx, const ChunkedArray& chunked_array,
@@ -175,6 +206,7 @@ class ChunkedArraySelector : public TypeVisitor {
         k_(options.k),
         order_(options.sort_keys[0].order),
         ctx_(ctx),
+        parallelism_(SortParallelism::Make(ctx)),
         output_(output) {}
 
   Status Run() { return physical_type_->Accept(this); }
@@ -214,13 +246,22 @@ class ChunkedArraySelector : public TypeVisitor {
     using HeapContainer =
         std::priority_queue<HeapItem, std::vector<HeapItem>, decltype(cmp)>;
 
-    HeapContainer heap(cmp);
     std::vector<std::shared_ptr<ArrayType>> chunks_holder;
+    std::vector<uint64_t> chunk_offsets;
     uint64_t offset = 0;
     for (const auto& chunk : physical_chunks_) {
-      if (chunk->length() == 0) continue;
-      chunks_holder.emplace_back(std::make_shared<ArrayType>(chunk->data()));
-      ArrayType& arr = *chunks_holder[chunks_holder.size() - 1];
+      if (chunk->length() > 0) {
+        chunks_holder.emplace_back(std::make_shared<ArrayType>(chunk->data()));
+        chunk_offsets.push_back(offset);
+        // Compute the null count upfront, as it is lazily computed and cached
+        chunks_holder.back()->null_count();
+      }
+      offset += chunk->length();
+    }
+
+    auto select_chunk = [&](size_t chunk_index, HeapContainer* heap) {
+      ArrayType& arr = *chunks_holder[chunk_index];
+      const uint64_t chunk_offset = chunk_offsets[chunk_index];
 
       std::vector<uint64_t> indices(arr.length());
       uint64_t* indices_begin = indices.data();
@@ -233,21 +274,49 @@ class ChunkedArraySelector : public TypeVisitor {
 
       auto kth_begin = std::min(indices_begin + k_, end_iter);
       uint64_t* iter = indices_begin;
-      for (; iter != kth_begin && heap.size() < static_cast<size_t>(k_); ++iter) {
-        heap.push(HeapItem{*iter, offset, &arr});
+      for (; iter != kth_begin && heap->size() < static_cast<size_t>(k_); ++iter) {
+        heap->push(HeapItem{*iter, chunk_offset, &arr});
       }
-      for (; iter != end_iter && !heap.empty(); ++iter) {
+      for (; iter != end_iter && !heap->empty(); ++iter) {
         uint64_t x_index = *iter;
         const auto& xval = GetView::LogicalValue(arr.GetView(x_index));
-        auto top_item = heap.top();
+        auto top_item = heap->top();
         const auto& top_value =
             GetView::LogicalValue(top_item.array->GetView(top_item.index));
         if (comparator(xval, top_value)) {
-          heap.pop();
-          heap.push(HeapItem{x_index, offset, &arr});
+          heap->pop();
+          heap->push(HeapItem{x_index, chunk_offset, &arr});
         }
       }
-      offset += chunk->length();
+    };
+
+    // Assign each chunk to a group according to its starting row
+    const int num_groups = std::min(
+        static_cast<int>(chunks_holder.size()),
+        NumSelectTasks(parallelism_, static_cast<int64_t>(offset)));
+    std::vector<size_t> group_begins(num_groups + 1, chunks_holder.size());
+    for (size_t i = chunks_holder.size(); i-- > 0;) {
+      const auto group = static_cast<size_t>(chunk_offsets[i] * num_groups / offset);
+      group_begins[group] = i;
+    }
+    group_begins[0] = 0;
+    for (int group = num_groups - 1; group > 0; --group) {
+      group_begins[group] = std::min(group_begins[group], group_begins[group + 1]);
+    }
+
+    std::vector<HeapContainer> heaps(num_groups, HeapContainer(cmp));
+    RETURN_NOT_OK(parallelism_.For(num_groups, [&](int group) {
+      for (size_t i = group_begins[group]; i < group_begins[group + 1]; ++i) {
+        select_chunk(i, &heaps[group]);
+      }
+      return Status::OK();
+    }));
+    if (heaps.empty()) {
+      heaps.emplace_back(cmp);
+    }
+    HeapContainer& heap = heaps[0];
+    for (int group = 1; group < num_groups; ++group) {
+      MergeSelectKHeaps(&heaps[group], &heap, k_, cmp);
     }
 
     auto out_size = static_cast<int64_t>(heap.size());
@@ -270,6 +339,7 @@ class ChunkedArraySelector : public TypeVisitor {
   int64_t k_;
   SortOrder order_;
   ExecContext* ctx_;
+  const SortParallelism parallelism_;
   Datum* output_;
 };
 
@@ -421,6 +491,7 @@ class TableSelector : public TypeVisitor {
                 Datum* output)
       : TypeVisitor(),
         ctx_(ctx),
+        parallelism_(SortParallelism::Make(ctx)),
         table_(table),
         k_(options.k),
         output_(output),
@@ -489,6 +560,9 @@ class TableSelector : public TypeVisitor {
   // XXX this implementation is rather inefficient as it computes chunk indices
   // at every comparison.  Instead we should iterate over individual batches
   // and remember ChunkLocation entries in the max-heap.
+  //
+  // Contiguous row ranges are each processed with their own heap, concurrently
+  // if the ExecContext allows it, and the heaps are merged at the end.
 
   template <typename InType, SortOrder sort_order>
   Status SelectKthInternal() {
@@ -518,23 +592,35 @@ class TableSelector : public TypeVisitor {
         std::priority_queue<uint64_t, std::vector<uint64_t>, decltype(cmp)>;
 
     std::vector<uint64_t> indices(num_rows);
-    uint64_t* indices_begin = indices.data();
-    uint64_t* indices_end = indices_begin + indices.size();
-    std::iota(indices_begin, indices_end, 0);
+    const int num_tasks = NumSelectTasks(parallelism_, num_rows);
+    std::vector<HeapContainer> heaps(num_tasks, HeapContainer(cmp));
 
-    const auto p =
-        this->PartitionNullsInternal<InType>(indices_begin, indices_end, first_sort_key);
-    const auto end_iter = p.non_nulls_end;
-    auto kth_begin = std::min(indices_begin + k_, end_iter);
+    RETURN_NOT_OK(parallelism_.For(num_tasks, [&](int task) {
+      uint64_t* indices_begin = indices.data() + num_rows * task / num_tasks;
+      uint64_t* indices_end = indices.data() + num_rows * (task + 1) / num_tasks;
+      std::iota(indices_begin, indices_end,
+                static_cast<uint64_t>(indices_begin - indices.data()));
 
-    HeapContainer heap(indices_begin, kth_begin, cmp);
-    for (auto iter = kth_begin; iter != end_iter && !heap.empty(); ++iter) {
-      uint64_t x_index = *iter;
-      uint64_t top_item = heap.top();
-      if (cmp(x_index, top_item)) {
-        heap.pop();
-        heap.push(x_index);
+      const auto p = this->PartitionNullsInternal<InType>(indices_begin, indices_end,
+                                                          first_sort_key);
+      const auto end_iter = p.non_nulls_end;
+      auto kth_begin = std::min(indices_begin + k_, end_iter);
+
+      HeapContainer& heap = heaps[task];
+      heap = HeapContainer(indices_begin, kth_begin, cmp);
+      for (auto iter = kth_begin; iter != end_iter && !heap.empty(); ++iter) {
+        uint64_t x_index = *iter;
+        uint64_t top_item = heap.top();
+        if (cmp(x_index, top_item)) {
+          heap.pop();
+          heap.push(x_index);
+        }
       }
+      return Status::OK();
+    }));
+    HeapContainer& heap = heaps[0];
+    for (int task = 1; task < num_tasks; ++task) {
+      MergeSelectKHeaps(&heaps[task], &heap, k_, cmp);
     }
     auto out_size = static_cast<int64_t>(heap.size());
     ARROW_ASSIGN_OR_RAISE(auto take_indices,
@@ -551,6 +637,7 @@ class TableSelector : public TypeVisitor {
 
   Status status_;
   ExecContext* ctx_;
+  const SortParallelism parallelism_;
   const Table& table_;
   int64_t k_;
   Datum* output_;
@@ -19,6 +19,7 @@
 
 #include "arrow/compute/function.h"
 #include "arrow/compute/kernels/vector_sort_internal.h"
+#include "arrow/compute/kernels/vector_sort_normalized_key_internal.h"
 #include "arrow/compute/registry.h"
 
 namespace arrow {
@@ -40,6 +41,10 @@ Result<RecordBatchVector> BatchesFromTable(const Table& table) {
 
 // Sort a chunked array by sorting each array in the chunked array,
 // then merging the sorted chunks recursively.
+//
+// If the ExecContext allows it, chunks are sorted concurrently, the merges
+// at each level of the merge tree run concurrently and large merges are
+// themselves split into concurrent pieces.
 class ChunkedArraySorter : public TypeVisitor {
  public:
   ChunkedArraySorter(ExecContext* ctx, uint64_t* indices_begin, uint64_t* indices_end,
@@ -54,6 +59,7 @@ class ChunkedArraySorter : public TypeVisitor {
         order_(order),
         null_placement_(null_placement),
         ctx_(ctx),
+        parallelism_(SortParallelism::Make(ctx)),
         output_(output) {}
 
   Status Sort() {
@@ -87,23 +93,27 @@ class ChunkedArraySorter : public TypeVisitor {
     const auto arrays = GetArrayPointers(physical_chunks_);
 
     // Sort each chunk independently and merge to sorted indices.
-    // This is a serial implementation.
     std::vector<NullPartitionResult> sorted(num_chunks);
 
-    // First sort all individual chunks
-    int64_t begin_offset = 0;
-    int64_t end_offset = 0;
+    // Compute chunk offsets and null counts upfront, as the latter may be
+    // lazily computed and cached in the array data.
+    std::vector<int64_t> offsets(num_chunks + 1);
     int64_t null_count = 0;
+    offsets[0] = 0;
     for (int i = 0; i < num_chunks; ++i) {
-      const auto array = checked_cast<const ArrayType*>(arrays[i]);
-      end_offset += array->length();
-      null_count += array->null_count();
-      ARROW_ASSIGN_OR_RAISE(sorted[i], array_sorter_(indices_begin_ + begin_offset,
-                                                     indices_begin_ + end_offset, *array,
-                                                     begin_offset, options, ctx_));
-      begin_offset = end_offset;
+      offsets[i + 1] = offsets[i] + arrays[i]->length();
+      null_count += arrays[i]->null_count();
     }
-    DCHECK_EQ(end_offset, num_indices);
+    DCHECK_EQ(offsets[num_chunks], num_indices);
+
+    // First sort all individual chunks
+    RETURN_NOT_OK(parallelism_.For(num_chunks, [&](int i) -> Status {
+      const auto array = checked_cast<const ArrayType*>(arrays[i]);
+      ARROW_ASSIGN_OR_RAISE(sorted[i], array_sorter_(indices_begin_ + offsets[i],
+                                                     indices_begin_ + offsets[i + 1],
+                                                     *array, offsets[i], options, ctx_));
+      return Status::OK();
+    }));
 
     // Then merge them by pairs, recursively
     if (sorted.size() > 1) {
@@ -135,25 +145,13 @@ class ChunkedArraySorter : public TypeVisitor {
 
       ChunkedMergeImpl merge_impl{null_placement_, std::move(merge_nulls),
                                   std::move(merge_non_nulls)};
-      // std::merge is only called on non-null values, so size temp indices accordingly
-      RETURN_NOT_OK(merge_impl.Init(ctx_, num_indices - null_count));
-
-      while (chunk_sorted.size() > 1) {
-        // Merge all pairs of chunks
-        auto out_it = chunk_sorted.begin();
-        auto it = chunk_sorted.begin();
-        while (it < chunk_sorted.end() - 1) {
-          const auto& left = *it++;
-          const auto& right = *it++;
-          DCHECK_EQ(left.overall_end(), right.overall_begin());
-          const auto merged = merge_impl.Merge(left, right, null_count);
-          *out_it++ = merged;
-        }
-        if (it < chunk_sorted.end()) {
-          *out_it++ = *it++;
-        }
-        chunk_sorted.erase(out_it, chunk_sorted.end());
-      }
+      // std::merge is only called on non-null values, so size temp indices accordingly,
+      // unless concurrent merges need a temporary area spanning all chunks
+      RETURN_NOT_OK(merge_impl.Init(
+          ctx_, parallelism_.enabled() ? num_indices : num_indices - null_count));
+
+      // Merge all pairs of chunks, recursively
+      RETURN_NOT_OK(merge_impl.MergeAll(&chunk_sorted, null_count, parallelism_));
 
       // Reverse everything
       sorted.resize(1);
@@ -180,20 +178,22 @@ class ChunkedArraySorter : public TypeVisitor {
     using ArrowType = typename ArrayType::TypeClass;
 
     if (order_ == SortOrder::Ascending) {
-      std::merge(range_begin, range_middle, range_middle, range_end, temp_indices,
-                 [&](CompressedChunkLocation left, CompressedChunkLocation right) {
-                   return ChunkValue<ArrowType>(arrays, left) <
-                          ChunkValue<ArrowType>(arrays, right);
-                 });
+      parallelism_.Merge(
+          range_begin, range_middle, range_end, temp_indices,
+          [&](CompressedChunkLocation left, CompressedChunkLocation right) {
+            return ChunkValue<ArrowType>(arrays, left) <
+                   ChunkValue<ArrowType>(arrays, right);
+          });
     } else {
-      std::merge(range_begin, range_middle, range_middle, range_end, temp_indices,
-                 [&](CompressedChunkLocation left, CompressedChunkLocation right) {
-                   // We don't use 'left > right' here to reduce required
-                   // operator. If we use 'right < left' here, '<' is only
-                   // required.
-                   return ChunkValue<ArrowType>(arrays, right) <
-                          ChunkValue<ArrowType>(arrays, left);
-                 });
+      parallelism_.Merge(
+          range_begin, range_middle, range_end, temp_indices,
+          [&](CompressedChunkLocation left, CompressedChunkLocation right) {
+            // We don't use 'left > right' here to reduce required
+            // operator. If we use 'right < left' here, '<' is only
+            // required.
+            return ChunkValue<ArrowType>(arrays, right) <
+                   ChunkValue<ArrowType>(arrays, left);
+          });
     }
     // Copy back temp area into main buffer
     std::copy(temp_indices, temp_indices + (range_end - range_begin), range_begin);
@@ -214,6 +214,7 @@ class ChunkedArraySorter : public TypeVisitor {
   const NullPlacement null_placement_;
   ArraySortFunc array_sorter_;
   ExecContext* ctx_;
+  const SortParallelism parallelism_;
   NullPartitionResult* output_;
 };
 
@@ -617,10 +618,46 @@ class MultipleKeyRecordBatchSorter : public TypeVisitor {
 // ----------------------------------------------------------------------
 // Table sorting implementation(s)
 
+// The minimum number of sort keys for which rows are compared on normalized
+// keys, rather than one sort key at a time.  With fewer sort keys, ties on the
+// first sort key are usually too rare to make up for encoding all keys.
+constexpr int kMinNormalizedSortKeys = 3;
+
+// Whether sorting on normalized keys is worthwhile and supported for the
+// given sort keys.
+template <typename ResolvedSortKey>
+bool UseNormalizedSortKeys(const std::vector<ResolvedSortKey>& sort_keys) {
+  return sort_keys.size() >= static_cast<size_t>(kMinNormalizedSortKeys) &&
+         std::all_of(sort_keys.begin(), sort_keys.end(), [](const auto& sort_key) {
+           return NormalizedSortKeys::CanNormalize(*sort_key.type);
+         });
+}
+
+Status SortOnNormalizedKeys(uint64_t* indices_begin, uint64_t* indices_end,
+                            const std::vector<ResolvedRecordBatchSortKey>& sort_keys,
+                            NullPlacement null_placement, MemoryPool* pool) {
+  std::vector<const Array*> columns;
+  std::vector<SortOrder> orders;
+  for (const auto& sort_key : sort_keys) {
+    columns.push_back(&sort_key.array);
+    orders.push_back(sort_key.order);
+  }
+  ARROW_ASSIGN_OR_RAISE(auto keys,
+                        NormalizedSortKeys::Make(columns, orders, null_placement, pool));
+  keys.SortIndices(indices_begin, indices_end, /*offset=*/0);
+  return Status::OK();
+}
+
 // Sort a table using an explicit merge sort.
 // Each batch is first sorted individually (taking advantage of the fact
 // that batch columns are contiguous and therefore have less indexing
-// overhead), then sorted batches are merged recursively.
+// overhead), then sorted batches are merged recursively.  As for chunked
+// arrays, both steps run concurrently if the ExecContext allows it.
+//
+// With many sort keys, the sort keys of each batch are first encoded into
+// normalized keys (see NormalizedSortKeys), so that rows are sorted and
+// merged with byte string comparisons instead of type-dispatched comparisons
+// of each sort key in turn.
 class TableSorter {
   // TODO make all methods const and defer initialization into a Init() method?
  private:
@@ -631,6 +668,7 @@ class TableSorter {
   TableSorter(ExecContext* ctx, uint64_t* indices_begin, uint64_t* indices_end,
               const Table& table, const SortOptions& options)
       : ctx_(ctx),
+        parallelism_(SortParallelism::Make(ctx)),
         table_(table),
         batches_(MakeBatches(table, &status_)),
         options_(options),
@@ -638,7 +676,8 @@ class TableSorter {
         sort_keys_(ResolveSortKeys(table, batches_, options.sort_keys, &status_)),
         indices_begin_(indices_begin),
         indices_end_(indices_end),
-        comparator_(sort_keys_, null_placement_) {}
+        comparator_(sort_keys_, null_placement_),
+        use_normalized_keys_(UseNormalizedSortKeys(sort_keys_)) {}
 
   // This is optimized for null partitioning and merging along the first sort key.
   // Other sort keys are delegated to the Comparator class.
@@ -676,24 +715,47 @@ class TableSorter {
     }
     std::vector<NullPartitionResult> sorted(num_batches);
 
+    std::vector<int64_t> offsets(num_batches + 1);
+    offsets[0] = 0;
+    for (int64_t i = 0; i < num_batches; ++i) {
+      offsets[i + 1] = offsets[i] + batches_[i]->num_rows();
+    }
+    DCHECK_EQ(offsets[num_batches], indices_end_ - indices_begin_);
+
     // First sort all individual batches
-    int64_t begin_offset = 0;
-    int64_t end_offset = 0;
+    if (use_normalized_keys_) {
+      normalized_keys_.resize(num_batches);
+      RETURN_NOT_OK(
+          parallelism_.For(static_cast<int>(num_batches), [&](int i) -> Status {
+            ARROW_ASSIGN_OR_RAISE(normalized_keys_[i], MakeNormalizedKeys(i));
+            uint64_t* batch_begin = indices_begin_ + offsets[i];
+            uint64_t* batch_end = indices_begin_ + offsets[i + 1];
+            normalized_keys_[i].SortIndices(batch_begin, batch_end, offsets[i]);
+            // Nulls are ordered by the normalized keys like any other value
+            sorted[i] =
+                NullPartitionResult::NoNulls(batch_begin, batch_end, null_placement_);
+            return Status::OK();
+          }));
+    } else {
+      RETURN_NOT_OK(
+          parallelism_.For(static_cast<int>(num_batches), [&](int i) -> Status {
+            const auto& batch = *batches_[i];
+            RadixRecordBatchSorter sorter(indices_begin_ + offsets[i],
+                                          indices_begin_ + offsets[i + 1], batch,
+                                          options_);
+            ARROW_ASSIGN_OR_RAISE(sorted[i], sorter.Sort(offsets[i]));
+            DCHECK_EQ(sorted[i].overall_begin(), indices_begin_ + offsets[i]);
+            DCHECK_EQ(sorted[i].overall_end(), indices_begin_ + offsets[i + 1]);
+            DCHECK_EQ(sorted[i].non_null_count() + sorted[i].null_count(),
+                      batch.num_rows());
+            return Status::OK();
+          }));
+    }
     int64_t null_count = 0;
-    for (int64_t i = 0; i < num_batches; ++i) {
-      const auto& batch = *batches_[i];
-      end_offset += batch.num_rows();
-      RadixRecordBatchSorter sorter(indices_begin_ + begin_offset,
-                                    indices_begin_ + end_offset, batch, options_);
-      ARROW_ASSIGN_OR_RAISE(sorted[i], sorter.Sort(begin_offset));
-      DCHECK_EQ(sorted[i].overall_begin(), indices_begin_ + begin_offset);
-      DCHECK_EQ(sorted[i].overall_end(), indices_begin_ + end_offset);
-      DCHECK_EQ(sorted[i].non_null_count() + sorted[i].null_count(), batch.num_rows());
-      begin_offset = end_offset;
+    for (const auto& p : sorted) {
       // XXX this is an upper bound on the true null count
-      null_count += sorted[i].null_count();
+      null_count += p.null_count();
     }
-    DCHECK_EQ(end_offset, indices_end_ - indices_begin_);
 
     // Then merge them by pairs, recursively
     if (sorted.size() > 1) {
@@ -726,8 +788,12 @@ class TableSorter {
                                         type.ToString());
         }
       };
-      Visitor visitor{this, &chunk_sorted, null_count};
-      RETURN_NOT_OK(VisitTypeInline(*sort_keys_[0].type, &visitor));
+      if (use_normalized_keys_) {
+        RETURN_NOT_OK(MergeNormalizedKeys(&chunk_sorted));
+      } else {
+        Visitor visitor{this, &chunk_sorted, null_count};
+        RETURN_NOT_OK(VisitTypeInline(*sort_keys_[0].type, &visitor));
+      }
 
       DCHECK_EQ(chunk_sorted.size(), 1);
       DCHECK_EQ(chunk_sorted[0].overall_begin(), chunked_indices_begin);
@@ -738,6 +804,54 @@ class TableSorter {
     return Status::OK();
   }
 
+  // Encode the sort keys of the given batch
+  Result<NormalizedSortKeys> MakeNormalizedKeys(int64_t batch_index) const {
+    ArrayVector physical_columns;
+    std::vector<const Array*> columns;
+    std::vector<SortOrder> orders;
+    for (const auto& sort_key : sort_keys_) {
+      physical_columns.push_back(
+          GetPhysicalArray(*sort_key.chunks[batch_index], sort_key.type));
+      columns.push_back(physical_columns.back().get());
+      orders.push_back(sort_key.order);
+    }
+    return NormalizedSortKeys::Make(columns, orders, null_placement_,
+                                    ctx_->memory_pool());
+  }
+
+  // Recursive merge routine comparing normalized keys
+  Status MergeNormalizedKeys(std::vector<ChunkedNullPartitionResult>* sorted) {
+    auto merge_nulls = [](CompressedChunkLocation*, CompressedChunkLocation*,
+                          CompressedChunkLocation*, CompressedChunkLocation*, int64_t) {
+      // All rows were sorted as non-nulls
+      DCHECK(false) << "unreachable";
+    };
+    auto merge_non_nulls =
+        [&](CompressedChunkLocation* range_begin, CompressedChunkLocation* range_middle,
+            CompressedChunkLocation* range_end, CompressedChunkLocation* temp_indices) {
+          const auto& normalized_keys = normalized_keys_;
+          parallelism_.Merge(
+              range_begin, range_middle, range_end, temp_indices,
+              [&](CompressedChunkLocation left, CompressedChunkLocation right) {
+                const auto left_key =
+                    normalized_keys[left.chunk_index()].key(
+                        static_cast<int64_t>(left.index_in_chunk()));
+                const auto right_key =
+                    normalized_keys[right.chunk_index()].key(
+                        static_cast<int64_t>(right.index_in_chunk()));
+                return left_key < right_key;
+              });
+          // Copy back temp area into main buffer
+          std::copy(temp_indices, temp_indices + (range_end - range_begin),
+                    range_begin);
+        };
+
+    ChunkedMergeImpl merge_impl(options_.null_placement, std::move(merge_nulls),
+                                std::move(merge_non_nulls));
+    RETURN_NOT_OK(merge_impl.Init(ctx_, table_.num_rows()));
+    return merge_impl.MergeAll(sorted, /*null_count=*/0, parallelism_);
+  }
+
   // Recursive merge routine, typed on the first sort key
   template <typename ArrowType>
   Status MergeInternal(std::vector<ChunkedNullPartitionResult>* sorted,
@@ -759,20 +873,7 @@ class TableSorter {
                                 std::move(merge_non_nulls));
     RETURN_NOT_OK(merge_impl.Init(ctx_, table_.num_rows()));
 
-    while (sorted->size() > 1) {
-      auto out_it = sorted->begin();
-      auto it = sorted->begin();
-      while (it < sorted->end() - 1) {
-        const auto& left = *it++;
-        const auto& right = *it++;
-        DCHECK_EQ(left.overall_end(), right.overall_begin());
-        *out_it++ = merge_impl.Merge(left, right, null_count);
-      }
-      if (it < sorted->end()) {
-        *out_it++ = *it++;
-      }
-      sorted->erase(out_it, sorted->end());
-    }
+    RETURN_NOT_OK(merge_impl.MergeAll(sorted, null_count, parallelism_));
     return comparator_.status();
   }
 
@@ -836,31 +937,32 @@ class TableSorter {
     auto& comparator = comparator_;
     const auto& first_sort_key = sort_keys_[0];
 
-    std::merge(range_begin, range_middle, range_middle, range_end, temp_indices,
-               [&](CompressedChunkLocation left, CompressedChunkLocation right) {
-                 // Both values are never null nor NaN.
-                 const auto left_loc = ChunkLocation{left};
-                 const auto right_loc = ChunkLocation{right};
-                 auto chunk_left = first_sort_key.GetChunk(left_loc);
-                 auto chunk_right = first_sort_key.GetChunk(right_loc);
-                 DCHECK(!chunk_left.IsNull());
-                 DCHECK(!chunk_right.IsNull());
-                 const auto value_left = chunk_left.Value<ArrowType>();
-                 const auto value_right = chunk_right.Value<ArrowType>();
-                 if (value_left == value_right) {
-                   // If the left value equals to the right value,
-                   // we need to compare the second and following
-                   // sort keys.
-                   return comparator.Compare(left_loc, right_loc, 1);
-                 } else {
-                   auto compared = value_left < value_right;
-                   if (first_sort_key.order == SortOrder::Ascending) {
-                     return compared;
-                   } else {
-                     return !compared;
-                   }
-                 }
-               });
+    parallelism_.Merge(
+        range_begin, range_middle, range_end, temp_indices,
+        [&](CompressedChunkLocation left, CompressedChunkLocation right) {
+          // Both values are never null nor NaN.
+          const auto left_loc = ChunkLocation{left};
+          const auto right_loc = ChunkLocation{right};
+          auto chunk_left = first_sort_key.GetChunk(left_loc);
+          auto chunk_right = first_sort_key.GetChunk(right_loc);
+          DCHECK(!chunk_left.IsNull());
+          DCHECK(!chunk_right.IsNull());
+          const auto value_left = chunk_left.Value<ArrowType>();
+          const auto value_right = chunk_right.Value<ArrowType>();
+          if (value_left == value_right) {
+            // If the left value equals to the right value,
+            // we need to compare the second and following
+            // sort keys.
+            return comparator.Compare(left_loc, right_loc, 1);
+          } else {
+            auto compared = value_left < value_right;
+            if (first_sort_key.order == SortOrder::Ascending) {
+              return compared;
+            } else {
+              return !compared;
+            }
+          }
+        });
 
     // Copy back temp area into main buffer
     std::copy(temp_indices, temp_indices + (range_end - range_begin), range_begin);
@@ -877,6 +979,7 @@ class TableSorter {
 
   Status status_;
   ExecContext* ctx_;
+  const SortParallelism parallelism_;
   const Table& table_;
   const RecordBatchVector batches_;
   const SortOptions& options_;
@@ -885,6 +988,9 @@ class TableSorter {
   uint64_t* indices_begin_;
   uint64_t* indices_end_;
   Comparator comparator_;
+  const bool use_normalized_keys_;
+  // The normalized keys of each batch, if use_normalized_keys_
+  std::vector<NormalizedSortKeys> normalized_keys_;
 };
 
 // ----------------------------------------------------------------------
@@ -1027,6 +1133,10 @@ class SortIndicesMetaFunction : public MetaFunction {
     if (n_sort_keys <= kMaxRadixSortKeys) {
       RadixRecordBatchSorter sorter(out_begin, out_end, std::move(sort_keys), options);
       ARROW_RETURN_NOT_OK(sorter.Sort());
+    } else if (UseNormalizedSortKeys(sort_keys)) {
+      ARROW_RETURN_NOT_OK(SortOnNormalizedKeys(out_begin, out_end, sort_keys,
+                                               options.null_placement,
+                                               ctx->memory_pool()));
     } else {
       MultipleKeyRecordBatchSorter sorter(out_begin, out_end, std::move(sort_keys),
                                           options);
@@ -27,6 +27,7 @@
 #include "arrow/testing/random.h"
 #include "arrow/util/benchmark_util.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 namespace compute {
@@ -442,6 +443,56 @@ static void TableSortIndicesInt64Wide(benchmark::State& state) {
                         std::numeric_limits<int64_t>::max());
 }
 
+//
+// Parallel sort benchmark helpers
+//
+
+// Sort with a dedicated thread pool of `num_threads` threads, a single thread
+// meaning a serial sort, to get scaling curves.
+static void ThreadedSortIndicesBenchmark(benchmark::State& state, const Datum& datum,
+                                         const SortOptions& options,
+                                         int64_t num_threads) {
+  ASSIGN_OR_ABORT(auto thread_pool,
+                  ::arrow::internal::ThreadPool::Make(static_cast<int>(num_threads)));
+  ExecContext ctx(default_memory_pool(), thread_pool.get());
+  ctx.set_use_threads(num_threads > 1);
+  for (auto _ : state) {
+    ABORT_NOT_OK(SortIndices(datum, options, &ctx).status());
+  }
+  state.counters["threads"] = static_cast<double>(num_threads);
+}
+
+static void ChunkedArraySortIndicesInt64Threads(benchmark::State& state) {
+  const int64_t num_records = state.range(0);
+  const int64_t num_chunks = state.range(1);
+  const int64_t num_threads = state.range(2);
+
+  auto rand = random::RandomArrayGenerator(kSeed);
+  ArrayVector chunks;
+  for (int64_t i = 0; i < num_chunks; ++i) {
+    chunks.push_back(rand.Int64(num_records / num_chunks,
+                                std::numeric_limits<int64_t>::min(),
+                                std::numeric_limits<int64_t>::max(),
+                                /*null_probability=*/0.01));
+  }
+  auto chunked_array = std::make_shared<ChunkedArray>(chunks);
+
+  ThreadedSortIndicesBenchmark(state, Datum(chunked_array), SortOptions::Defaults(),
+                               num_threads);
+  state.SetItemsProcessed(state.iterations() * chunked_array->length());
+}
+
+static void TableSortIndicesInt64Threads(benchmark::State& state) {
+  TableSortIndicesArgs args(state);
+  const int64_t num_threads = state.range(4);
+
+  auto data = MakeBatchOrTableBenchmarkDataInt64(args, args.num_chunks, -1000, 1000);
+  auto table = Table::Make(data.schema, data.columns, args.num_records);
+
+  ThreadedSortIndicesBenchmark(state, Datum(*table), SortOptions(data.sort_keys),
+                               num_threads);
+}
+
 //
 // Sort benchmark declarations
 //
@@ -500,6 +551,26 @@ BENCHMARK(TableSortIndicesInt64Wide)
     })
     ->Unit(benchmark::TimeUnit::kNanosecond);
 
+BENCHMARK(ChunkedArraySortIndicesInt64Threads)
+    ->ArgsProduct({
+        {1 << 24},         // the number of records
+        {16, 64},          // the number of chunks
+        {1, 2, 4, 8, 16},  // the number of threads
+    })
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->UseRealTime();
+
+BENCHMARK(TableSortIndicesInt64Threads)
+    ->ArgsProduct({
+        {1 << 22},         // the number of records
+        {100},             // inverse null proportion
+        {2},               // the number of columns
+        {16},              // the number of chunks
+        {1, 2, 4, 8, 16},  // the number of threads
+    })
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->UseRealTime();
+
 //
 // Rank benchmark declarations
 //
@@ -21,13 +21,18 @@
 #include <cmath>
 #include <cstdint>
 #include <functional>
+#include <vector>
 
 #include "arrow/array.h"
 #include "arrow/compute/api_vector.h"
+#include "arrow/compute/exec.h"
 #include "arrow/compute/kernels/chunked_internal.h"
 #include "arrow/table.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/future.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow::compute::internal {
 
@@ -340,6 +345,124 @@ NullPartitionResult PartitionNulls(uint64_t* indices_begin, uint64_t* indices_en
                              std::max(q.nulls_end, p.nulls_end)};
 }
 
+// ----------------------------------------------------------------------
+// Helpers for spreading sorting work over an executor
+
+// Minimum number of indices merged by each task of a parallel merge
+constexpr int64_t kMinParallelMergeLength = 1 << 16;
+
+// Describes whether sorting work may be split into tasks running concurrently
+// on the executor of an ExecContext.
+//
+// Tasks are never spawned from a thread owned by the executor (for example
+// when a sort is run from a task of that same executor), since blocking on
+// sub-tasks there could exhaust the thread pool.
+class SortParallelism {
+ public:
+  SortParallelism() = default;
+
+  static SortParallelism Make(ExecContext* ctx) {
+    SortParallelism parallelism;
+    if (ctx->use_threads() && ctx->executor() != nullptr) {
+      parallelism.executor_ = ctx->executor();
+      parallelism.num_threads_ = std::max(1, parallelism.executor_->GetCapacity());
+    }
+    return parallelism;
+  }
+
+  int num_threads() const { return num_threads_; }
+
+  bool enabled() const { return num_threads_ > 1; }
+
+  // Call `func(i)` for i in [0, num_tasks), concurrently if possible.
+  template <typename Function>
+  Status For(int num_tasks, Function&& func) const {
+    return ::arrow::internal::OptionalParallelFor(CanSpawn(num_tasks), num_tasks,
+                                                  std::forward<Function>(func),
+                                                  executor_);
+  }
+
+  // Merge the adjacent sorted ranges [begin, middle) and [middle, end) into `out`,
+  // with the same (stable) result as std::merge.
+  //
+  // If the ranges are large enough, the output is split into pieces whose input
+  // boundaries are located by binary search, and the pieces are merged concurrently.
+  template <typename IndexType, typename Compare>
+  void Merge(IndexType* begin, IndexType* middle, IndexType* end, IndexType* out,
+             Compare&& comp) const {
+    const int64_t length = end - begin;
+    const int num_pieces = static_cast<int>(std::min<int64_t>(
+        num_threads_, std::max<int64_t>(1, length / kMinParallelMergeLength)));
+    if (!CanSpawn(num_pieces)) {
+      std::merge(begin, middle, middle, end, out, comp);
+      return;
+    }
+    // Locate the input boundaries of each output piece
+    std::vector<int64_t> left_splits(num_pieces + 1);
+    left_splits[0] = 0;
+    left_splits[num_pieces] = middle - begin;
+    for (int i = 1; i < num_pieces; ++i) {
+      left_splits[i] = MergeSplit(begin, middle, end, length * i / num_pieces, comp);
+    }
+    auto merge_piece = [&](int i) {
+      const int64_t out_begin = length * i / num_pieces;
+      const int64_t out_end = length * (i + 1) / num_pieces;
+      IndexType* left_begin = begin + left_splits[i];
+      IndexType* left_end = begin + left_splits[i + 1];
+      IndexType* right_begin = middle + (out_begin - left_splits[i]);
+      IndexType* right_end = middle + (out_end - left_splits[i + 1]);
+      std::merge(left_begin, left_end, right_begin, right_end, out + out_begin, comp);
+    };
+    // The calling thread merges the first piece; if a piece cannot be submitted,
+    // it is merged inline as well.
+    std::vector<Future<>> futures;
+    futures.reserve(num_pieces - 1);
+    for (int i = 1; i < num_pieces; ++i) {
+      auto maybe_future = executor_->Submit(merge_piece, i);
+      if (maybe_future.ok()) {
+        futures.push_back(*std::move(maybe_future));
+      } else {
+        merge_piece(i);
+      }
+    }
+    merge_piece(0);
+    for (const auto& future : futures) {
+      future.Wait();
+    }
+  }
+
+ private:
+  bool CanSpawn(int num_tasks) const {
+    return num_threads_ > 1 && num_tasks > 1 && !executor_->OwnsThisThread();
+  }
+
+  // Return the number of elements of [begin, middle) among the first
+  // `out_position` elements of the merge of [begin, middle) and [middle, end).
+  template <typename IndexType, typename Compare>
+  static int64_t MergeSplit(IndexType* begin, IndexType* middle, IndexType* end,
+                            int64_t out_position, Compare& comp) {
+    const int64_t left_length = middle - begin;
+    const int64_t right_length = end - middle;
+    // Find the smallest `i` such that the element taken just before left[i]
+    // from the right range (if any) is ordered before left[i].
+    int64_t lo = std::max<int64_t>(0, out_position - right_length);
+    int64_t hi = std::min(out_position, left_length);
+    while (lo < hi) {
+      const int64_t i = lo + (hi - lo) / 2;
+      const int64_t j = out_position - i;
+      if (comp(middle[j - 1], begin[i])) {
+        hi = i;
+      } else {
+        lo = i + 1;
+      }
+    }
+    return lo;
+  }
+
+  ::arrow::internal::Executor* executor_ = nullptr;
+  int num_threads_ = 1;
+};
+
 template <typename IndexType, typename NullPartitionResultType>
 struct GenericMergeImpl {
   using MergeNullsFunc = std::function<void(IndexType* nulls_begin,
@@ -361,22 +484,72 @@ struct GenericMergeImpl {
         temp_buffer_,
         AllocateBuffer(sizeof(IndexType) * temp_indices_length, ctx->memory_pool()));
     temp_indices_ = reinterpret_cast<IndexType*>(temp_buffer_->mutable_data());
+    temp_indices_length_ = temp_indices_length;
     return Status::OK();
   }
 
   NullPartitionResultType Merge(const NullPartitionResultType& left,
                                 const NullPartitionResultType& right,
                                 int64_t null_count) const {
+    return Merge(left, right, null_count, temp_indices_);
+  }
+
+  NullPartitionResultType Merge(const NullPartitionResultType& left,
+                                const NullPartitionResultType& right,
+                                int64_t null_count, IndexType* temp_indices) const {
     if (null_placement_ == NullPlacement::AtStart) {
-      return MergeNullsAtStart(left, right, null_count);
+      return MergeNullsAtStart(left, right, null_count, temp_indices);
     } else {
-      return MergeNullsAtEnd(left, right, null_count);
+      return MergeNullsAtEnd(left, right, null_count, temp_indices);
     }
   }
 
+  // Merge adjacent sorted partitions by pairs, recursively, until only one remains.
+  //
+  // If the temporary area spans all partitions, the pairs at each level are merged
+  // concurrently (as allowed by `parallelism`), each using the slice of the
+  // temporary area that matches its position.
+  Status MergeAll(std::vector<NullPartitionResultType>* sorted, int64_t null_count,
+                  const SortParallelism& parallelism) const {
+    if (sorted->empty()) {
+      return Status::OK();
+    }
+    IndexType* const overall_begin = sorted->front().overall_begin();
+    const bool disjoint_temp_areas =
+        temp_indices_length_ >= sorted->back().overall_end() - overall_begin;
+
+    while (sorted->size() > 1) {
+      const int num_pairs = static_cast<int>(sorted->size() / 2);
+      std::vector<NullPartitionResultType> merged(num_pairs);
+      auto merge_pair = [&](int i) {
+        const auto& left = (*sorted)[2 * i];
+        const auto& right = (*sorted)[2 * i + 1];
+        DCHECK_EQ(left.overall_end(), right.overall_begin());
+        IndexType* temp_indices =
+            disjoint_temp_areas ? temp_indices_ + (left.overall_begin() - overall_begin)
+                                : temp_indices_;
+        merged[i] = Merge(left, right, null_count, temp_indices);
+        return Status::OK();
+      };
+      if (disjoint_temp_areas) {
+        RETURN_NOT_OK(parallelism.For(num_pairs, merge_pair));
+      } else {
+        for (int i = 0; i < num_pairs; ++i) {
+          RETURN_NOT_OK(merge_pair(i));
+        }
+      }
+      if (sorted->size() % 2 != 0) {
+        merged.push_back(sorted->back());
+      }
+      *sorted = std::move(merged);
+    }
+    return Status::OK();
+  }
+
   NullPartitionResultType MergeNullsAtStart(const NullPartitionResultType& left,
                                             const NullPartitionResultType& right,
-                                            int64_t null_count) const {
+                                            int64_t null_count,
+                                            IndexType* temp_indices) const {
     // Input layout:
     // [left nulls .... left non-nulls .... right nulls .... right non-nulls]
     DCHECK_EQ(left.nulls_end, left.non_nulls_begin);
@@ -396,7 +569,7 @@ struct GenericMergeImpl {
     // null-like values (e.g. NaN) are ordered equally.
     if (p.null_count()) {
       merge_nulls_(p.nulls_begin, p.nulls_begin + left.null_count(), p.nulls_end,
-                   temp_indices_, null_count);
+                   temp_indices, null_count);
     }
 
     // Merge the non-null values into temp area
@@ -404,14 +577,15 @@ struct GenericMergeImpl {
     DCHECK_EQ(p.non_nulls_end - right.non_nulls_begin, right.non_null_count());
     if (p.non_null_count()) {
       merge_non_nulls_(p.non_nulls_begin, right.non_nulls_begin, p.non_nulls_end,
-                       temp_indices_);
+                       temp_indices);
     }
     return p;
   }
 
   NullPartitionResultType MergeNullsAtEnd(const NullPartitionResultType& left,
                                           const NullPartitionResultType& right,
-                                          int64_t null_count) const {
+                                          int64_t null_count,
+                                          IndexType* temp_indices) const {
     // Input layout:
     // [left non-nulls .... left nulls .... right non-nulls .... right nulls]
     DCHECK_EQ(left.non_nulls_end, left.nulls_begin);
@@ -431,7 +605,7 @@ struct GenericMergeImpl {
     // null-like values (e.g. NaN) are ordered equally.
     if (p.null_count()) {
       merge_nulls_(p.nulls_begin, p.nulls_begin + left.null_count(), p.nulls_end,
-                   temp_indices_, null_count);
+                   temp_indices, null_count);
     }
 
     // Merge the non-null values into temp area
@@ -439,7 +613,7 @@ struct GenericMergeImpl {
     DCHECK_EQ(p.non_nulls_end - left.non_nulls_end, right.non_null_count());
     if (p.non_null_count()) {
       merge_non_nulls_(p.non_nulls_begin, left.non_nulls_end, p.non_nulls_end,
-                       temp_indices_);
+                       temp_indices);
     }
     return p;
   }
@@ -450,6 +624,7 @@ struct GenericMergeImpl {
   MergeNonNullsFunc merge_non_nulls_;
   std::unique_ptr<Buffer> temp_buffer_;
   IndexType* temp_indices_ = nullptr;
+  int64_t temp_indices_length_ = 0;
 };
 
 using MergeImpl = GenericMergeImpl<uint64_t, NullPartitionResult>;
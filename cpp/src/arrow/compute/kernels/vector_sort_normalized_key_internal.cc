@@ -0,0 +1,394 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/vector_sort_normalized_key_internal.h"
+
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+#include <vector>
+
+#include "arrow/array/array_base.h"
+#include "arrow/array/array_binary.h"
+#include "arrow/array/array_primitive.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/endian.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/ubsan.h"
+#include "arrow/visit_type_inline.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute::internal {
+
+namespace {
+
+// Marker bytes ordering nulls, NaNs and other values
+struct Markers {
+  explicit Markers(NullPlacement null_placement)
+      : null(null_placement == NullPlacement::AtStart ? 0 : 2),
+        nan(1),
+        value(null_placement == NullPlacement::AtStart ? 2 : 0) {}
+
+  uint8_t null;
+  uint8_t nan;
+  uint8_t value;
+};
+
+template <typename UInt>
+void StoreBigEndian(UInt value, uint8_t* out) {
+  value = bit_util::ToBigEndian(value);
+  std::memcpy(out, &value, sizeof(value));
+}
+
+void InvertBytes(uint8_t* data, int64_t length) {
+  for (int64_t i = 0; i < length; ++i) {
+    data[i] = static_cast<uint8_t>(~data[i]);
+  }
+}
+
+// Number of bytes encoding a value of the given physical type, not including
+// the marker byte, or -1 for variable-width types.
+Result<int64_t> ValueWidth(const DataType& type) {
+  switch (type.id()) {
+    case Type::NA:
+      return 0;
+    case Type::BOOL:
+      return 1;
+    case Type::INT8:
+    case Type::INT16:
+    case Type::INT32:
+    case Type::INT64:
+    case Type::UINT8:
+    case Type::UINT16:
+    case Type::UINT32:
+    case Type::UINT64:
+    case Type::FLOAT:
+    case Type::DOUBLE:
+    case Type::FIXED_SIZE_BINARY:
+    case Type::DECIMAL128:
+    case Type::DECIMAL256:
+      return type.byte_width();
+    case Type::BINARY:
+    case Type::LARGE_BINARY:
+      return -1;
+    default:
+      return Status::NotImplemented("Cannot normalize sort keys of type ",
+                                    type.ToString());
+  }
+}
+
+// Add the length of the encoded values of a binary column to `lengths`
+template <typename ArrayType>
+void AddEncodedBinaryLengths(const ArrayType& array, int64_t* lengths) {
+  const bool may_have_nulls = array.null_count() > 0;
+  for (int64_t i = 0; i < array.length(); ++i) {
+    if (may_have_nulls && array.IsNull(i)) {
+      continue;
+    }
+    const std::string_view value = array.GetView(i);
+    // Escaped zero bytes and the terminator
+    lengths[i] += static_cast<int64_t>(value.size()) +
+                  std::count(value.begin(), value.end(), '\0') + 2;
+  }
+}
+
+// Encode one sort key of all rows, at the current write position of each row.
+class ColumnEncoder {
+ public:
+  ColumnEncoder(const Array& array, SortOrder order, NullPlacement null_placement,
+                uint8_t* data, int64_t* positions)
+      : array_(array),
+        descending_(order == SortOrder::Descending),
+        markers_(null_placement),
+        data_(data),
+        positions_(positions) {}
+
+  Status Encode() { return VisitTypeInline(*array_.type(), this); }
+
+  Status Visit(const NullType&) {
+    for (int64_t i = 0; i < array_.length(); ++i) {
+      data_[positions_[i]++] = markers_.null;
+    }
+    return Status::OK();
+  }
+
+  Status Visit(const BooleanType&) {
+    const auto& array = checked_cast<const BooleanArray&>(array_);
+    EncodeFixed(1, [&](int64_t i, uint8_t* out) { *out = array.Value(i) ? 1 : 0; });
+    return Status::OK();
+  }
+
+  template <typename Type>
+  enable_if_integer<Type, Status> Visit(const Type&) {
+    using CType = typename Type::c_type;
+    using UnsignedCType = std::make_unsigned_t<CType>;
+    const auto* values = array_.data()->GetValues<CType>(1);
+    EncodeFixed(sizeof(CType), [&](int64_t i, uint8_t* out) {
+      auto bits = static_cast<UnsignedCType>(values[i]);
+      if constexpr (std::is_signed_v<CType>) {
+        bits ^= static_cast<UnsignedCType>(UnsignedCType{1} << (8 * sizeof(CType) - 1));
+      }
+      StoreBigEndian(bits, out);
+    });
+    return Status::OK();
+  }
+
+  Status Visit(const FloatType&) { return EncodeFloating<FloatType, uint32_t>(); }
+
+  Status Visit(const DoubleType&) { return EncodeFloating<DoubleType, uint64_t>(); }
+
+  Status Visit(const FixedSizeBinaryType& type) {
+    const auto& array = checked_cast<const FixedSizeBinaryArray&>(array_);
+    const int32_t width = type.byte_width();
+    EncodeFixed(width, [&](int64_t i, uint8_t* out) {
+      std::memcpy(out, array.GetValue(i), width);
+    });
+    return Status::OK();
+  }
+
+  Status Visit(const Decimal128Type& type) { return EncodeDecimal(type.byte_width()); }
+
+  Status Visit(const Decimal256Type& type) { return EncodeDecimal(type.byte_width()); }
+
+  template <typename Type>
+  enable_if_base_binary<Type, Status> Visit(const Type&) {
+    using ArrayType = typename TypeTraits<Type>::ArrayType;
+    const auto& array = checked_cast<const ArrayType&>(array_);
+    const bool may_have_nulls = array.null_count() > 0;
+    for (int64_t i = 0; i < array.length(); ++i) {
+      uint8_t* out = data_ + positions_[i];
+      if (may_have_nulls && array.IsNull(i)) {
+        *out = markers_.null;
+        ++positions_[i];
+        continue;
+      }
+      *out = markers_.value;
+      uint8_t* value_begin = out + 1;
+      uint8_t* value_end = value_begin;
+      for (const char c : array.GetView(i)) {
+        *value_end++ = static_cast<uint8_t>(c);
+        if (c == '\0') {
+          *value_end++ = 0xFF;
+        }
+      }
+      *value_end++ = 0;
+      *value_end++ = 0;
+      if (descending_) {
+        InvertBytes(value_begin, value_end - value_begin);
+      }
+      positions_[i] += value_end - out;
+    }
+    return Status::OK();
+  }
+
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("Cannot normalize sort keys of type ",
+                                  type.ToString());
+  }
+
+ private:
+  template <typename EncodeValue>
+  void EncodeFixed(int64_t width, EncodeValue&& encode_value) {
+    EncodeFixed(width, std::forward<EncodeValue>(encode_value),
+                [](int64_t) { return false; });
+  }
+
+  template <typename EncodeValue, typename IsNullLike>
+  void EncodeFixed(int64_t width, EncodeValue&& encode_value,
+                   IsNullLike&& is_null_like) {
+    const bool may_have_nulls = array_.null_count() > 0;
+    for (int64_t i = 0; i < array_.length(); ++i) {
+      uint8_t* out = data_ + positions_[i];
+      positions_[i] += 1 + width;
+      if (may_have_nulls && array_.IsNull(i)) {
+        out[0] = markers_.null;
+        std::memset(out + 1, 0, width);
+      } else if (is_null_like(i)) {
+        out[0] = markers_.nan;
+        std::memset(out + 1, 0, width);
+      } else {
+        out[0] = markers_.value;
+        encode_value(i, out + 1);
+        if (descending_) {
+          InvertBytes(out + 1, width);
+        }
+      }
+    }
+  }
+
+  template <typename Type, typename UInt>
+  Status EncodeFloating() {
+    using CType = typename Type::c_type;
+    static_assert(sizeof(CType) == sizeof(UInt));
+    constexpr UInt kSignBit = UInt{1} << (8 * sizeof(UInt) - 1);
+
+    const auto* values = array_.data()->GetValues<CType>(1);
+    EncodeFixed(
+        sizeof(CType),
+        [&](int64_t i, uint8_t* out) {
+          CType value = values[i];
+          if (value == 0) {
+            // Encode -0.0 as 0.0
+            value = 0;
+          }
+          auto bits = util::SafeCopy<UInt>(value);
+          bits = (bits & kSignBit) ? static_cast<UInt>(~bits) : (bits | kSignBit);
+          StoreBigEndian(bits, out);
+        },
+        [&](int64_t i) { return std::isnan(values[i]); });
+    return Status::OK();
+  }
+
+  Status EncodeDecimal(int32_t width) {
+    const auto& array = checked_cast<const FixedSizeBinaryArray&>(array_);
+    EncodeFixed(width, [&](int64_t i, uint8_t* out) {
+      // Decimals are two's complement integers in native endianness
+      const uint8_t* value = array.GetValue(i);
+#if ARROW_LITTLE_ENDIAN
+      std::reverse_copy(value, value + width, out);
+#else
+      std::copy(value, value + width, out);
+#endif
+      out[0] ^= 0x80;
+    });
+    return Status::OK();
+  }
+
+  const Array& array_;
+  const bool descending_;
+  const Markers markers_;
+  uint8_t* data_;
+  int64_t* positions_;
+};
+
+uint64_t KeyPrefix(std::string_view key) {
+  uint64_t prefix = 0;
+  std::memcpy(&prefix, key.data(), std::min<size_t>(sizeof(prefix), key.size()));
+  return bit_util::FromBigEndian(prefix);
+}
+
+}  // namespace
+
+bool NormalizedSortKeys::CanNormalize(const DataType& physical_type) {
+  return ValueWidth(physical_type).ok();
+}
+
+Result<NormalizedSortKeys> NormalizedSortKeys::Make(
+    util::span<const Array* const> columns, util::span<const SortOrder> orders,
+    NullPlacement null_placement, MemoryPool* pool) {
+  DCHECK_EQ(columns.size(), orders.size());
+  NormalizedSortKeys keys;
+  keys.num_rows_ = columns.empty() ? 0 : columns[0]->length();
+  const int64_t num_rows = keys.num_rows_;
+
+  // The width of fixed-width values and of all marker bytes
+  int64_t fixed_width = 0;
+  bool all_fixed_width = true;
+  for (const Array* column : columns) {
+    DCHECK_EQ(column->length(), num_rows);
+    ARROW_ASSIGN_OR_RAISE(const int64_t value_width, ValueWidth(*column->type()));
+    if (value_width < 0) {
+      all_fixed_width = false;
+      fixed_width += 1;
+    } else {
+      fixed_width += 1 + value_width;
+    }
+  }
+
+  // The current write position of each row
+  std::vector<int64_t> positions(num_rows);
+  int64_t data_size;
+  if (all_fixed_width) {
+    keys.fixed_width_ = fixed_width;
+    for (int64_t i = 0; i < num_rows; ++i) {
+      positions[i] = i * fixed_width;
+    }
+    data_size = num_rows * fixed_width;
+  } else {
+    std::fill(positions.begin(), positions.end(), fixed_width);
+    for (const Array* column : columns) {
+      if (column->type_id() == Type::BINARY) {
+        AddEncodedBinaryLengths(checked_cast<const BinaryArray&>(*column),
+                                positions.data());
+      } else if (column->type_id() == Type::LARGE_BINARY) {
+        AddEncodedBinaryLengths(checked_cast<const LargeBinaryArray&>(*column),
+                                positions.data());
+      }
+    }
+    ARROW_ASSIGN_OR_RAISE(keys.offsets_,
+                          AllocateBuffer((num_rows + 1) * sizeof(int64_t), pool));
+    auto* offsets = keys.offsets_->mutable_data_as<int64_t>();
+    int64_t offset = 0;
+    for (int64_t i = 0; i < num_rows; ++i) {
+      offsets[i] = offset;
+      offset += positions[i];
+      positions[i] = offsets[i];
+    }
+    offsets[num_rows] = offset;
+    data_size = offset;
+  }
+
+  ARROW_ASSIGN_OR_RAISE(keys.data_, AllocateBuffer(data_size, pool));
+  for (size_t i = 0; i < columns.size(); ++i) {
+    ColumnEncoder encoder(*columns[i], orders[i], null_placement,
+                          keys.data_->mutable_data(), positions.data());
+    RETURN_NOT_OK(encoder.Encode());
+  }
+  return keys;
+}
+
+void NormalizedSortKeys::SortIndices(uint64_t* indices_begin, uint64_t* indices_end,
+                                     int64_t offset) const {
+  // Sort (key prefix, index) entries, so that most comparisons are decided
+  // without indirection.
+  struct Entry {
+    uint64_t prefix;
+    uint64_t index;
+  };
+  std::vector<Entry> entries(indices_end - indices_begin);
+  for (size_t i = 0; i < entries.size(); ++i) {
+    const uint64_t index = indices_begin[i];
+    entries[i] = {KeyPrefix(key(static_cast<int64_t>(index) - offset)), index};
+  }
+
+  const bool prefix_is_key =
+      fixed_width_ >= 0 && fixed_width_ <= static_cast<int64_t>(sizeof(uint64_t));
+  std::sort(entries.begin(), entries.end(), [&](const Entry& left, const Entry& right) {
+    if (left.prefix != right.prefix) {
+      return left.prefix < right.prefix;
+    }
+    if (!prefix_is_key) {
+      const int compared = Compare(static_cast<int64_t>(left.index) - offset,
+                                   static_cast<int64_t>(right.index) - offset);
+      if (compared != 0) {
+        return compared < 0;
+      }
+    }
+    return left.index < right.index;
+  });
+
+  for (size_t i = 0; i < entries.size(); ++i) {
+    indices_begin[i] = entries[i].index;
+  }
+}
+
+}  // namespace compute::internal
+}  // namespace arrow
@@ -0,0 +1,105 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string_view>
+
+#include "arrow/buffer.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/result.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/span.h"
+
+namespace arrow::compute::internal {
+
+// Normalized sort keys for a set of rows.
+//
+// The values of all sort keys of a row are encoded into a single byte string,
+// such that comparing the byte strings of two rows lexicographically (as with
+// memcmp(), a proper prefix ordering first) orders them like comparing their
+// sort keys one after another would.  Multi-key sorts can then compare rows
+// without dispatching on the type of each sort key.
+//
+// Each sort key contributes a marker byte, which orders nulls, NaNs and other
+// values according to the null placement, followed by an order-preserving
+// encoding of the value (omitted for nulls and NaNs of variable-width types,
+// zero-filled for those of fixed-width types):
+// - booleans and integers are stored big-endian, with the sign bit flipped for
+//   signed integers and decimals;
+// - floating-point values are stored as their big-endian bit pattern, with all bits
+//   flipped for negative values and only the sign bit flipped otherwise (-0.0
+//   is encoded as 0.0, since both compare equal);
+// - binary values have their 0x00 bytes escaped as 0x00 0xFF and are terminated
+//   by 0x00 0x00, which makes the encoding prefix-free;
+// - fixed-size binary values are stored as-is.
+// Value bytes (but not marker bytes) are inverted for descending sort keys.
+class NormalizedSortKeys {
+ public:
+  NormalizedSortKeys() = default;
+
+  // Whether sort keys of the given physical type can be normalized
+  static bool CanNormalize(const DataType& physical_type);
+
+  // Encode the rows of `columns`, the physical arrays of the sort keys in order of
+  // precedence.  All columns must have the same length.
+  static Result<NormalizedSortKeys> Make(util::span<const Array* const> columns,
+                                         util::span<const SortOrder> orders,
+                                         NullPlacement null_placement,
+                                         MemoryPool* pool);
+
+  int64_t num_rows() const { return num_rows_; }
+
+  std::string_view key(int64_t row) const {
+    if (fixed_width_ >= 0) {
+      return {reinterpret_cast<const char*>(data_->data()) + row * fixed_width_,
+              static_cast<size_t>(fixed_width_)};
+    }
+    const auto* offsets = offsets_->data_as<int64_t>();
+    return {reinterpret_cast<const char*>(data_->data()) + offsets[row],
+            static_cast<size_t>(offsets[row + 1] - offsets[row])};
+  }
+
+  // Three-way comparison of the keys of two rows
+  int Compare(int64_t left_row, int64_t right_row) const {
+    if (fixed_width_ >= 0) {
+      return std::memcmp(data_->data() + left_row * fixed_width_,
+                         data_->data() + right_row * fixed_width_,
+                         static_cast<size_t>(fixed_width_));
+    }
+    return key(left_row).compare(key(right_row));
+  }
+
+  // Sort the indices in [indices_begin, indices_end) by the keys of rows
+  // (index - offset).  Indices with equal keys are ordered by increasing value,
+  // so the sort is stable if the indices were initially in increasing order.
+  void SortIndices(uint64_t* indices_begin, uint64_t* indices_end,
+                   int64_t offset) const;
+
+ private:
+  int64_t num_rows_ = 0;
+  // Width of all keys, or -1 if keys have variable width
+  int64_t fixed_width_ = -1;
+  std::shared_ptr<Buffer> data_;
+  // num_rows_ + 1 offsets into data_, if keys have variable width
+  std::shared_ptr<Buffer> offsets_;
+};
+
+}  // namespace arrow::compute::internal
@@ -28,9 +28,11 @@
 
 #include "arrow/array/array_decimal.h"
 #include "arrow/array/concatenate.h"
+#include "arrow/array/util.h"
 #include "arrow/compute/api_vector.h"
 #include "arrow/compute/kernels/test_util_internal.h"
 #include "arrow/result.h"
+#include "arrow/scalar.h"
 #include "arrow/table.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
@@ -1186,6 +1188,65 @@ class TestChunkedArrayRandomNarrow : public TestChunkedArrayRandomBase<Type> {
 TYPED_TEST_SUITE(TestChunkedArrayRandomNarrow, IntegralArrowTypes);
 TYPED_TEST(TestChunkedArrayRandomNarrow, SortIndices) { this->TestSortIndices(1000); }
 
+// Chunked arrays and tables large enough that merges are split into concurrent
+// pieces: the result should be the same as the result of a serial sort.
+class TestParallelSortIndices : public ::testing::Test {
+ protected:
+  void SetUp() override { serial_ctx_.set_use_threads(false); }
+
+  ExecContext serial_ctx_;
+};
+
+TEST_F(TestParallelSortIndices, ChunkedArray) {
+  ::arrow::random::RandomArrayGenerator rng(/*seed=*/0x5487658);
+  ArrayVector chunks;
+  for (int64_t length : {100000, 1, 150000, 0, 70000, 20000}) {
+    chunks.push_back(rng.Float64(length, -100.0, 100.0, /*null_probability=*/0.1,
+                                 /*nan_probability=*/0.05));
+  }
+  ASSERT_OK_AND_ASSIGN(auto chunked_array, ChunkedArray::Make(chunks));
+  ASSERT_OK_AND_ASSIGN(auto concatenated_array, Concatenate(chunks));
+
+  for (auto order : AllOrders()) {
+    for (auto null_placement : AllNullPlacements()) {
+      ArraySortOptions options(order, null_placement);
+      ASSERT_OK_AND_ASSIGN(auto expected,
+                           SortIndices(*chunked_array, options, &serial_ctx_));
+      ASSERT_OK_AND_ASSIGN(auto actual, SortIndices(*chunked_array, options));
+      ValidateOutput(*actual);
+      ValidateSorted<DoubleArray>(*checked_pointer_cast<DoubleArray>(concatenated_array),
+                                  *checked_pointer_cast<UInt64Array>(actual), order,
+                                  null_placement);
+      AssertArraysEqual(*expected, *actual, /*verbose=*/true);
+    }
+  }
+}
+
+TEST_F(TestParallelSortIndices, Table) {
+  ::arrow::random::RandomArrayGenerator rng(/*seed=*/0x5487659);
+  auto schema = ::arrow::schema({field("a", int32()), field("b", utf8())});
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  for (int64_t length : {90000, 0, 120000, 5, 60000}) {
+    batches.push_back(RecordBatch::Make(
+        schema, length,
+        {rng.Int32(length, -500, 500, /*null_probability=*/0.1),
+         rng.String(length, 0, 3, /*null_probability=*/0.1)}));
+  }
+  ASSERT_OK_AND_ASSIGN(auto table, Table::FromRecordBatches(schema, batches));
+
+  for (auto order : AllOrders()) {
+    for (auto null_placement : AllNullPlacements()) {
+      SortOptions options({SortKey("a", order), SortKey("b", SortOrder::Descending)},
+                          null_placement);
+      ASSERT_OK_AND_ASSIGN(auto expected, SortIndices(Datum(table), options,
+                                                      &serial_ctx_));
+      ASSERT_OK_AND_ASSIGN(auto actual, SortIndices(Datum(table), options));
+      ValidateOutput(*actual);
+      AssertArraysEqual(*expected, *actual, /*verbose=*/true);
+    }
+  }
+}
+
 // Test basic cases for record batch.
 class TestRecordBatchSortIndices : public ::testing::Test {};
 
@@ -1353,6 +1414,42 @@ TEST_F(TestRecordBatchSortIndices, Decimal) {
   AssertSortIndices(batch, options, "[3, 4, 0, 2, 1]");
 }
 
+TEST_F(TestRecordBatchSortIndices, ManySortKeys) {
+  auto schema = ::arrow::schema({
+      {field("dec", decimal128(5, 2))},
+      {field("bin", binary())},
+      {field("i", int32())},
+  });
+  auto batch = RecordBatchFromJSON(schema,
+                                   R"([{"dec": "1.50",  "bin": "ab",      "i": 0},
+                                       {"dec": "-2.00", "bin": "a",       "i": 1},
+                                       {"dec": null,    "bin": "b",       "i": 2},
+                                       {"dec": "1.50",  "bin": "abc",     "i": 3},
+                                       {"dec": "1.50",  "bin": null,      "i": 4},
+                                       {"dec": "-2.00", "bin": "a\u0000", "i": 5},
+                                       {"dec": "10.00", "bin": "",        "i": 6},
+                                       {"dec": "1.50",  "bin": "ab",      "i": null}
+                                       ])");
+  // Leading sort keys on which all rows tie, so that there are more sort keys than
+  // the radix sorter handles and rows are compared on normalized keys
+  std::vector<SortKey> sort_keys;
+  for (int i = 0; i < 7; ++i) {
+    const std::string name = "tie" + std::to_string(i);
+    ASSERT_OK_AND_ASSIGN(auto ties,
+                         MakeArrayFromScalar(Int8Scalar(0), batch->num_rows()));
+    ASSERT_OK_AND_ASSIGN(batch, batch->AddColumn(batch->num_columns(), name, ties));
+    sort_keys.emplace_back(name, SortOrder::Ascending);
+  }
+  sort_keys.emplace_back("dec", SortOrder::Ascending);
+  sort_keys.emplace_back("bin", SortOrder::Descending);
+  sort_keys.emplace_back("i", SortOrder::Descending);
+
+  SortOptions options(sort_keys, NullPlacement::AtEnd);
+  AssertSortIndices(batch, options, "[5, 1, 3, 0, 7, 4, 6, 2]");
+  options.null_placement = NullPlacement::AtStart;
+  AssertSortIndices(batch, options, "[2, 5, 1, 4, 3, 7, 0, 6]");
+}
+
 TEST_F(TestRecordBatchSortIndices, NullType) {
   auto schema = arrow::schema({
       field("a", null()),
@@ -1762,6 +1859,96 @@ TEST_F(TestTableSortIndices, HeterogenousChunking) {
   AssertSortIndices(table, options, "[3, 4, 2, 5, 1, 0, 6, 7]");
 }
 
+TEST_F(TestTableSortIndices, ManySortKeys) {
+  // Enough sort keys for rows to be compared on normalized keys
+  auto schema = ::arrow::schema({
+      {field("a", float64())},
+      {field("b", binary())},
+      {field("c", int8())},
+      {field("d", timestamp(TimeUnit::SECOND))},
+  });
+  const std::vector<SortKey> sort_keys{
+      SortKey("a", SortOrder::Ascending), SortKey("b", SortOrder::Descending),
+      SortKey("c", SortOrder::Ascending), SortKey("d", SortOrder::Ascending)};
+
+  // -0.0 and 0.0 compare equal, "a" is a prefix of "ab"
+  auto table = TableFromJSON(schema, {R"([{"a": 0.0,  "b": "ab", "c": 1,    "d": 10},
+                                          {"a": -0.0, "b": "a",  "c": 2,    "d": 0},
+                                          {"a": NaN,  "b": "a",  "c": 0,    "d": 0},
+                                          {"a": -0.0, "b": "ab", "c": 0,    "d": 0}
+                                         ])",
+                                      R"([{"a": null, "b": "",   "c": 5,    "d": 0},
+                                          {"a": 0.0,  "b": "a",  "c": null, "d": 0},
+                                          {"a": 1.5,  "b": null, "c": 3,    "d": 0},
+                                          {"a": 0.0,  "b": "ab", "c": 1,    "d": 5}
+                                         ])"});
+  SortOptions options(sort_keys, NullPlacement::AtEnd);
+  AssertSortIndices(table, options, "[3, 7, 0, 1, 5, 6, 2, 4]");
+  options.null_placement = NullPlacement::AtStart;
+  AssertSortIndices(table, options, "[4, 2, 3, 7, 0, 5, 1, 6]");
+}
+
+TEST_F(TestTableSortIndices, ManySortKeysBinary) {
+  auto schema = ::arrow::schema({
+      {field("a", binary())},
+      {field("b", int8())},
+      {field("c", large_binary())},
+  });
+  // Values with embedded zero bytes and shared prefixes, all distinct in "a"
+  auto table = TableFromJSON(schema, {R"([{"a": "a\u0000b",      "b": 0, "c": "x"},
+                                          {"a": "",             "b": 0, "c": "x"},
+                                          {"a": "ab",           "b": 0, "c": "x"},
+                                          {"a": null,           "b": 0, "c": "x"},
+                                          {"a": "\u0000",       "b": 0, "c": "x"}
+                                         ])",
+                                      R"([{"a": "a",            "b": 0, "c": "x"},
+                                          {"a": "a\u0001",      "b": 0, "c": "x"},
+                                          {"a": "\u0000\u0000", "b": 0, "c": "x"},
+                                          {"a": "a\u0000",      "b": 0, "c": "x"}
+                                         ])"});
+  for (auto order : {SortOrder::Ascending, SortOrder::Descending}) {
+    const std::vector<SortKey> sort_keys{SortKey("a", order), SortKey("b"),
+                                         SortKey("c")};
+    SortOptions options(sort_keys, NullPlacement::AtEnd);
+    if (order == SortOrder::Ascending) {
+      AssertSortIndices(table, options, "[1, 4, 7, 5, 8, 0, 6, 2, 3]");
+      options.null_placement = NullPlacement::AtStart;
+      AssertSortIndices(table, options, "[3, 1, 4, 7, 5, 8, 0, 6, 2]");
+    } else {
+      AssertSortIndices(table, options, "[2, 6, 0, 8, 5, 7, 4, 1, 3]");
+      options.null_placement = NullPlacement::AtStart;
+      AssertSortIndices(table, options, "[3, 2, 6, 0, 8, 5, 7, 4, 1]");
+    }
+  }
+}
+
+TEST_F(TestTableSortIndices, ManySortKeysDecimal) {
+  auto schema = ::arrow::schema({
+      {field("a", decimal128(10, 3))},
+      {field("b", decimal256(30, 5))},
+      {field("c", int32())},
+  });
+  const std::vector<SortKey> sort_keys{SortKey("a", SortOrder::Ascending),
+                                       SortKey("b", SortOrder::Descending),
+                                       SortKey("c", SortOrder::Ascending)};
+
+  auto table = TableFromJSON(
+      schema, {R"([{"a": "12.345",   "b": "1.00000",                     "c": 0},
+                   {"a": "-0.001",   "b": "-5.00000",                    "c": 1},
+                   {"a": null,       "b": "3.00000",                     "c": 2},
+                   {"a": "12.345",   "b": "-12345678901234567890.12345", "c": 3}
+                  ])",
+               R"([{"a": "-123.456", "b": null,                          "c": 4},
+                   {"a": "12.345",   "b": null,                          "c": 5},
+                   {"a": "0.000",    "b": "0.00000",                     "c": 6},
+                   {"a": "-0.001",   "b": "-5.00000",                    "c": null}
+                  ])"});
+  SortOptions options(sort_keys, NullPlacement::AtEnd);
+  AssertSortIndices(table, options, "[4, 1, 7, 6, 0, 3, 5, 2]");
+  options.null_placement = NullPlacement::AtStart;
+  AssertSortIndices(table, options, "[2, 4, 7, 1, 6, 5, 0, 3]");
+}
+
 // Tests for temporal types
 template <typename ArrowType>
 class TestTableSortIndicesForTemporal : public TestTableSortIndices {
@@ -22,9 +22,11 @@
 #include "arrow/compute/api_vector.h"
 #include "arrow/compute/exec.h"
 #include "arrow/datum.h"
+#include "arrow/table.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
 #include "arrow/util/benchmark_util.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 namespace compute {
@@ -51,11 +53,89 @@ static void SelectKInt64(benchmark::State& state) {
   SelectKBenchmark(state, values, array_size / 8);
 }
 
+// Select with a dedicated thread pool of `num_threads` threads, a single thread
+// meaning a serial selection, to get scaling curves.
+static void ThreadedSelectKBenchmark(benchmark::State& state, const Datum& values,
+                                     const SelectKOptions& options, int64_t num_rows,
+                                     int64_t num_threads) {
+  ASSIGN_OR_ABORT(auto thread_pool,
+                  ::arrow::internal::ThreadPool::Make(static_cast<int>(num_threads)));
+  ExecContext ctx(default_memory_pool(), thread_pool.get());
+  ctx.set_use_threads(num_threads > 1);
+  for (auto _ : state) {
+    ABORT_NOT_OK(SelectKUnstable(values, options, &ctx).status());
+  }
+  state.counters["threads"] = static_cast<double>(num_threads);
+  state.SetItemsProcessed(state.iterations() * num_rows);
+}
+
+static void ChunkedArraySelectKInt64Threads(benchmark::State& state) {
+  const int64_t num_rows = state.range(0);
+  const int64_t num_chunks = state.range(1);
+  const int64_t k = state.range(2);
+  const int64_t num_threads = state.range(3);
+
+  auto rand = random::RandomArrayGenerator(kSeed);
+  ArrayVector chunks;
+  for (int64_t i = 0; i < num_chunks; ++i) {
+    chunks.push_back(rand.Int64(num_rows / num_chunks,
+                                std::numeric_limits<int64_t>::min(),
+                                std::numeric_limits<int64_t>::max(),
+                                /*null_probability=*/0.01));
+  }
+  auto values = std::make_shared<ChunkedArray>(chunks);
+  ThreadedSelectKBenchmark(state, Datum(values), SelectKOptions::TopKDefault(k),
+                           num_rows, num_threads);
+}
+
+static void TableSelectKInt64Threads(benchmark::State& state) {
+  const int64_t num_rows = state.range(0);
+  const int64_t num_chunks = state.range(1);
+  const int64_t k = state.range(2);
+  const int64_t num_threads = state.range(3);
+
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto schema = ::arrow::schema({field("a", int64()), field("b", int64())});
+  ChunkedArrayVector columns;
+  for (int i = 0; i < schema->num_fields(); ++i) {
+    ArrayVector chunks;
+    for (int64_t j = 0; j < num_chunks; ++j) {
+      chunks.push_back(
+          rand.Int64(num_rows / num_chunks, -1000, 1000, /*null_probability=*/0.01));
+    }
+    columns.push_back(std::make_shared<ChunkedArray>(chunks));
+  }
+  auto table = Table::Make(schema, columns);
+  ThreadedSelectKBenchmark(state, Datum(table),
+                           SelectKOptions::TopKDefault(k, {"a", "b"}), num_rows,
+                           num_threads);
+}
+
 BENCHMARK(SelectKInt64)
     ->Apply(RegressionSetArgs)
     ->Args({1 << 20, 100})
     ->Args({1 << 23, 100})
     ->Unit(benchmark::TimeUnit::kNanosecond);
 
+BENCHMARK(ChunkedArraySelectKInt64Threads)
+    ->ArgsProduct({
+        {1 << 24},         // the number of rows
+        {16},              // the number of chunks
+        {10, 1000},        // k
+        {1, 2, 4, 8, 16},  // the number of threads
+    })
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->UseRealTime();
+
+BENCHMARK(TableSelectKInt64Threads)
+    ->ArgsProduct({
+        {1 << 22},         // the number of rows
+        {16},              // the number of chunks
+        {10, 1000},        // k
+        {1, 2, 4, 8, 16},  // the number of threads
+    })
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->UseRealTime();
+
 }  // namespace compute
 }  // namespace arrow
@@ -309,6 +309,8 @@ static std::unique_ptr<FunctionRegistry> CreateBuiltInRegistry() {
   RegisterScalarTemporalBinary(registry.get());
   RegisterScalarTemporalUnary(registry.get());
   RegisterScalarValidity(registry.get());
+  // Must come after all other scalar functions
+  RegisterScalarRunEndEncoded(registry.get());
 
   // Vector functions
   RegisterVectorArraySort(registry.get());
@@ -41,6 +41,9 @@ void RegisterScalarTemporalBinary(FunctionRegistry* registry);
 void RegisterScalarTemporalUnary(FunctionRegistry* registry);
 void RegisterScalarValidity(FunctionRegistry* registry);
 
+// Run-end encoded variants of the elementwise functions registered so far
+void RegisterScalarRunEndEncoded(FunctionRegistry* registry);
+
 void RegisterScalarOptions(FunctionRegistry* registry);
 
 // Vector functions
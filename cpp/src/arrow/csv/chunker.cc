@@ -25,6 +25,7 @@
 
 #include "arrow/csv/lexing_internal.h"
 #include "arrow/status.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/logging.h"
 
 namespace arrow {
@@ -266,7 +267,7 @@ template <typename SpecializedOptions>
 class LexingBoundaryFinder : public BoundaryFinder {
  public:
   explicit LexingBoundaryFinder(ParseOptions options)
-      : options_(std::move(options)), lexer_(options_) {}
+      : options_(std::move(options)), lexer_(options_), bitmask_lexer_(options_) {}
 
   Status FindFirst(std::string_view partial, std::string_view block,
                    int64_t* out_pos) override {
@@ -299,6 +300,9 @@ class LexingBoundaryFinder : public BoundaryFinder {
 
   Status FindLast(std::string_view block, int64_t* out_pos) override {
     lexer_.Reset();
+    if (BitmaskLexerType::kVectorized) {
+      return FindLastBitmask(block, out_pos);
+    }
     if (lexer_.ShouldUseBulkFilter(block.data(), block.data() + block.size())) {
       return FindLastInternal<true>(block, out_pos);
     } else {
@@ -330,6 +334,44 @@ class LexingBoundaryFinder : public BoundaryFinder {
     return Status::OK();
   }
 
+  Status FindLastBitmask(std::string_view block, int64_t* out_pos) {
+    const char* data = block.data();
+    const char* const data_end = block.data() + block.size();
+
+    while (data < data_end) {
+      const int64_t size = data_end - data;
+      int64_t last_line_end = 0;
+      const int64_t stop = bitmask_lexer_.Scan(
+          data, size, [&](int64_t offset, uint64_t, uint64_t line_ends) {
+            if (line_ends != 0) {
+              last_line_end = offset + 64 - bit_util::CountLeadingZeros(line_ends);
+            }
+          });
+      data += last_line_end;
+      if (stop == size) {
+        break;
+      }
+      // The bitmask lexer stopped in the middle of the row starting at `data`,
+      // read that row using the state machine
+      lexer_.Reset();
+      const char* line_end = lexer_.template ReadLine<false>(data, data_end);
+      if (line_end == nullptr) {
+        // Cannot read any further
+        break;
+      }
+      DCHECK_GT(line_end, data);
+      data = line_end;
+    }
+    if (data == block.data()) {
+      // No complete CSV line
+      *out_pos = -1;
+    } else {
+      *out_pos = static_cast<int64_t>(data - block.data());
+      DCHECK_GT(*out_pos, 0);
+    }
+    return Status::OK();
+  }
+
   Status FindNth(std::string_view partial, std::string_view block, int64_t count,
                  int64_t* out_pos, int64_t* num_found) override {
     lexer_.Reset();
@@ -365,8 +407,11 @@ class LexingBoundaryFinder : public BoundaryFinder {
   }
 
  protected:
+  using BitmaskLexerType = internal::BitmaskLexer<SpecializedOptions>;
+
   ParseOptions options_;
   Lexer<SpecializedOptions> lexer_;
+  BitmaskLexerType bitmask_lexer_;
 };
 
 }  // namespace
@@ -18,7 +18,9 @@
 #include <cstdint>
 #include <memory>
 #include <numeric>
+#include <random>
 #include <string>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -341,6 +343,56 @@ TEST_P(BaseChunkerTest, EscapingAndQuoting) {
   }
 }
 
+TEST_P(BaseChunkerTest, MixedQuotingLongRows) {
+  // Rows spanning many 64-byte blocks, with newlines inside quoted values and
+  // a few irregularly quoted or escaped fields
+  if (options_.newlines_in_values) {
+    for (const bool escaping : {false, true}) {
+      ARROW_SCOPED_TRACE("escaping = ", escaping);
+      options_.escaping = escaping;
+      std::default_random_engine engine(42);
+      auto random_text = [&](const std::string& alphabet, int max_length) {
+        std::string text(engine() % (max_length + 1), ' ');
+        for (auto& c : text) {
+          c = alphabet[engine() % alphabet.size()];
+        }
+        return text;
+      };
+
+      std::string csv;
+      std::vector<size_t> lengths;
+      for (int i = 0; i < 200; ++i) {
+        std::string row;
+        for (int col = 0; col < 4; ++col) {
+          switch (engine() % 8) {
+            case 0:
+              row += "\"" + random_text("ab,\r\n", 30) + "\"\"" +
+                     random_text("ab,\r\n", 30) + "\"";
+              break;
+            case 1:
+              row += "x\"" + random_text("xy", 5);
+              break;
+            case 2:
+              row += "\"" + random_text("xy", 5) + "\"z" + random_text("xy\"", 5);
+              break;
+            case 3:
+              row += escaping ? "x\\\ny" : "\"x\ny\"";
+              break;
+            default:
+              row += random_text("abcdefghij0123456789", 30);
+              break;
+          }
+          row += (col == 3) ? "\n" : ",";
+        }
+        csv += row;
+        lengths.push_back(row.size());
+      }
+      MakeChunker();
+      AssertChunking(*chunker_, csv, lengths);
+    }
+  }
+}
+
 TEST_P(BaseChunkerTest, ParseSkip) {
   {
     auto csv = MakeCSVData({"ab,c,\n", "def,,gh\n", ",ij,kl\n"});
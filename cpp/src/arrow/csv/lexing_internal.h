@@ -17,9 +17,12 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstdint>
+#include <cstring>
 
 #include "arrow/csv/options.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/simd.h"
 
 namespace arrow {
@@ -208,6 +211,205 @@ template <typename SpecializedOptions>
 using PreferredBulkFilterType = BloomFilter4B<SpecializedOptions>;
 #endif
 
+//
+// Bitmask lexer: classify CSV data 64 bytes at a time.
+//
+// Each 64-byte block is turned into bitmasks of quotes, delimiters, line
+// endings and escapes (bit i standing for byte i of the block).  Quoted regions
+// are then resolved for the whole block at once with a prefix XOR of the quote
+// bitmask, which gives the positions of all field and line separators lying
+// outside of quotes.
+//
+// The prefix XOR only agrees with the scalar state machines when quotes are
+// well-formed, i.e. they open a field, close it just before a separator or
+// (with double quoting) are doubled inside a quoted field.  Escape characters
+// are not resolved either.  Scanning therefore stops at the first byte where
+// this doesn't hold, and callers are expected to handle the row containing
+// it using the scalar state machine.
+//
+
+template <typename SpecializedOptions>
+class BitmaskLexer {
+ public:
+  static constexpr int64_t kBlockSize = 64;
+
+#if defined(ARROW_HAVE_AVX512) || defined(ARROW_HAVE_AVX2) || \
+    (defined(ARROW_HAVE_SSE4_2) && (defined(__x86_64__) || defined(_M_X64)))
+  static constexpr bool kVectorized = true;
+#else
+  // The scalar classification is correct but not faster than the scalar
+  // state machines, so callers should not use it by default.
+  static constexpr bool kVectorized = false;
+#endif
+
+  explicit BitmaskLexer(const ParseOptions& options)
+      : delimiter_(static_cast<uint8_t>(options.delimiter)),
+        quote_char_(static_cast<uint8_t>(options.quote_char)),
+        escape_char_(static_cast<uint8_t>(options.escape_char)),
+        double_quote_(options.double_quote) {}
+
+  // Scan `size` bytes of data starting at the beginning of a CSV row.
+  //
+  // For each 64-byte block, `visit(block_offset, separators, line_ends)` is
+  // called with the bitmasks of field or line separators outside of quotes,
+  // and of line separators only ('\r' and '\n').  Returns the offset of the
+  // first byte that the bitmasks cannot account for (no separator at or after
+  // that offset is visited), or `size` if the whole data was scanned.
+  template <typename Visitor>
+  int64_t Scan(const char* data, int64_t size, Visitor&& visit) const {
+    // Carries from one block to the next
+    uint64_t prev_in_quotes = 0;  // all ones if the last block ended inside quotes
+    uint64_t prev_separator = 1;  // the data starts at a field start
+    uint64_t prev_closing_quote = 0;
+
+    for (int64_t offset = 0; offset < size; offset += kBlockSize) {
+      const int64_t length = std::min(kBlockSize, size - offset);
+      Bitmasks masks;
+      uint64_t valid = ~uint64_t(0);
+      if (ARROW_PREDICT_TRUE(length == kBlockSize)) {
+        masks = Classify(reinterpret_cast<const uint8_t*>(data + offset));
+      } else {
+        uint8_t padded[kBlockSize] = {};
+        std::memcpy(padded, data + offset, static_cast<size_t>(length));
+        masks = Classify(padded);
+        valid = (uint64_t(1) << length) - 1;
+        masks.quotes &= valid;
+        masks.delimiters &= valid;
+        masks.line_ends &= valid;
+        masks.escapes &= valid;
+      }
+
+      uint64_t irregular = SpecializedOptions::escaping ? masks.escapes : 0;
+      uint64_t separators = masks.delimiters | masks.line_ends;
+      if (SpecializedOptions::quoting) {
+        // Quoted regions include their opening quote but not their closing quote
+        const uint64_t in_quotes = PrefixXor(masks.quotes) ^ prev_in_quotes;
+        const uint64_t opening = masks.quotes & in_quotes;
+        const uint64_t closing = masks.quotes & ~in_quotes;
+        separators &= ~in_quotes;
+
+        const uint64_t field_starts = (separators << 1) | prev_separator;
+        const uint64_t after_closing = (closing << 1) | prev_closing_quote;
+        if (double_quote_) {
+          // A doubled quote closes and immediately reopens the quoted region
+          irregular |= opening & ~field_starts & ~after_closing;
+          irregular |= after_closing & ~separators & ~opening;
+        } else {
+          irregular |= opening & ~field_starts;
+          irregular |= after_closing & ~separators;
+        }
+        irregular &= valid;
+
+        prev_in_quotes = static_cast<uint64_t>(static_cast<int64_t>(in_quotes) >> 63);
+        prev_closing_quote = closing >> 63;
+      }
+      prev_separator = separators >> 63;
+
+      if (ARROW_PREDICT_FALSE(irregular != 0)) {
+        const int stop = bit_util::CountTrailingZeros(irregular);
+        const uint64_t before_stop = (uint64_t(1) << stop) - 1;
+        separators &= before_stop;
+        visit(offset, separators, separators & masks.line_ends);
+        return offset + stop;
+      }
+      visit(offset, separators, separators & masks.line_ends);
+    }
+    return size;
+  }
+
+ protected:
+  struct Bitmasks {
+    uint64_t quotes;
+    uint64_t delimiters;
+    uint64_t line_ends;
+    uint64_t escapes;
+  };
+
+#if defined(ARROW_HAVE_AVX512)
+  Bitmasks Classify(const uint8_t* block) const {
+    const __m512i v = _mm512_loadu_si512(block);
+    auto match = [&](uint8_t c) -> uint64_t {
+      return _mm512_cmpeq_epi8_mask(v, _mm512_set1_epi8(static_cast<char>(c)));
+    };
+    return {SpecializedOptions::quoting ? match(quote_char_) : 0, match(delimiter_),
+            match('\r') | match('\n'),
+            SpecializedOptions::escaping ? match(escape_char_) : 0};
+  }
+#elif defined(ARROW_HAVE_AVX2)
+  Bitmasks Classify(const uint8_t* block) const {
+    const __m256i lo = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block));
+    const __m256i hi = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block + 32));
+    auto match = [&](uint8_t c) -> uint64_t {
+      const __m256i needle = _mm256_set1_epi8(static_cast<char>(c));
+      const uint32_t lo_mask =
+          static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(lo, needle)));
+      const uint32_t hi_mask =
+          static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(hi, needle)));
+      return lo_mask | (static_cast<uint64_t>(hi_mask) << 32);
+    };
+    return {SpecializedOptions::quoting ? match(quote_char_) : 0, match(delimiter_),
+            match('\r') | match('\n'),
+            SpecializedOptions::escaping ? match(escape_char_) : 0};
+  }
+#elif defined(ARROW_HAVE_SSE4_2) && (defined(__x86_64__) || defined(_M_X64))
+  Bitmasks Classify(const uint8_t* block) const {
+    __m128i v[4];
+    for (int i = 0; i < 4; ++i) {
+      v[i] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + 16 * i));
+    }
+    auto match = [&](uint8_t c) -> uint64_t {
+      const __m128i needle = _mm_set1_epi8(static_cast<char>(c));
+      uint64_t mask = 0;
+      for (int i = 0; i < 4; ++i) {
+        const auto m =
+            static_cast<uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(v[i], needle)));
+        mask |= static_cast<uint64_t>(m) << (16 * i);
+      }
+      return mask;
+    };
+    return {SpecializedOptions::quoting ? match(quote_char_) : 0, match(delimiter_),
+            match('\r') | match('\n'),
+            SpecializedOptions::escaping ? match(escape_char_) : 0};
+  }
+#else
+  Bitmasks Classify(const uint8_t* block) const {
+    Bitmasks masks{0, 0, 0, 0};
+    for (int i = 0; i < kBlockSize; ++i) {
+      const uint8_t c = block[i];
+      const uint64_t bit = uint64_t(1) << i;
+      if (SpecializedOptions::quoting && c == quote_char_) masks.quotes |= bit;
+      if (c == delimiter_) masks.delimiters |= bit;
+      if (c == '\r' || c == '\n') masks.line_ends |= bit;
+      if (SpecializedOptions::escaping && c == escape_char_) masks.escapes |= bit;
+    }
+    return masks;
+  }
+#endif
+
+  // Bit i of the result is the XOR of bits 0 to i of `x`
+  static uint64_t PrefixXor(uint64_t x) {
+#if defined(__PCLMUL__) && (defined(ARROW_HAVE_AVX2) || defined(ARROW_HAVE_AVX512))
+    // Carry-less multiplication by all ones
+    const __m128i product = _mm_clmulepi64_si128(
+        _mm_set_epi64x(0, static_cast<int64_t>(x)), _mm_set1_epi8(-1), 0);
+    return static_cast<uint64_t>(_mm_cvtsi128_si64(product));
+#else
+    x ^= x << 1;
+    x ^= x << 2;
+    x ^= x << 4;
+    x ^= x << 8;
+    x ^= x << 16;
+    x ^= x << 32;
+    return x;
+#endif
+  }
+
+  const uint8_t delimiter_;
+  const uint8_t quote_char_;
+  const uint8_t escape_char_;
+  const bool double_quote_;
+};
+
 }  // namespace internal
 }  // namespace csv
 }  // namespace arrow
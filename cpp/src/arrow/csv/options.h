@@ -209,6 +209,13 @@ struct ARROW_EXPORT WriteOptions {
   /// \brief Quoting style
   QuotingStyle quoting_style = QuotingStyle::Needed;
 
+  /// \brief Whether to use the global CPU thread pool
+  ///
+  /// If true, several batches of `batch_size` rows are converted to CSV
+  /// concurrently, then written out in order.  This waits on the thread pool,
+  /// so it should not be enabled when writing from a task already running on it.
+  bool use_threads = false;
+
   /// Create write options with default values
   static WriteOptions Defaults();
 
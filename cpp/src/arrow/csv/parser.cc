@@ -19,8 +19,11 @@
 
 #include <algorithm>
 #include <cstdio>
+#include <cstring>
 #include <limits>
+#include <optional>
 #include <utility>
+#include <vector>
 
 #include "arrow/csv/lexing_internal.h"
 #include "arrow/memory_pool.h"
@@ -88,9 +91,20 @@ class PresizedDataWriter {
     parsed_size_ += sizeof(w);
   }
 
+  void PushFieldBytes(const char* data, int64_t size) {
+    DCHECK_GE(parsed_capacity_ - parsed_size_, size);
+    memcpy(parsed_ + parsed_size_, data, static_cast<size_t>(size));
+    parsed_size_ += size;
+  }
+
   // Rollback the state that was saved in BeginLine()
   void RollbackLine() { parsed_size_ = saved_parsed_size_; }
 
+  void BeginField() { saved_field_size_ = parsed_size_; }
+
+  // Rollback the state that was saved in BeginField()
+  void RollbackField() { parsed_size_ = saved_field_size_; }
+
   int64_t size() { return parsed_size_; }
 
  protected:
@@ -100,6 +114,8 @@ class PresizedDataWriter {
   int64_t parsed_capacity_;
   // Checkpointing, for when an incomplete line is encountered at end of block
   int64_t saved_parsed_size_;
+  // Checkpointing, for when the value of a field is skipped
+  int64_t saved_field_size_;
 };
 
 template <typename Derived>
@@ -224,17 +240,56 @@ class PresizedValueDescWriter : public ValueDescWriter<PresizedValueDescWriter>
 class BlockParserImpl {
  public:
   BlockParserImpl(MemoryPool* pool, ParseOptions options, int32_t num_cols,
-                  int64_t first_row, int32_t max_num_rows)
+                  int64_t first_row, int32_t max_num_rows,
+                  std::optional<std::vector<int32_t>> column_indices = std::nullopt)
       : pool_(pool),
         options_(std::move(options)),
         first_row_(first_row),
         max_num_rows_(max_num_rows),
-        batch_(num_cols) {}
+        batch_(num_cols) {
+    if (column_indices.has_value()) {
+      int32_t max_index = -1;
+      for (const auto index : *column_indices) {
+        DCHECK_GE(index, 0);
+        max_index = std::max(max_index, index);
+      }
+      // Make `column_slots_` non-empty even if no column is recorded
+      column_slots_.assign(std::max(max_index + 1, 1), -1);
+      for (const auto index : *column_indices) {
+        column_slots_[index] = 0;
+      }
+      int32_t slot = 0;
+      for (auto& column_slot : column_slots_) {
+        if (column_slot >= 0) {
+          column_slot = slot++;
+        }
+      }
+    }
+  }
 
   const DataBatch& parsed_batch() const { return batch_; }
 
   int64_t first_row_num() const { return first_row_; }
 
+  // Whether the values of the given column are recorded
+  bool IsColumnRecorded(int32_t col_index) const {
+    return column_slots_.empty() ||
+           (col_index < static_cast<int32_t>(column_slots_.size()) &&
+            column_slots_[col_index] >= 0);
+  }
+
+  // The number of recorded values in a row of `num_cols` columns
+  int32_t NumValueCols(int32_t num_cols) const {
+    if (column_slots_.empty() || num_cols < 0) {
+      return num_cols;
+    }
+    const auto end =
+        column_slots_.begin() +
+        std::min(num_cols, static_cast<int32_t>(column_slots_.size()));
+    return static_cast<int32_t>(std::count_if(column_slots_.begin(), end,
+                                              [](int32_t slot) { return slot >= 0; }));
+  }
+
   template <typename ValueDescWriter, typename DataWriter>
   Status HandleInvalidRow(ValueDescWriter* values_writer, DataWriter* parsed_writer,
                           const char* start, const char* data, int32_t num_cols,
@@ -282,7 +337,14 @@ class BlockParserImpl {
 
     DCHECK_GT(data_end, data);
 
-    auto FinishField = [&]() { values_writer->FinishField(parsed_writer); };
+    auto FinishField = [&]() {
+      if (ARROW_PREDICT_TRUE(IsColumnRecorded(num_cols))) {
+        values_writer->FinishField(parsed_writer);
+      } else {
+        // Drop the value of a skipped column
+        parsed_writer->RollbackField();
+      }
+    };
 
     values_writer->BeginLine();
     parsed_writer->BeginLine();
@@ -307,6 +369,7 @@ class BlockParserImpl {
 
   FieldStart:
     // At the start of a field
+    parsed_writer->BeginField();
     if (*data == options_.delimiter) {
       // Empty cells are very common in some files, shortcut them
       values_writer->StartField(false /* quoted */);
@@ -454,9 +517,11 @@ class BlockParserImpl {
         batch_.num_cols_ = 1;
       }
       // Record as row of empty (null?) values
-      while (num_cols++ < batch_.num_cols_) {
-        values_writer->StartField(false /* quoted */);
-        FinishField();
+      for (; num_cols < batch_.num_cols_; ++num_cols) {
+        if (IsColumnRecorded(num_cols)) {
+          values_writer->StartField(false /* quoted */);
+          values_writer->FinishField(parsed_writer);
+        }
       }
       ++batch_.num_rows_;
     }
@@ -464,6 +529,118 @@ class BlockParserImpl {
     return Status::OK();
   }
 
+  // Parse as many rows as possible using the bitmask lexer, stopping at the first
+  // row that it cannot handle (an empty, irregular or truncated line, or a line
+  // with the wrong number of columns).  Such rows are left to ParseLine.
+  template <typename SpecializedOptions, typename ValueDescWriter, typename DataWriter>
+  const char* ParseLinesBitmask(
+      ValueDescWriter* values_writer, DataWriter* parsed_writer, const char* data,
+      const char* data_end, int32_t num_rows_deadline,
+      const internal::BitmaskLexer<SpecializedOptions>& bitmask_lexer) {
+    // Bound the scanned area, as not all scanned rows may end up being parsed
+    constexpr int64_t kMaxScanSize = 1 << 16;
+    const int64_t size = std::min<int64_t>(data_end - data, kMaxScanSize);
+
+    separators_.clear();
+    bitmask_lexer.Scan(data, size, [&](int64_t offset, uint64_t separators, uint64_t) {
+      while (separators != 0) {
+        separators_.push_back(static_cast<uint32_t>(
+            offset + bit_util::CountTrailingZeros(separators)));
+        separators &= separators - 1;
+      }
+    });
+
+    const size_t num_separators = separators_.size();
+    size_t i = 0;
+    int64_t row_start = 0;
+    while (i < num_separators && batch_.num_rows_ < num_rows_deadline) {
+      const char first = data[row_start];
+      if (ARROW_PREDICT_FALSE(first == '\r' || first == '\n')) {
+        // Empty line
+        break;
+      }
+      values_writer->BeginLine();
+      parsed_writer->BeginLine();
+
+      int32_t num_cols = 0;
+      int64_t field_start = row_start;
+      int64_t row_end = -1;
+      while (i < num_separators) {
+        const int64_t pos = separators_[i++];
+        if (ARROW_PREDICT_FALSE(++num_cols > batch_.num_cols_)) {
+          break;
+        }
+        if (IsColumnRecorded(num_cols - 1)) {
+          PushBitmaskField<SpecializedOptions>(values_writer, parsed_writer,
+                                               data + field_start, data + pos);
+        }
+        const char c = data[pos];
+        if (ARROW_PREDICT_TRUE(c == options_.delimiter)) {
+          field_start = pos + 1;
+          continue;
+        }
+        // End of line.  A '\r' at the end of the scanned area could be followed
+        // by a '\n' we haven't looked at.
+        if (c == '\r') {
+          if (ARROW_PREDICT_FALSE(pos + 1 == size)) {
+            break;
+          }
+          if (data[pos + 1] == '\n') {
+            if (ARROW_PREDICT_FALSE(i == num_separators)) {
+              break;
+            }
+            DCHECK_EQ(static_cast<int64_t>(separators_[i]), pos + 1);
+            ++i;
+            row_end = pos + 2;
+            break;
+          }
+        }
+        row_end = pos + 1;
+        break;
+      }
+      if (ARROW_PREDICT_FALSE(row_end < 0 || num_cols != batch_.num_cols_)) {
+        values_writer->RollbackLine();
+        parsed_writer->RollbackLine();
+        break;
+      }
+      ++batch_.num_rows_;
+      row_start = row_end;
+    }
+    return data + row_start;
+  }
+
+  template <typename SpecializedOptions, typename ValueDescWriter, typename DataWriter>
+  void PushBitmaskField(ValueDescWriter* values_writer, DataWriter* parsed_writer,
+                        const char* field, const char* field_end) {
+    if (SpecializedOptions::quoting && field < field_end &&
+        *field == options_.quote_char) {
+      // The bitmask lexer ensures the field ends with the closing quote and
+      // any quotes inside it are doubled
+      DCHECK_GE(field_end - field, 2);
+      DCHECK_EQ(*(field_end - 1), options_.quote_char);
+      values_writer->StartField(true /* quoted */);
+      const char* data = field + 1;
+      const char* const data_end = field_end - 1;
+      while (true) {
+        const auto quote = static_cast<const char*>(
+            memchr(data, options_.quote_char, static_cast<size_t>(data_end - data)));
+        if (quote == nullptr) {
+          parsed_writer->PushFieldBytes(data, data_end - data);
+          break;
+        }
+        DCHECK(options_.double_quote);
+        DCHECK_EQ(quote[1], options_.quote_char);
+        // Keep one of the two quotes
+        parsed_writer->PushFieldBytes(data, quote + 1 - data);
+        data = quote + 2;
+      }
+    } else {
+      values_writer->StartField(false /* quoted */);
+      parsed_writer->PushFieldBytes(field, field_end - field);
+    }
+    values_writer->FinishField(parsed_writer);
+  }
+
   template <typename DataWriter, typename SpecializedBulkFilter>
   const char* RunBulkFilter(DataWriter* data_writer, const char* data,
                             const char* data_end,
@@ -493,11 +670,46 @@ class BlockParserImpl {
   Status ParseChunk(ValueDescWriter* values_writer, DataWriter* parsed_writer,
                     const char* data, const char* data_end, bool is_final,
                     int32_t rows_in_chunk, const char** out_data, bool* finished_parsing,
-                    const BulkFilter& bulk_filter) {
+                    const BulkFilter& bulk_filter,
+                    const internal::BitmaskLexer<SpecializedOptions>& bitmask_lexer) {
     const int32_t start_num_rows = batch_.num_rows_;
     const int32_t num_rows_deadline = batch_.num_rows_ + rows_in_chunk;
 
-    if (use_bulk_filter_) {
+    if (internal::BitmaskLexer<SpecializedOptions>::kVectorized &&
+        batch_.num_cols_ > 0) {
+      // Rows the bitmask lexer can't handle are parsed by the state machine,
+      // a few at a time if the bitmask lexer couldn't make any progress.
+      constexpr int32_t kMaxFallbackRows = 16;
+      while (data < data_end && batch_.num_rows_ < num_rows_deadline) {
+        const char* bitmask_end =
+            ParseLinesBitmask(values_writer, parsed_writer, data, data_end,
+                              num_rows_deadline, bitmask_lexer);
+        const int32_t num_fallback_rows = (bitmask_end == data) ? kMaxFallbackRows : 1;
+        data = bitmask_end;
+        for (int32_t j = 0; j < num_fallback_rows && data < data_end &&
+                            batch_.num_rows_ < num_rows_deadline;
+             ++j) {
+          const char* line_end = data;
+          RETURN_NOT_OK(use_bulk_filter_
+                            ? (ParseLine<SpecializedOptions, true>(
+                                  values_writer, parsed_writer, data, data_end, is_final,
+                                  &line_end, bulk_filter))
+                            : (ParseLine<SpecializedOptions, false>(
+                                  values_writer, parsed_writer, data, data_end, is_final,
+                                  &line_end, bulk_filter)));
+          RETURN_NOT_OK(values_writer->status());
+          if (line_end == data) {
+            // Cannot parse any further
+            *finished_parsing = true;
+            break;
+          }
+          data = line_end;
+        }
+        if (*finished_parsing) {
+          break;
+        }
+      }
+    } else if (use_bulk_filter_) {
       while (data < data_end && batch_.num_rows_ < num_rows_deadline) {
         const char* line_end = data;
         RETURN_NOT_OK((ParseLine<SpecializedOptions, true>(values_writer, parsed_writer,
@@ -551,8 +763,10 @@ class BlockParserImpl {
   Status ParseSpecialized(const std::vector<std::string_view>& views, bool is_final,
                           uint32_t* out_size) {
     internal::PreferredBulkFilterType<SpecializedOptions> bulk_filter(options_);
+    internal::BitmaskLexer<SpecializedOptions> bitmask_lexer(options_);
 
     batch_ = DataBatch{batch_.num_cols_};
+    batch_.column_slots_ = column_slots_;
     values_size_ = 0;
 
     size_t total_view_length = 0;
@@ -580,7 +794,7 @@ class BlockParserImpl {
 
         RETURN_NOT_OK(ParseChunk<SpecializedOptions>(
             &values_writer, &parsed_writer, data, data_end, is_final, rows_in_chunk,
-            &data, &finished_parsing, bulk_filter));
+            &data, &finished_parsing, bulk_filter, bitmask_lexer));
         if (batch_.num_cols_ == -1) {
           return ParseError("Empty CSV file or block: cannot infer number of columns");
         }
@@ -591,10 +805,11 @@ class BlockParserImpl {
         // a given number of rows
         DCHECK_GE(batch_.num_cols_, 0);
 
+        const int32_t num_value_cols = NumValueCols(batch_.num_cols_);
         int32_t rows_in_chunk;
         constexpr int32_t kTargetChunkSize = 32768;  // in number of values
-        if (batch_.num_cols_ > 0) {
-          rows_in_chunk = std::min(std::max(kTargetChunkSize / batch_.num_cols_, 512),
+        if (num_value_cols > 0) {
+          rows_in_chunk = std::min(std::max(kTargetChunkSize / num_value_cols, 512),
                                    max_num_rows_ - batch_.num_rows_);
         } else {
           rows_in_chunk = std::min(kTargetChunkSize, max_num_rows_ - batch_.num_rows_);
@@ -602,12 +817,12 @@ class BlockParserImpl {
 
         ARROW_ASSIGN_OR_RAISE(
             auto values_writer,
-            PresizedValueDescWriter::Make(pool_, rows_in_chunk, batch_.num_cols_));
+            PresizedValueDescWriter::Make(pool_, rows_in_chunk, num_value_cols));
         values_writer.Start(parsed_writer);
 
         RETURN_NOT_OK(ParseChunk<SpecializedOptions>(
             &values_writer, &parsed_writer, data, data_end, is_final, rows_in_chunk,
-            &data, &finished_parsing, bulk_filter));
+            &data, &finished_parsing, bulk_filter, bitmask_lexer));
       }
       DCHECK_GE(data, view.data());
       DCHECK_LE(data, data_end);
@@ -622,11 +837,12 @@ class BlockParserImpl {
     parsed_writer.Finish(&batch_.parsed_buffer_);
     batch_.parsed_size_ = static_cast<int32_t>(batch_.parsed_buffer_->size());
     batch_.parsed_ = batch_.parsed_buffer_->data();
+    batch_.num_value_cols_ = NumValueCols(batch_.num_cols_);
 
     if (batch_.num_cols_ == -1) {
       DCHECK_EQ(batch_.num_rows_, 0);
     }
-    DCHECK_EQ(values_size_, batch_.num_rows_ * batch_.num_cols_);
+    DCHECK_EQ(values_size_, batch_.num_rows_ * batch_.num_value_cols_);
 #ifndef NDEBUG
     if (batch_.num_rows_ > 0) {
       // Ending parsed offset should be equal to number of parsed bytes
@@ -675,6 +891,11 @@ class BlockParserImpl {
   int32_t max_num_rows_;
 
   bool use_bulk_filter_ = false;
+  // Separator offsets found by the bitmask lexer
+  std::vector<uint32_t> separators_;
+  // If not empty, the position of each column's values in a row of recorded
+  // values (-1 if skipped), see DataBatch
+  std::vector<int32_t> column_slots_;
 
   // Unparsed data size
   int32_t values_size_;
@@ -691,6 +912,12 @@ BlockParser::BlockParser(MemoryPool* pool, ParseOptions options, int32_t num_col
     : impl_(new BlockParserImpl(pool, std::move(options), num_cols, first_row,
                                 max_num_rows)) {}
 
+BlockParser::BlockParser(MemoryPool* pool, ParseOptions options, int32_t num_cols,
+                         int64_t first_row, int32_t max_num_rows,
+                         std::vector<int32_t> column_indices)
+    : impl_(new BlockParserImpl(pool, std::move(options), num_cols, first_row,
+                                max_num_rows, std::move(column_indices))) {}
+
 BlockParser::~BlockParser() {}
 
 Status BlockParser::Parse(const std::vector<std::string_view>& data, uint32_t* out_size) {
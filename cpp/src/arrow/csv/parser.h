@@ -55,7 +55,7 @@ struct ParsedValueDesc {
 
 class ARROW_EXPORT DataBatch {
  public:
-  explicit DataBatch(int32_t num_cols) : num_cols_(num_cols) {}
+  explicit DataBatch(int32_t num_cols) : num_cols_(num_cols), num_value_cols_(num_cols) {}
 
   /// \brief Return the number of parsed rows (not skipped)
   int32_t num_rows() const { return num_rows_; }
@@ -70,13 +70,24 @@ class ARROW_EXPORT DataBatch {
   Status VisitColumn(int32_t col_index, int64_t first_row, Visitor&& visit) const {
     using detail::ParsedValueDesc;
 
+    int32_t value_index = col_index;
+    if (!column_slots_.empty()) {
+      value_index = col_index < static_cast<int32_t>(column_slots_.size())
+                        ? column_slots_[col_index]
+                        : -1;
+      if (ARROW_PREDICT_FALSE(value_index < 0 || value_index >= num_value_cols_)) {
+        return Status::Invalid("CSV column #", col_index, " was not parsed");
+      }
+    }
+
     int32_t batch_row = 0;
     for (size_t buf_index = 0; buf_index < values_buffers_.size(); ++buf_index) {
       const auto& values_buffer = values_buffers_[buf_index];
       const auto values = reinterpret_cast<const ParsedValueDesc*>(values_buffer->data());
       const auto max_pos =
           static_cast<int32_t>(values_buffer->size() / sizeof(ParsedValueDesc)) - 1;
-      for (int32_t pos = col_index; pos < max_pos; pos += num_cols_, ++batch_row) {
+      for (int32_t pos = value_index; pos < max_pos;
+           pos += num_value_cols_, ++batch_row) {
         auto start = values[pos].offset;
         auto stop = values[pos + 1].offset;
         auto quoted = values[pos + 1].quoted;
@@ -97,8 +108,8 @@ class ARROW_EXPORT DataBatch {
     const auto values = reinterpret_cast<const ParsedValueDesc*>(values_buffer->data());
     const auto start_pos =
         static_cast<int32_t>(values_buffer->size() / sizeof(ParsedValueDesc)) -
-        num_cols_ - 1;
-    for (int32_t col_index = 0; col_index < num_cols_; ++col_index) {
+        num_value_cols_ - 1;
+    for (int32_t col_index = 0; col_index < num_value_cols_; ++col_index) {
       auto start = values[start_pos + col_index].offset;
       auto stop = values[start_pos + col_index + 1].offset;
       auto quoted = values[start_pos + col_index + 1].quoted;
@@ -128,6 +139,11 @@ class ARROW_EXPORT DataBatch {
   int32_t num_rows_ = 0;
   // The number of columns
   int32_t num_cols_ = 0;
+  // The number of columns whose values were recorded
+  int32_t num_value_cols_ = 0;
+  // If not empty, the position of each column's values in a row of recorded
+  // values (-1 if the column's values were skipped)
+  std::vector<int32_t> column_slots_;
 
   // XXX should we ensure the parsed buffer is padded with 8 or 16 excess zero bytes?
   // It may help with null parsing...
@@ -164,6 +180,15 @@ class ARROW_EXPORT BlockParser {
                        int64_t first_row = -1, int32_t max_num_rows = kMaxParserNumRows);
   explicit BlockParser(MemoryPool* pool, ParseOptions options, int32_t num_cols = -1,
                        int64_t first_row = -1, int32_t max_num_rows = kMaxParserNumRows);
+  /// \brief Create a parser only recording the values of some columns
+  ///
+  /// `column_indices` are the indices of the columns in the CSV data whose
+  /// values should be recorded.  The fields of other columns are still delimited
+  /// (and counted when checking the number of columns), but their values are
+  /// skipped and cannot be visited.
+  BlockParser(MemoryPool* pool, ParseOptions options, int32_t num_cols,
+              int64_t first_row, int32_t max_num_rows,
+              std::vector<int32_t> column_indices);
   ~BlockParser();
 
   /// \brief Parse a block of data
@@ -205,6 +230,9 @@ class ARROW_EXPORT BlockParser {
 
   /// \brief Visit parsed values in a column
   ///
+  /// If the parser was only asked to record the values of some columns,
+  /// visiting another column returns an error.
+  ///
   /// The signature of the visitor is
   /// Status(const uint8_t* data, uint32_t size, bool quoted)
   template <typename Visitor>
@@ -213,6 +241,9 @@ class ARROW_EXPORT BlockParser {
                                       std::forward<Visitor>(visit));
   }
 
+  /// \brief Visit parsed values in the last row
+  ///
+  /// Only the values of the recorded columns are visited.
   template <typename Visitor>
   Status VisitLastRow(Visitor&& visit) const {
     return parsed_batch().VisitLastRow(std::forward<Visitor>(visit));
@@ -18,9 +18,12 @@
 #include "benchmark/benchmark.h"
 
 #include <memory>
+#include <numeric>
+#include <optional>
 #include <sstream>
 #include <string>
 #include <string_view>
+#include <vector>
 
 #include "arrow/csv/chunker.h"
 #include "arrow/csv/options.h"
@@ -155,10 +158,18 @@ static void ChunkCSVStocksExample(
   BenchmarkCSVChunking(state, stocks_example, options);
 }
 
-static void BenchmarkCSVParsing(benchmark::State& state,  // NOLINT non-const reference
-                                const std::string& csv, int32_t num_rows,
-                                ParseOptions options) {
-  BlockParser parser(options, -1, num_rows + 1);
+static void BenchmarkCSVParsing(
+    benchmark::State& state,  // NOLINT non-const reference
+    const std::string& csv, int32_t num_rows, ParseOptions options,
+    std::optional<std::vector<int32_t>> column_indices = std::nullopt) {
+  auto parser = column_indices.has_value()
+                    ? BlockParser(default_memory_pool(), options, -1, num_rows + 1,
+                                  kMaxParserNumRows, *column_indices)
+                    : BlockParser(options, -1, num_rows + 1);
+  std::vector<int32_t> visited_cols;
+  if (column_indices.has_value()) {
+    visited_cols = *column_indices;
+  }
 
   while (state.KeepRunning()) {
     uint32_t parsed_size = 0;
@@ -173,7 +184,11 @@ static void BenchmarkCSVParsing(benchmark::State& state,  // NOLINT non-const re
       dummy_quoted ^= quoted;
       return Status::OK();
     };
-    for (int32_t col = 0; col < parser.num_cols(); ++col) {
+    if (!column_indices.has_value()) {
+      visited_cols.resize(parser.num_cols());
+      std::iota(visited_cols.begin(), visited_cols.end(), 0);
+    }
+    for (const int32_t col : visited_cols) {
       ABORT_NOT_OK(parser.VisitColumn(col, visit));
       benchmark::DoNotOptimize(dummy_size);
       benchmark::DoNotOptimize(dummy_quoted);
@@ -224,6 +239,42 @@ static void ParseCSVStocksExample(
   BenchmarkCSVParsing(state, stocks_example, ParseOptions::Defaults());
 }
 
+// Parse a 300-column CSV block, only recording the values of some columns
+// (or all of them if the argument is 0)
+static void ParseCSVWideBlock(benchmark::State& state) {  // NOLINT non-const reference
+  constexpr int32_t kNumCols = 300;
+  constexpr int32_t kNumWideRows = 2000;
+  const auto num_selected = static_cast<int32_t>(state.range(0));
+
+  std::stringstream ss;
+  for (int32_t row = 0; row < kNumWideRows; ++row) {
+    for (int32_t col = 0; col < kNumCols; ++col) {
+      switch (col % 3) {
+        case 0:
+          ss << row * col;
+          break;
+        case 1:
+          ss << "abc" << col;
+          break;
+        default:
+          ss << "\"de,f " << row << "\"";
+          break;
+      }
+      ss << (col == kNumCols - 1 ? '\n' : ',');
+    }
+  }
+
+  std::optional<std::vector<int32_t>> column_indices;
+  if (num_selected > 0) {
+    column_indices.emplace();
+    for (int32_t i = 0; i < num_selected; ++i) {
+      column_indices->push_back(i * (kNumCols / num_selected));
+    }
+  }
+  BenchmarkCSVParsing(state, ss.str(), kNumWideRows, ParseOptions::Defaults(),
+                      std::move(column_indices));
+}
+
 BENCHMARK(ChunkCSVQuotedBlock);
 BENCHMARK(ChunkCSVEscapedBlock);
 BENCHMARK(ChunkCSVNoNewlinesBlock);
@@ -236,6 +287,7 @@ BENCHMARK(ParseCSVEscapedBlock);
 BENCHMARK(ParseCSVFlightsExample);
 BENCHMARK(ParseCSVVehiclesExample);
 BENCHMARK(ParseCSVStocksExample);
+BENCHMARK(ParseCSVWideBlock)->ArgName("selected_cols")->Arg(0)->Arg(5)->Arg(50);
 
 }  // namespace csv
 }  // namespace arrow
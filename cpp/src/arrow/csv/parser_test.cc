@@ -17,6 +17,7 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <random>
 #include <sstream>
 #include <string>
 #include <string_view>
@@ -866,6 +867,192 @@ TEST(BlockParser, QuotedEscape) {
   }
 }
 
+// Generate rows spanning many 64-byte blocks, mixing plain and quoted fields
+// with a few irregularly quoted (or escaped) ones, along with the expected
+// column values.
+std::string MakeMixedQuotingCSV(const ParseOptions& options, int32_t num_rows,
+                                int32_t num_cols,
+                                std::vector<std::vector<std::string>>* columns,
+                                std::vector<std::vector<bool>>* quoted) {
+  std::default_random_engine engine(42);
+  auto random_text = [&](const std::string& alphabet, int max_length) {
+    std::string text(engine() % (max_length + 1), ' ');
+    for (auto& c : text) {
+      c = alphabet[engine() % alphabet.size()];
+    }
+    return text;
+  };
+  const std::vector<std::string> line_ends = {"\n", "\r\n", "\r"};
+
+  std::string csv;
+  columns->assign(num_cols, {});
+  quoted->assign(num_cols, {});
+  for (int32_t row = 0; row < num_rows; ++row) {
+    for (int32_t col = 0; col < num_cols; ++col) {
+      std::string field, value;
+      bool is_quoted = false;
+      switch (engine() % 16) {
+        case 0:
+        case 1:
+          // Empty
+          break;
+        case 2:
+          // Quoted empty
+          field = "\"\"";
+          is_quoted = true;
+          break;
+        case 3:
+        case 4:
+        case 5:
+        case 6: {
+          // Quoted, with delimiters, newlines and maybe quotes inside
+          value = random_text(options.double_quote ? "ab ,\r\n\"" : "ab ,\r\n", 40);
+          field = "\"";
+          for (const char c : value) {
+            field += (c == '"') ? "\"\"" : std::string(1, c);
+          }
+          field += "\"";
+          is_quoted = true;
+          break;
+        }
+        case 7:
+          // Quote inside an unquoted field
+          value = "x" + random_text("xyz", 5) + "\"" + random_text("xyz", 5);
+          field = value;
+          break;
+        case 8:
+          // Trailing data after the quoted part of a field
+          value = random_text("xyz", 5) + random_text("xyz", 5);
+          field = "\"" + value.substr(0, value.size() / 2) + "\"" +
+                  value.substr(value.size() / 2);
+          is_quoted = true;
+          break;
+        case 9:
+          if (options.escaping) {
+            // Escaped delimiter
+            value = random_text("xyz", 5) + "," + random_text("xyz", 5);
+            field = value;
+            field.insert(value.find(','), "\\");
+            break;
+          }
+          // fallthrough
+        default:
+          value = random_text("abcdefghij0123456789", 30);
+          field = value;
+          break;
+      }
+      csv += field;
+      csv += (col == num_cols - 1) ? "" : ",";
+      (*columns)[col].push_back(value);
+      (*quoted)[col].push_back(is_quoted);
+    }
+    const auto& line_end = line_ends[engine() % line_ends.size()];
+    csv += line_end;
+    if (engine() % 32 == 0) {
+      // Empty line
+      csv += line_end;
+    }
+  }
+  return csv;
+}
+
+TEST(BlockParser, MixedQuotingLongRows) {
+  for (const bool double_quote : {true, false}) {
+    for (const bool escaping : {false, true}) {
+      ARROW_SCOPED_TRACE("double_quote = ", double_quote, ", escaping = ", escaping);
+      auto options = ParseOptions::Defaults();
+      options.double_quote = double_quote;
+      options.escaping = escaping;
+
+      std::vector<std::vector<std::string>> columns;
+      std::vector<std::vector<bool>> quoted;
+      const auto csv = MakeMixedQuotingCSV(options, /*num_rows=*/1000, /*num_cols=*/5,
+                                           &columns, &quoted);
+      {
+        BlockParser parser(options);
+        AssertParseOk(parser, csv);
+        AssertColumnsEq(parser, columns, quoted);
+      }
+      {
+        // Truncated last row
+        BlockParser parser(options);
+        AssertParsePartial(parser, csv + "\"a,b\",c,d",
+                           static_cast<uint32_t>(csv.size()));
+        AssertColumnsEq(parser, columns, quoted);
+      }
+    }
+  }
+}
+
+TEST(BlockParser, ColumnSelection) {
+  auto csv = MakeCSVData(
+      {"ab,\"c,d\",ef,gh\n", "ij,,kl,\"m\"\"n\"\n", "\n", "op,qr,st,uv\n"});
+  {
+    BlockParser parser(default_memory_pool(), ParseOptions::Defaults(), /*num_cols=*/-1,
+                       /*first_row=*/-1, kMaxParserNumRows, {3, 1});
+    AssertParseOk(parser, csv);
+    ASSERT_EQ(parser.num_rows(), 3);
+    ASSERT_EQ(parser.num_cols(), 4);
+    AssertColumnEq(parser, 1, {"c,d", "", "qr"}, {true, false, false});
+    AssertColumnEq(parser, 3, {"gh", "m\"n", "uv"}, {false, true, false});
+    std::vector<std::string> last_row;
+    GetLastRow(parser, &last_row);
+    ASSERT_EQ(last_row, std::vector<std::string>({"qr", "uv"}));
+    ASSERT_EQ(parser.num_bytes(), 12);
+    for (const int32_t col_index : {0, 2, 4}) {
+      EXPECT_RAISES_WITH_MESSAGE_THAT(
+          Invalid, testing::HasSubstr("was not parsed"),
+          parser.VisitColumn(col_index, [](const uint8_t*, uint32_t, bool) {
+            return Status::OK();
+          }));
+    }
+  }
+  {
+    // No column values recorded
+    BlockParser parser(default_memory_pool(), ParseOptions::Defaults(), /*num_cols=*/4,
+                       /*first_row=*/-1, kMaxParserNumRows, {});
+    AssertParseOk(parser, csv);
+    ASSERT_EQ(parser.num_rows(), 3);
+    ASSERT_EQ(parser.num_bytes(), 0);
+  }
+  {
+    // The number of columns is still checked
+    BlockParser parser(default_memory_pool(), ParseOptions::Defaults(), /*num_cols=*/-1,
+                       /*first_row=*/-1, kMaxParserNumRows, {0});
+    uint32_t out_size;
+    ASSERT_RAISES(Invalid, Parse(parser, MakeCSVData({"a,b\n", "c\n"}), &out_size));
+  }
+  {
+    // Empty lines
+    auto options = ParseOptions::Defaults();
+    options.ignore_empty_lines = false;
+    BlockParser parser(default_memory_pool(), options, /*num_cols=*/-1,
+                       /*first_row=*/-1, kMaxParserNumRows, {1});
+    AssertParseOk(parser, MakeCSVData({"a,b\n", "\n", "c,d\n"}));
+    AssertColumnEq(parser, 1, {"b", "", "d"});
+  }
+}
+
+TEST(BlockParser, ColumnSelectionLongRows) {
+  auto options = ParseOptions::Defaults();
+  std::vector<std::vector<std::string>> columns;
+  std::vector<std::vector<bool>> quoted;
+  const auto csv = MakeMixedQuotingCSV(options, /*num_rows=*/1000, /*num_cols=*/5,
+                                       &columns, &quoted);
+
+  BlockParser parser(default_memory_pool(), options, /*num_cols=*/-1, /*first_row=*/-1,
+                     kMaxParserNumRows, {4, 1, 2});
+  AssertParseOk(parser, csv);
+  uint32_t total_bytes = 0;
+  for (const int32_t col_index : {1, 2, 4}) {
+    AssertColumnEq(parser, col_index, columns[col_index], quoted[col_index]);
+    for (const auto& value : columns[col_index]) {
+      total_bytes += static_cast<uint32_t>(value.size());
+    }
+  }
+  ASSERT_EQ(parser.num_bytes(), total_bytes);
+}
+
 TEST(BlockParser, RowNumberAppendedToError) {
   auto options = ParseOptions::Defaults();
   auto csv = "a,b,c\nd,e,f\ng,h,i\n";
@@ -391,19 +391,27 @@ namespace {
 // This operator is not reentrant
 class BlockParsingOperator {
  public:
+  // If `column_indices` is given, only the values of these CSV columns are parsed
   BlockParsingOperator(io::IOContext io_context, ParseOptions parse_options,
-                       int num_csv_cols, int64_t first_row)
+                       int num_csv_cols, int64_t first_row,
+                       std::optional<std::vector<int32_t>> column_indices = std::nullopt)
       : io_context_(io_context),
         parse_options_(parse_options),
         num_csv_cols_(num_csv_cols),
+        column_indices_(std::move(column_indices)),
         count_rows_(first_row >= 0),
         num_rows_seen_(first_row) {}
 
   // TODO: this is almost entirely the same as ReaderMixin::Parse(). Refactor?
   Result<ParsedBlock> operator()(const CSVBlock& block) {
     constexpr int32_t max_num_rows = std::numeric_limits<int32_t>::max();
-    auto parser = std::make_shared<BlockParser>(
-        io_context_.pool(), parse_options_, num_csv_cols_, num_rows_seen_, max_num_rows);
+    auto parser = column_indices_.has_value()
+                      ? std::make_shared<BlockParser>(io_context_.pool(), parse_options_,
+                                                      num_csv_cols_, num_rows_seen_,
+                                                      max_num_rows, *column_indices_)
+                      : std::make_shared<BlockParser>(io_context_.pool(), parse_options_,
+                                                      num_csv_cols_, num_rows_seen_,
+                                                      max_num_rows);
 
     std::shared_ptr<Buffer> straddling;
     std::vector<std::string_view> views;
@@ -458,6 +466,7 @@ class BlockParsingOperator {
   io::IOContext io_context_;
   const ParseOptions parse_options_;
   const int num_csv_cols_;
+  const std::optional<std::vector<int32_t>> column_indices_;
   const bool count_rows_;
   int64_t num_rows_seen_;
 };
@@ -648,14 +657,30 @@ class ReaderMixin {
 
     int32_t num_csv_cols = static_cast<int32_t>(column_names_.size());
     DCHECK_GT(num_csv_cols, 0);
+    RETURN_NOT_OK(MakeConversionSchema());
     // Since we know the number of columns, we can instantiate the BlockParsingOperator
     parsing_operator_.emplace(io_context_, parse_options_, num_csv_cols,
-                              count_rows_ ? num_rows_seen : -1);
-
-    RETURN_NOT_OK(MakeConversionSchema());
+                              count_rows_ ? num_rows_seen : -1, ParsedColumnIndices());
     return bytes_consumed;
   }
 
+  // The CSV columns whose values need parsing, or nullopt if all of them do
+  std::optional<std::vector<int32_t>> ParsedColumnIndices() const {
+    if (!parse_values_) {
+      return std::vector<int32_t>{};
+    }
+    if (convert_options_.include_columns.empty()) {
+      return std::nullopt;
+    }
+    std::vector<int32_t> column_indices;
+    for (const auto& column : conversion_schema_.columns) {
+      if (!column.is_missing) {
+        column_indices.push_back(column.index);
+      }
+    }
+    return column_indices;
+  }
+
   std::vector<std::string> GenerateColumnNames(int32_t num_cols) {
     std::vector<std::string> res;
     res.reserve(num_cols);
@@ -698,7 +723,8 @@ class ReaderMixin {
 
     if (convert_options_.include_columns.empty()) {
       // Include all columns in CSV file order
-      for (int32_t col_index = 0; col_index < num_csv_cols(); ++col_index) {
+      const auto num_csv_cols = static_cast<int32_t>(column_names_.size());
+      for (int32_t col_index = 0; col_index < num_csv_cols; ++col_index) {
         append_csv_column(column_names_[col_index], col_index);
       }
     } else {
@@ -742,6 +768,8 @@ class ReaderMixin {
   const ConvertOptions convert_options_;
   // Whether to track the number of rows seen in the CSV being parsed
   const bool count_rows_;
+  // Whether parsed values are needed at all (they aren't when only counting rows)
+  bool parse_values_ = true;
 
   std::optional<BlockParsingOperator> parsing_operator_;
 
@@ -850,9 +878,10 @@ class StreamingReaderImpl : public ReaderMixin,
     int max_readahead = cpu_executor->GetCapacity();
     auto self = shared_from_this();
 
-    return buffer_generator().Then([self, buffer_generator, max_readahead](
+    return buffer_generator().Then([self, buffer_generator, cpu_executor, max_readahead](
                                        const std::shared_ptr<Buffer>& first_buffer) {
-      return self->InitAfterFirstBuffer(first_buffer, buffer_generator, max_readahead);
+      return self->InitAfterFirstBuffer(first_buffer, buffer_generator, cpu_executor,
+                                        max_readahead);
     });
   }
 
@@ -873,7 +902,7 @@ class StreamingReaderImpl : public ReaderMixin,
  protected:
   Future<> InitAfterFirstBuffer(const std::shared_ptr<Buffer>& first_buffer,
                                 AsyncGenerator<std::shared_ptr<Buffer>> buffer_generator,
-                                int max_readahead) {
+                                Executor* cpu_executor, int max_readahead) {
     if (first_buffer == nullptr) {
       return Status::Invalid("Empty CSV file");
     }
@@ -887,11 +916,38 @@ class StreamingReaderImpl : public ReaderMixin,
         auto decoder_op,
         BlockDecodingOperator::Make(io_context_, convert_options_, conversion_schema_));
 
-    auto block_gen = SerialBlockReader::MakeAsyncIterator(
-        std::move(buffer_generator), MakeChunker(parse_options_), std::move(after_header),
-        read_options_.skip_rows_after_names);
-    auto parsed_block_gen = MakeMappedGenerator(std::move(block_gen), *parsing_operator_);
-    auto rb_gen = MakeMappedGenerator(std::move(parsed_block_gen), std::move(decoder_op));
+    AsyncGenerator<DecodedBlock> rb_gen;
+    if (count_rows_) {
+      // Each block is parsed after the previous one, to track row numbers
+      auto block_gen = SerialBlockReader::MakeAsyncIterator(
+          std::move(buffer_generator), MakeChunker(parse_options_),
+          std::move(after_header), read_options_.skip_rows_after_names);
+      auto parsed_block_gen =
+          MakeMappedGenerator(std::move(block_gen), *parsing_operator_);
+      rb_gen = MakeMappedGenerator(std::move(parsed_block_gen), std::move(decoder_op));
+    } else {
+      // The chunker delimits whole blocks which are then parsed and decoded
+      // independently, each in a CPU task.  Once readahead is enabled (see
+      // InitFromBlock), several blocks are in flight at once, but they are
+      // still yielded in file order.
+      auto block_gen = ThreadedBlockReader::MakeAsyncIterator(
+          std::move(buffer_generator), MakeChunker(parse_options_),
+          std::move(after_header), read_options_.skip_rows_after_names);
+      auto parse_and_decode =
+          [parsing_operator = *parsing_operator_, decoder_op = std::move(decoder_op),
+           cpu_executor](const CSVBlock& block) -> Future<DecodedBlock> {
+            // Without row counting, the parsing operator has no state to share
+            // between blocks and can be copied for each of them
+            auto parse_block = [parsing_operator, block]() mutable {
+              return parsing_operator(block);
+            };
+            return DeferNotOk(cpu_executor->Submit(std::move(parse_block)))
+                .Then([decoder_op](const ParsedBlock& parsed_block) mutable {
+                  return decoder_op(parsed_block);
+                });
+          };
+      rb_gen = MakeMappedGenerator(std::move(block_gen), std::move(parse_and_decode));
+    }
 
     auto self = shared_from_this();
     return rb_gen().Then([self, rb_gen, max_readahead](const DecodedBlock& first_block) {
@@ -899,6 +955,8 @@ class StreamingReaderImpl : public ReaderMixin,
     });
   }
 
+  // Blocks are decoded one at a time until the first non-empty one, so that
+  // column types are inferred from the first rows of the file.
   Future<> InitFromBlock(const DecodedBlock& block,
                          AsyncGenerator<DecodedBlock> batch_gen, int max_readahead,
                          int64_t prev_bytes_processed) {
@@ -1132,10 +1190,13 @@ Future<std::shared_ptr<StreamingReader>> MakeStreamingReader(
   RETURN_NOT_OK(parse_options.Validate());
   RETURN_NOT_OK(read_options.Validate());
   RETURN_NOT_OK(convert_options.Validate());
+  // Blocks are parsed in parallel when threads are used, in which case
+  // row numbers cannot be tracked
+  const bool parallel = read_options.use_threads && cpu_executor->GetCapacity() > 1;
   std::shared_ptr<StreamingReaderImpl> reader;
-  reader = std::make_shared<StreamingReaderImpl>(
-      io_context, input, read_options, parse_options, convert_options,
-      /*count_rows=*/!read_options.use_threads || cpu_executor->GetCapacity() == 1);
+  reader = std::make_shared<StreamingReaderImpl>(io_context, input, read_options,
+                                                 parse_options, convert_options,
+                                                 /*count_rows=*/!parallel);
   return reader->Init(cpu_executor).Then([reader] {
     return std::dynamic_pointer_cast<StreamingReader>(reader);
   });
@@ -1153,7 +1214,9 @@ class CSVRowCounter : public ReaderMixin,
       : ReaderMixin(io_context, std::move(input), read_options, parse_options,
                     ConvertOptions::Defaults(), /*count_rows=*/true),
         cpu_executor_(cpu_executor),
-        row_count_(0) {}
+        row_count_(0) {
+    parse_values_ = false;
+  }
 
   Future<int64_t> Count() {
     auto self = shared_from_this();
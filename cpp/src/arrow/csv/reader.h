@@ -56,8 +56,15 @@ class ARROW_EXPORT TableReader {
 
 /// \brief A class that reads a CSV file incrementally
 ///
+/// If `ReadOptions::use_threads` is true, several blocks are parsed and
+/// converted in parallel on the CPU executor.  Batches are still yielded in
+/// file order, and the number of blocks in flight is bounded by the executor's
+/// capacity.
+///
 /// Caveats:
-/// - For now, this is always single-threaded (regardless of `ReadOptions::use_threads`.
+/// - When blocks are processed in parallel, row numbers are not tracked (they
+///   are reported as -1 to the `InvalidRowHandler`, which may be called
+///   concurrently from several threads).
 /// - Type inference is done on the first block and types are frozen afterwards;
 ///   to make sure the right data types are inferred, either set
 ///   `ReadOptions::block_size` to a large enough value, or use
@@ -88,8 +95,7 @@ class ARROW_EXPORT StreamingReader : public RecordBatchReader {
   /// This involves some I/O as the first batch must be loaded during the creation process
   /// so it is returned as a future
   ///
-  /// Currently, the StreamingReader is not async-reentrant and does not do any fan-out
-  /// parsing (see ARROW-11889)
+  /// Currently, the StreamingReader is not async-reentrant
   static Future<std::shared_ptr<StreamingReader>> MakeAsync(
       io::IOContext io_context, std::shared_ptr<io::InputStream> input,
       arrow::internal::Executor* cpu_executor, const ReadOptions&, const ParseOptions&,
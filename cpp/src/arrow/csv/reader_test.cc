@@ -436,6 +436,43 @@ TEST(StreamingReaderTests, SkipMultipleEmptyBlocksAtStart) {
   ASSERT_EQ(nullptr, batch.get());
 }
 
+TEST(StreamingReaderTests, ParallelBlocksInFileOrder) {
+  ASSERT_OK_AND_ASSIGN(auto thread_pool, internal::ThreadPool::Make(8));
+  std::string csv = "a,b,c\n";
+  for (int i = 0; i < 5000; ++i) {
+    csv += std::to_string(i) + ",\"x," + std::to_string(i % 7) + "\"," +
+           (i % 3 ? "1.5" : "") + "\n";
+  }
+  auto table_buffer = Buffer::FromString(csv);
+
+  auto read_table = [&](bool use_threads,
+                        int64_t* num_batches) -> Result<std::shared_ptr<Table>> {
+    auto input = std::make_shared<io::BufferReader>(table_buffer);
+    auto read_options = ReadOptions::Defaults();
+    read_options.block_size = 1000;
+    read_options.use_threads = use_threads;
+    ARROW_ASSIGN_OR_RAISE(
+        auto streaming_reader,
+        StreamingReader::MakeAsync(io::default_io_context(), input, thread_pool.get(),
+                                   read_options, ParseOptions::Defaults(),
+                                   ConvertOptions::Defaults())
+            .result());
+    RecordBatchVector batches;
+    ARROW_ASSIGN_OR_RAISE(batches, streaming_reader->ToRecordBatches());
+    *num_batches = static_cast<int64_t>(batches.size());
+    EXPECT_EQ(table_buffer->size(), streaming_reader->bytes_read());
+    return Table::FromRecordBatches(streaming_reader->schema(), batches);
+  };
+
+  int64_t num_serial_batches = 0, num_parallel_batches = 0;
+  ASSERT_OK_AND_ASSIGN(auto expected, read_table(false, &num_serial_batches));
+  ASSERT_OK_AND_ASSIGN(auto actual, read_table(true, &num_parallel_batches));
+  ASSERT_GT(num_parallel_batches, 50);
+  ASSERT_EQ(5000, actual->num_rows());
+  AssertSchemaEqual(*expected->schema(), *actual->schema());
+  AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+}
+
 TEST(CountRowsAsync, Basics) {
   constexpr int NROWS = 4096;
   ASSERT_OK_AND_ASSIGN(auto table_buffer, MakeSampleCsvBuffer(NROWS));
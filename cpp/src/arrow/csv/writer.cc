@@ -23,11 +23,14 @@
 #include "arrow/record_batch.h"
 #include "arrow/result.h"
 #include "arrow/stl_allocator.h"
+#include "arrow/util/formatting.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/sliced_writer_internal.h"
 #include "arrow/visit_data_inline.h"
 #include "arrow/visit_type_inline.h"
 
+#include <algorithm>
 #include <memory>
 
 #if defined(ARROW_HAVE_NEON) || defined(ARROW_HAVE_SSE4_2)
@@ -37,6 +40,8 @@
 namespace arrow {
 
 using internal::checked_pointer_cast;
+using internal::SlicedWriter;
+using internal::SliceEncoder;
 
 namespace csv {
 // This implementation is intentionally light on configurability to minimize the size of
@@ -46,16 +51,18 @@ namespace csv {
 // The algorithm used here at a high level is to break RecordBatches/Tables into slices
 // and convert each slice independently.  A slice is then converted to CSV by first
 // scanning each column to determine the size of its contents when rendered as a string in
-// CSV. For non-string types this requires casting the value to string (which is cached).
-// This data is used to understand the precise length of each row and a single allocation
-// for the final CSV data buffer. Once the final size is known each column is then
-// iterated over again to place its contents into the CSV data buffer. The rationale for
-// choosing this approach is it allows for reuse of the cast functionality in the compute
-// module and inline data visiting functionality in the core library. A performance
-// comparison has not been done using a naive single-pass approach. This approach might
-// still be competitive due to reduction in the number of per row branches necessary with
-// a single pass approach. Profiling would likely yield further opportunities for
-// optimization with this approach.
+// CSV. Numeric and temporal values are rendered with the same formatters the cast
+// kernels use, directly into a per-column scratch buffer; other non-string types are
+// cast to string (which is cached). This data is used to understand the precise length
+// of each row and a single allocation for the final CSV data buffer. Once the final size
+// is known each column is then iterated over again to place its contents into the CSV
+// data buffer. The rationale for choosing this approach is it allows for reuse of the
+// formatting and cast functionality and inline data visiting functionality in the core
+// library.
+//
+// Since slices are independent, several of them can be converted at once when
+// WriteOptions::use_threads is set. Each in-flight slice has its own populators and
+// output buffer, and the resulting buffers are written to the sink in slice order.
 
 namespace {
 
@@ -78,26 +85,6 @@ void CopyEndChars(char* dest, const char* src, size_t size) {
   }
 }
 
-struct SliceIteratorFunctor {
-  Result<std::shared_ptr<RecordBatch>> Next() {
-    if (current_offset < batch->num_rows()) {
-      std::shared_ptr<RecordBatch> next = batch->Slice(current_offset, slice_size);
-      current_offset += slice_size;
-      return next;
-    }
-    return IterationTraits<std::shared_ptr<RecordBatch>>::End();
-  }
-  const RecordBatch* const batch;
-  const int64_t slice_size;
-  int64_t current_offset;
-};
-
-RecordBatchIterator RecordBatchSliceIterator(const RecordBatch& batch,
-                                             int64_t slice_size) {
-  SliceIteratorFunctor functor = {&batch, slice_size, /*offset=*/static_cast<int64_t>(0)};
-  return RecordBatchIterator(std::move(functor));
-}
-
 // Counts the number of quotes in s.
 int64_t CountQuotes(std::string_view s) {
   return static_cast<int64_t>(std::count(s.begin(), s.end(), '"'));
@@ -112,17 +99,38 @@ constexpr int64_t kQuoteDelimiterCount = kQuoteCount + /*end_char*/ 1;
 // then PopulateRows.
 class ColumnPopulator {
  public:
-  ColumnPopulator(MemoryPool* pool, std::string end_chars,
-                  std::shared_ptr<Buffer> null_string)
-      : end_chars_(std::move(end_chars)),
-        null_string_(std::move(null_string)),
-        pool_(pool) {}
+  ColumnPopulator(std::string end_chars, std::shared_ptr<Buffer> null_string)
+      : end_chars_(std::move(end_chars)), null_string_(std::move(null_string)) {}
 
   virtual ~ColumnPopulator() = default;
 
   // Adds the number of characters each entry in data will add to to elements
   // in row_lengths.
-  Status UpdateRowLengths(const Array& data, int64_t* row_lengths) {
+  virtual Status UpdateRowLengths(const Array& data, int64_t* row_lengths) = 0;
+
+  // Places string data onto each row in output and updates the corresponding row
+  // pointers in preparation for calls to other (next) ColumnPopulators.
+  // Implementations may apply certain checks e.g. for illegal values, which in case of
+  // failure causes this function to return an error Status.
+  // Args:
+  //   output: character buffer to write to.
+  //   offsets: an array of start of row column within the output buffer.
+  virtual Status PopulateRows(char* output, int64_t* offsets) const = 0;
+
+ protected:
+  const std::string end_chars_;
+  std::shared_ptr<Buffer> null_string_;
+};
+
+// Base class for populators which cast the column to string before measuring and
+// copying the values.
+class CastingColumnPopulator : public ColumnPopulator {
+ public:
+  CastingColumnPopulator(MemoryPool* pool, std::string end_chars,
+                         std::shared_ptr<Buffer> null_string)
+      : ColumnPopulator(std::move(end_chars), std::move(null_string)), pool_(pool) {}
+
+  Status UpdateRowLengths(const Array& data, int64_t* row_lengths) final {
     compute::ExecContext ctx(pool_);
     // Populators are intented to be applied to reasonably small data.  In most cases
     // threading overhead would not be justified.
@@ -141,24 +149,14 @@ class ColumnPopulator {
         return casted.status();
       }
     }
-    return UpdateRowLengths(row_lengths);
+    return UpdateCastRowLengths(row_lengths);
   }
 
-  // Places string data onto each row in output and updates the corresponding row
-  // pointers in preparation for calls to other (next) ColumnPopulators.
-  // Implementations may apply certain checks e.g. for illegal values, which in case of
-  // failure causes this function to return an error Status.
-  // Args:
-  //   output: character buffer to write to.
-  //   offsets: an array of start of row column within the output buffer.
-  virtual Status PopulateRows(char* output, int64_t* offsets) const = 0;
-
  protected:
-  virtual Status UpdateRowLengths(int64_t* row_lengths) = 0;
+  // Same as UpdateRowLengths, for the values of array_.
+  virtual Status UpdateCastRowLengths(int64_t* row_lengths) = 0;
   // It must be a `StringArray` or `LargeStringArray`.
   std::shared_ptr<Array> array_;
-  const std::string end_chars_;
-  std::shared_ptr<Buffer> null_string_;
 
  private:
   MemoryPool* const pool_;
@@ -181,27 +179,28 @@ char* Escape(std::string_view s, char* out) {
 // This is enforced by setting reject_values_with_quotes to true, in which case a check
 // for quotes is applied and will cause populating the columns to fail. This guarantees
 // compliance with RFC4180 section 2.5.
-class UnquotedColumnPopulator : public ColumnPopulator {
+class UnquotedColumnPopulator : public CastingColumnPopulator {
  public:
   explicit UnquotedColumnPopulator(MemoryPool* memory_pool, std::string end_chars,
                                    char delimiter, std::shared_ptr<Buffer> null_string_,
                                    bool reject_values_with_quotes)
-      : ColumnPopulator(memory_pool, std::move(end_chars), std::move(null_string_)),
+      : CastingColumnPopulator(memory_pool, std::move(end_chars),
+                               std::move(null_string_)),
         delimiter_(delimiter),
         reject_values_with_quotes_(reject_values_with_quotes) {}
 
-  Status UpdateRowLengths(int64_t* row_lengths) override {
+  Status UpdateCastRowLengths(int64_t* row_lengths) override {
     if (ARROW_PREDICT_TRUE(array_->type_id() == Type::STRING)) {
-      return UpdateRowLengths<StringArray>(row_lengths);
+      return UpdateCastRowLengths<StringArray>(row_lengths);
     } else if (ARROW_PREDICT_TRUE(array_->type_id() == Type::LARGE_STRING)) {
-      return UpdateRowLengths<LargeStringArray>(row_lengths);
+      return UpdateCastRowLengths<LargeStringArray>(row_lengths);
     } else {
       return Status::TypeError("The array must be StringArray or LargeStringArray.");
     }
   }
 
   template <typename StringArrayType>
-  Status UpdateRowLengths(int64_t* row_lengths) {
+  Status UpdateCastRowLengths(int64_t* row_lengths) {
     auto casted_array = checked_pointer_cast<StringArrayType>(array_);
     if (reject_values_with_quotes_) {
       // When working on values that, after casting, could produce quotes,
@@ -310,24 +309,24 @@ class UnquotedColumnPopulator : public ColumnPopulator {
 // This class handles escaping assuming that all strings will be quoted
 // and that the only character within the string that needs to escaped is
 // a quote character (") and escaping is done by adding another quote.
-class QuotedColumnPopulator : public ColumnPopulator {
+class QuotedColumnPopulator : public CastingColumnPopulator {
  public:
   QuotedColumnPopulator(MemoryPool* pool, std::string end_chars,
                         std::shared_ptr<Buffer> null_string)
-      : ColumnPopulator(pool, std::move(end_chars), std::move(null_string)) {}
+      : CastingColumnPopulator(pool, std::move(end_chars), std::move(null_string)) {}
 
-  Status UpdateRowLengths(int64_t* row_lengths) override {
+  Status UpdateCastRowLengths(int64_t* row_lengths) override {
     if (ARROW_PREDICT_TRUE(array_->type_id() == Type::STRING)) {
-      return UpdateRowLengths<StringArray>(row_lengths);
+      return UpdateCastRowLengths<StringArray>(row_lengths);
     } else if (ARROW_PREDICT_TRUE(array_->type_id() == Type::LARGE_STRING)) {
-      return UpdateRowLengths<LargeStringArray>(row_lengths);
+      return UpdateCastRowLengths<LargeStringArray>(row_lengths);
     } else {
       return Status::TypeError("The array must be StringArray or LargeStringArray.");
     }
   }
 
   template <typename StringArrayType>
-  Status UpdateRowLengths(int64_t* row_lengths) {
+  Status UpdateCastRowLengths(int64_t* row_lengths) {
     auto casted_array = checked_pointer_cast<StringArrayType>(array_);
     const StringArrayType& input = *casted_array;
 
@@ -426,14 +425,120 @@ class QuotedColumnPopulator : public ColumnPopulator {
   std::vector<bool> row_needs_escaping_;
 };
 
+// Populator for numeric and temporal types, which renders values with the same
+// StringFormatter as the cast to string kernels but without materializing a string
+// array. Formatted values are kept in a scratch buffer between UpdateRowLengths and
+// PopulateRows. They never contain quotes or line endings, so they are only quoted
+// (never escaped) when all valid values must be quoted.
+template <typename T>
+class FormattedColumnPopulator : public ColumnPopulator {
+ public:
+  using value_type = typename TypeTraits<T>::CType;
+
+  FormattedColumnPopulator(const DataType& type, std::string end_chars,
+                           std::shared_ptr<Buffer> null_string, bool quote_values)
+      : ColumnPopulator(std::move(end_chars), std::move(null_string)),
+        formatter_(&type),
+        quote_values_(quote_values) {}
+
+  Status UpdateRowLengths(const Array& data, int64_t* row_lengths) override {
+    data_ = data.data();
+    formatted_.clear();
+    value_ends_.clear();
+    value_ends_.reserve(static_cast<size_t>(data.length()));
+    const int64_t quote_count = quote_values_ ? kQuoteCount : 0;
+    int64_t row_number = 0;
+    return VisitArraySpanInline<T>(
+        *data_,
+        [&](value_type v) {
+          return formatter_(v, [&](std::string_view s) {
+            formatted_.append(s.data(), s.length());
+            value_ends_.push_back(static_cast<int64_t>(formatted_.size()));
+            row_lengths[row_number++] += static_cast<int64_t>(s.length()) + quote_count;
+            return Status::OK();
+          });
+        },
+        [&]() {
+          value_ends_.push_back(static_cast<int64_t>(formatted_.size()));
+          row_lengths[row_number++] += static_cast<int64_t>(null_string_->size());
+          return Status::OK();
+        });
+  }
+
+  Status PopulateRows(char* output, int64_t* offsets) const override {
+    auto value_end = value_ends_.begin();
+    int64_t value_start = 0;
+    VisitArraySpanInline<T>(
+        *data_,
+        [&](value_type) {
+          char* row = output + *offsets;
+          if (quote_values_) {
+            *row++ = '"';
+          }
+          memcpy(row, formatted_.data() + value_start, *value_end - value_start);
+          row += *value_end - value_start;
+          if (quote_values_) {
+            *row++ = '"';
+          }
+          CopyEndChars(row, end_chars_.data(), end_chars_.length());
+          row += end_chars_.length();
+          *offsets = static_cast<int64_t>(row - output);
+          offsets++;
+          value_start = *value_end++;
+        },
+        [&]() {
+          // For nulls, the configured null value string is copied into the output.
+          memcpy(output + *offsets, null_string_->data(), null_string_->size());
+          CopyEndChars(output + *offsets + null_string_->size(), end_chars_.c_str(),
+                       end_chars_.size());
+          *offsets += static_cast<int64_t>(null_string_->size() + end_chars_.size());
+          offsets++;
+          value_end++;
+        });
+    return Status::OK();
+  }
+
+ private:
+  arrow::internal::StringFormatter<T> formatter_;
+  const bool quote_values_;
+  std::shared_ptr<ArrayData> data_;
+  // Formatted valid values, back to back, and the end offset of each entry in
+  // formatted_ (nulls take no space).
+  std::string formatted_;
+  std::vector<int64_t> value_ends_;
+};
+
+// Types which FormattedColumnPopulator can render.
+template <typename Type>
+constexpr bool kIsDirectlyFormatted =
+    is_number_type<Type>::value || is_boolean_type<Type>::value ||
+    is_date_type<Type>::value || is_time_type<Type>::value ||
+    is_duration_type<Type>::value || std::is_same<Type, TimestampType>::value;
+
+// `format_directly` is false for dictionary values: FormattedColumnPopulator reads
+// the values of the array it is given, and the casting populators unpack
+// dictionaries.
 Result<std::unique_ptr<ColumnPopulator>> MakePopulator(
     const DataType& type, const std::string& end_chars, const char delimiter,
     const std::shared_ptr<Buffer>& null_string, QuotingStyle quoting_style,
-    MemoryPool* pool) {
+    MemoryPool* pool, bool format_directly = true) {
   auto make_populator =
       [&](const auto& type) -> Result<std::unique_ptr<ColumnPopulator>> {
     using Type = std::decay_t<decltype(type)>;
 
+    if constexpr (kIsDirectlyFormatted<Type>) {
+      bool has_timezone = false;
+      if constexpr (std::is_same<Type, TimestampType>::value) {
+        has_timezone = !type.timezone().empty();
+      }
+      // Time zone aware timestamps are left to the cast, which applies the zone.
+      if (format_directly && !has_timezone) {
+        return std::make_unique<FormattedColumnPopulator<Type>>(
+            type, end_chars, null_string,
+            /*quote_values=*/quoting_style == QuotingStyle::AllValid);
+      }
+    }
+
     if constexpr (is_primitive_ctype<Type>::value || is_decimal_type<Type>::value ||
                   is_null_type<Type>::value || is_temporal_type<Type>::value) {
       switch (quoting_style) {
@@ -473,7 +578,7 @@ Result<std::unique_ptr<ColumnPopulator>> MakePopulator(
 
     if constexpr (std::is_same<Type, DictionaryType>::value) {
       return MakePopulator(*type.value_type(), end_chars, delimiter, null_string,
-                           quoting_style, pool);
+                           quoting_style, pool, /*format_directly=*/false);
     }
 
     return Status::Invalid("Unsupported Type:", type.ToString());
@@ -489,6 +594,67 @@ Result<std::unique_ptr<ColumnPopulator>> MakePopulator(
                        pool);
 }
 
+// Converts slices of record batches to CSV data in a reusable buffer.
+class SliceTranslator : public SliceEncoder {
+ public:
+  SliceTranslator(std::vector<std::unique_ptr<ColumnPopulator>> populators,
+                  std::shared_ptr<ResizableBuffer> data_buffer,
+                  const WriteOptions& options)
+      : column_populators_(std::move(populators)),
+        offsets_(0, 0, ::arrow::stl::allocator<char*>(options.io_context.pool())),
+        data_buffer_(std::move(data_buffer)),
+        eol_size_(static_cast<int32_t>(options.eol.size())) {}
+
+  // Renders batch into the data buffer, replacing its previous contents.
+  Status Encode(const RecordBatch& batch) override {
+    if (batch.num_rows() == 0) {
+      return data_buffer_->Resize(0, /*shrink_to_fit=*/false);
+    }
+    offsets_.resize(batch.num_rows());
+    std::fill(offsets_.begin(), offsets_.end(), 0);
+
+    // Calculate relative offsets for each row (excluding delimiters)
+    for (int32_t col = 0; col < static_cast<int32_t>(column_populators_.size()); col++) {
+      RETURN_NOT_OK(
+          column_populators_[col]->UpdateRowLengths(*batch.column(col), offsets_.data()));
+    }
+    // Calculate cumulative offsets for each row (including delimiters).
+    // - before conversion: offsets_[i] = length of i-th row
+    // - after conversion:  offsets_[i] = offset to the starting of i-th row buffer
+    //   - offsets_[0] = 0
+    //   - offsets_[i] = offsets_[i-1] + len(i-1-th row) + len(delimiters)
+    // Delimiters: ',' * (num_columns - 1) + eol
+    const int32_t delimiters_length = batch.num_columns() - 1 + eol_size_;
+    int64_t last_row_length = offsets_[0] + delimiters_length;
+    offsets_[0] = 0;
+    for (size_t row = 1; row < offsets_.size(); ++row) {
+      const int64_t this_row_length = offsets_[row] + delimiters_length;
+      offsets_[row] = offsets_[row - 1] + last_row_length;
+      last_row_length = this_row_length;
+    }
+    // Resize the target buffer to required size. We assume batch to batch sizes
+    // should be pretty close so don't shrink the buffer to avoid allocation churn.
+    RETURN_NOT_OK(
+        data_buffer_->Resize(offsets_.back() + last_row_length, /*shrink_to_fit=*/false));
+
+    // Use the offsets to populate contents.
+    for (auto& populator : column_populators_) {
+      RETURN_NOT_OK(populator->PopulateRows(
+          reinterpret_cast<char*>(data_buffer_->mutable_data()), offsets_.data()));
+    }
+    DCHECK_EQ(data_buffer_->size(), offsets_.back());
+    return Status::OK();
+  }
+
+  Status WriteTo(io::OutputStream* sink) override { return sink->Write(data_buffer_); }
+
+ private:
+  std::vector<std::unique_ptr<ColumnPopulator>> column_populators_;
+  std::vector<int64_t, arrow::stl::allocator<int64_t>> offsets_;
+  std::shared_ptr<ResizableBuffer> data_buffer_;
+  const int32_t eol_size_;
+};
+
 class CSVWriterImpl : public ipc::RecordBatchWriter {
  public:
   static Result<std::shared_ptr<CSVWriterImpl>> Make(
@@ -505,19 +671,30 @@ class CSVWriterImpl : public ipc::RecordBatchWriter {
     memcpy(null_string->mutable_data(), options.null_string.data(),
            options.null_string.length());
 
-    std::vector<std::unique_ptr<ColumnPopulator>> populators(schema->num_fields());
+    // One translator per slice converted concurrently.
+    const int num_translators = SlicedWriter::NumEncoders(options.use_threads);
+    std::vector<std::unique_ptr<SliceEncoder>> translators;
     std::string delimiter(1, options.delimiter);
-    for (int col = 0; col < schema->num_fields(); col++) {
-      const std::string& end_chars =
-          col < schema->num_fields() - 1 ? delimiter : options.eol;
+    for (int i = 0; i < num_translators; i++) {
+      std::vector<std::unique_ptr<ColumnPopulator>> populators(schema->num_fields());
+      for (int col = 0; col < schema->num_fields(); col++) {
+        const std::string& end_chars =
+            col < schema->num_fields() - 1 ? delimiter : options.eol;
+        ARROW_ASSIGN_OR_RAISE(
+            populators[col],
+            MakePopulator(*schema->field(col), end_chars, options.delimiter,
+                          null_string, options.quoting_style, options.io_context.pool()));
+      }
       ARROW_ASSIGN_OR_RAISE(
-          populators[col],
-          MakePopulator(*schema->field(col), end_chars, options.delimiter, null_string,
-                        options.quoting_style, options.io_context.pool()));
+          std::shared_ptr<ResizableBuffer> data_buffer,
+          AllocateResizableBuffer(
+              options.batch_size * schema->num_fields() * kColumnSizeGuess,
+              options.io_context.pool()));
+      translators.push_back(std::make_unique<SliceTranslator>(
+          std::move(populators), std::move(data_buffer), options));
     }
     auto writer = std::make_shared<CSVWriterImpl>(
-        sink, std::move(owned_sink), std::move(schema), std::move(populators), options);
-    RETURN_NOT_OK(writer->PrepareForContentsWrite());
+        sink, std::move(owned_sink), std::move(schema), std::move(translators), options);
     if (options.include_header) {
       RETURN_NOT_OK(writer->WriteHeader());
     }
@@ -525,28 +702,14 @@ class CSVWriterImpl : public ipc::RecordBatchWriter {
   }
 
   Status WriteRecordBatch(const RecordBatch& batch) override {
-    RecordBatchIterator iterator = RecordBatchSliceIterator(batch, options_.batch_size);
-    for (auto maybe_slice : iterator) {
-      ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> slice, maybe_slice);
-      RETURN_NOT_OK(TranslateMinimalBatch(*slice));
-      RETURN_NOT_OK(sink_->Write(data_buffer_));
-      stats_.num_record_batches++;
-    }
+    RETURN_NOT_OK(sliced_writer_.WriteRecordBatch(batch));
+    stats_.num_record_batches = sliced_writer_.num_slices_written();
     return Status::OK();
   }
 
   Status WriteTable(const Table& table, int64_t max_chunksize) override {
-    TableBatchReader reader(table);
-    reader.set_chunksize(max_chunksize > 0 ? max_chunksize : options_.batch_size);
-    std::shared_ptr<RecordBatch> batch;
-    RETURN_NOT_OK(reader.ReadNext(&batch));
-    while (batch != nullptr) {
-      RETURN_NOT_OK(TranslateMinimalBatch(*batch));
-      RETURN_NOT_OK(sink_->Write(data_buffer_));
-      RETURN_NOT_OK(reader.ReadNext(&batch));
-      stats_.num_record_batches++;
-    }
-
+    RETURN_NOT_OK(sliced_writer_.WriteTable(table, max_chunksize));
+    stats_.num_record_batches = sliced_writer_.num_slices_written();
     return Status::OK();
   }
 
@@ -556,28 +719,16 @@ class CSVWriterImpl : public ipc::RecordBatchWriter {
 
   CSVWriterImpl(io::OutputStream* sink, std::shared_ptr<io::OutputStream> owned_sink,
                 std::shared_ptr<Schema> schema,
-                std::vector<std::unique_ptr<ColumnPopulator>> populators,
+                std::vector<std::unique_ptr<SliceEncoder>> translators,
                 const WriteOptions& options)
       : sink_(sink),
         owned_sink_(std::move(owned_sink)),
-        column_populators_(std::move(populators)),
-        offsets_(0, 0, ::arrow::stl::allocator<char*>(options.io_context.pool())),
+        sliced_writer_(sink, std::move(translators), options.batch_size,
+                       options.use_threads),
         schema_(std::move(schema)),
         options_(options) {}
 
  private:
-  Status PrepareForContentsWrite() {
-    // Only called once, as part of initialization
-    if (data_buffer_ == nullptr) {
-      ARROW_ASSIGN_OR_RAISE(
-          data_buffer_,
-          AllocateResizableBuffer(
-              options_.batch_size * schema_->num_fields() * kColumnSizeGuess,
-              options_.io_context.pool()));
-    }
-    return Status::OK();
-  }
-
   int64_t CalculateHeaderSize() const {
     int64_t header_length = 0;
     for (int col = 0; col < schema_->num_fields(); col++) {
@@ -592,8 +743,10 @@ class CSVWriterImpl : public ipc::RecordBatchWriter {
 
   Status WriteHeader() {
     // Only called once, as part of initialization
-    RETURN_NOT_OK(data_buffer_->Resize(CalculateHeaderSize(), /*shrink_to_fit=*/false));
-    char* next = reinterpret_cast<char*>(data_buffer_->mutable_data());
+    ARROW_ASSIGN_OR_RAISE(
+        std::shared_ptr<Buffer> header,
+        AllocateBuffer(CalculateHeaderSize(), options_.io_context.pool()));
+    char* next = reinterpret_cast<char*>(header->mutable_data());
     for (int col = 0; col < schema_->num_fields(); ++col) {
       *next++ = '"';
       next = Escape(schema_->field(col)->name(), next);
@@ -604,58 +757,14 @@ class CSVWriterImpl : public ipc::RecordBatchWriter {
     }
     memcpy(next, options_.eol.data(), options_.eol.size());
     next += options_.eol.size();
-    DCHECK_EQ(reinterpret_cast<uint8_t*>(next),
-              data_buffer_->data() + data_buffer_->size());
-    return sink_->Write(data_buffer_);
-  }
-
-  Status TranslateMinimalBatch(const RecordBatch& batch) {
-    if (batch.num_rows() == 0) {
-      return Status::OK();
-    }
-    offsets_.resize(batch.num_rows());
-    std::fill(offsets_.begin(), offsets_.end(), 0);
-
-    // Calculate relative offsets for each row (excluding delimiters)
-    for (int32_t col = 0; col < static_cast<int32_t>(column_populators_.size()); col++) {
-      RETURN_NOT_OK(
-          column_populators_[col]->UpdateRowLengths(*batch.column(col), offsets_.data()));
-    }
-    // Calculate cumulative offsets for each row (including delimiters).
-    // - before conversion: offsets_[i] = length of i-th row
-    // - after conversion:  offsets_[i] = offset to the starting of i-th row buffer
-    //   - offsets_[0] = 0
-    //   - offsets_[i] = offsets_[i-1] + len(i-1-th row) + len(delimiters)
-    // Delimiters: ',' * (num_columns - 1) + eol
-    const int32_t delimiters_length =
-        static_cast<int32_t>(batch.num_columns() - 1 + options_.eol.size());
-    int64_t last_row_length = offsets_[0] + delimiters_length;
-    offsets_[0] = 0;
-    for (size_t row = 1; row < offsets_.size(); ++row) {
-      const int64_t this_row_length = offsets_[row] + delimiters_length;
-      offsets_[row] = offsets_[row - 1] + last_row_length;
-      last_row_length = this_row_length;
-    }
-    // Resize the target buffer to required size. We assume batch to batch sizes
-    // should be pretty close so don't shrink the buffer to avoid allocation churn.
-    RETURN_NOT_OK(
-        data_buffer_->Resize(offsets_.back() + last_row_length, /*shrink_to_fit=*/false));
-
-    // Use the offsets to populate contents.
-    for (auto& populator : column_populators_) {
-      RETURN_NOT_OK(populator->PopulateRows(
-          reinterpret_cast<char*>(data_buffer_->mutable_data()), offsets_.data()));
-    }
-    DCHECK_EQ(data_buffer_->size(), offsets_.back());
-    return Status::OK();
+    DCHECK_EQ(reinterpret_cast<uint8_t*>(next), header->data() + header->size());
+    return sink_->Write(header);
   }
 
   static constexpr int64_t kColumnSizeGuess = 8;
   io::OutputStream* sink_;
   std::shared_ptr<io::OutputStream> owned_sink_;
-  std::vector<std::unique_ptr<ColumnPopulator>> column_populators_;
-  std::vector<int64_t, arrow::stl::allocator<int64_t>> offsets_;
-  std::shared_ptr<ResizableBuffer> data_buffer_;
+  SlicedWriter sliced_writer_;
   const std::shared_ptr<Schema> schema_;
   const WriteOptions options_;
   ipc::WriteStats stats_;
@@ -55,6 +55,21 @@ std::shared_ptr<RecordBatch> MakeIntTestBatch(int rows, int cols, int64_t null_p
   return RecordBatch::Make(schema(fields), rows, arrays);
 }
 
+std::shared_ptr<RecordBatch> MakeTimestampTestBatch(int rows, int cols,
+                                                    int64_t null_percent) {
+  random::RandomArrayGenerator rg(kSeed + 2);
+
+  auto type = timestamp(TimeUnit::MICRO);
+  FieldVector fields(cols);
+  ArrayVector arrays(cols);
+  for (int i = 0; i < cols; ++i) {
+    fields[i] = field('t' + std::to_string(i), type);
+    // 1970-01-01 to 2096-10-02
+    arrays[i] = *rg.Int64(rows, 0, 4000000000000000LL, null_percent / 100.)->View(type);
+  }
+  return RecordBatch::Make(schema(fields), rows, arrays);
+}
+
 std::shared_ptr<RecordBatch> MakeStrTestBatch(int rows, int cols, bool quote,
                                               int64_t null_percent) {
   random::RandomArrayGenerator rg(kSeed + 1);
@@ -110,7 +125,7 @@ void BenchmarkWriteCsv(benchmark::State& state, const WriteOptions& options,
   state.counters["null_percent"] = static_cast<double>(state.range(0));
 }
 
-// Exercises UnQuotedColumnPopulator with integer
+// Exercises FormattedColumnPopulator with integer
 void WriteCsvNumeric(benchmark::State& state) {
   auto batch = MakeIntTestBatch(kCsvRows, kCsvCols, state.range(0));
   BenchmarkWriteCsv(state, WriteOptions::Defaults(), *batch);
@@ -137,8 +152,7 @@ void WriteCsvStringRejectQuote(benchmark::State& state) {
   BenchmarkWriteCsv(state, options, *batch);
 }
 
-// Exercise QuotedColumnPopulator with integer
-// - check quote even for numeric type (is it useful?)
+// Exercise FormattedColumnPopulator with quoted integer
 void WriteCsvNumericCheckQuote(benchmark::State& state) {
   auto batch = MakeIntTestBatch(kCsvRows, kCsvCols, state.range(0));
   auto options = WriteOptions::Defaults();
@@ -146,6 +160,20 @@ void WriteCsvNumericCheckQuote(benchmark::State& state) {
   BenchmarkWriteCsv(state, options, *batch);
 }
 
+// Exercise FormattedColumnPopulator with timestamp
+void WriteCsvTimestamp(benchmark::State& state) {
+  auto batch = MakeTimestampTestBatch(kCsvRows, kCsvCols, state.range(0));
+  BenchmarkWriteCsv(state, WriteOptions::Defaults(), *batch);
+}
+
+// Exercise converting slices of a larger batch on the CPU thread pool
+void WriteCsvNumericThreaded(benchmark::State& state) {
+  auto batch = MakeIntTestBatch(kCsvRows * 32, kCsvCols, state.range(0));
+  auto options = WriteOptions::Defaults();
+  options.use_threads = true;
+  BenchmarkWriteCsv(state, options, *batch);
+}
+
 void NullPercents(benchmark::internal::Benchmark* bench) {
   std::vector<int> null_percents = {0, 1, 10, 50};
   for (int null_percent : null_percents) {
@@ -160,6 +188,8 @@ BENCHMARK(WriteCsvStringNoQuote)->Apply(NullPercents);
 BENCHMARK(WriteCsvStringWithQuote)->Apply(NullPercents);
 BENCHMARK(WriteCsvStringRejectQuote)->Apply(NullPercents);
 BENCHMARK(WriteCsvNumericCheckQuote)->Apply(NullPercents);
+BENCHMARK(WriteCsvTimestamp)->Apply(NullPercents);
+BENCHMARK(WriteCsvNumericThreaded)->Apply(NullPercents)->UseRealTime();
 
 }  // namespace csv
 }  // namespace arrow
@@ -22,7 +22,9 @@
 #include <utility>
 #include <vector>
 
+#include "arrow/array.h"
 #include "arrow/buffer.h"
+#include "arrow/compute/cast.h"
 #include "arrow/csv/writer.h"
 #include "arrow/io/memory.h"
 #include "arrow/ipc/writer.h"
@@ -30,10 +32,15 @@
 #include "arrow/result.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/matchers.h"
+#include "arrow/testing/random.h"
 #include "arrow/type.h"
 #include "arrow/type_fwd.h"
+#include "arrow/util/checked_cast.h"
 
 namespace arrow {
+
+using internal::checked_cast;
+
 namespace csv {
 
 struct WriterTestParams {
@@ -336,6 +343,12 @@ TEST_P(TestWriteCSV, TestWrite) {
     ASSERT_OK_AND_ASSIGN(csv, ToCsvString(*record_batch, options));
     EXPECT_EQ(csv, GetParam().expected_output);
 
+    // Neither should converting several slices concurrently.
+    options.use_threads = true;
+    ASSERT_OK_AND_ASSIGN(csv, ToCsvString(*record_batch, options));
+    EXPECT_EQ(csv, GetParam().expected_output);
+    options.use_threads = false;
+
     // Table and Record batch should work identically.
     ASSERT_OK_AND_ASSIGN(std::shared_ptr<Table> table,
                          Table::FromRecordBatches({record_batch}));
@@ -365,6 +378,114 @@ INSTANTIATE_TEST_SUITE_P(SingleColumnWriteCSVTest, TestWriteCSV,
                              "\n9999\n\n-15\n",
                              Status::OK())));
 
+TEST(TestWriteCSVThreaded, SlicesWrittenInOrder) {
+  auto batch_schema =
+      schema({field("a", int64()), field("b", utf8()), field("c", float64()),
+              field("d", timestamp(TimeUnit::MILLI)), field("e", boolean())});
+  auto batch = random::GenerateBatch(batch_schema->fields(), /*size=*/10000,
+                                     /*seed=*/0x5eed);
+
+  auto write = [&](bool use_threads, QuotingStyle quoting_style) -> Result<std::string> {
+    auto options = DefaultTestOptions(/*include_header=*/true, /*null_string=*/"NA",
+                                      quoting_style, /*eol=*/"\n", /*delimiter=*/',',
+                                      /*batch_size=*/97);
+    options.use_threads = use_threads;
+    ARROW_ASSIGN_OR_RAISE(auto out, io::BufferOutputStream::Create());
+    ARROW_ASSIGN_OR_RAISE(auto writer, MakeCSVWriter(out, batch_schema, options));
+    RETURN_NOT_OK(writer->WriteRecordBatch(*batch));
+    RETURN_NOT_OK(writer->WriteRecordBatch(*batch->Slice(0, 500)));
+    RETURN_NOT_OK(writer->Close());
+    // 104 slices of the first batch and 6 of the second
+    EXPECT_EQ(writer->stats().num_record_batches, 110);
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> buffer, out->Finish());
+    return buffer->ToString();
+  };
+
+  for (auto quoting_style : {QuotingStyle::Needed, QuotingStyle::AllValid}) {
+    ASSERT_OK_AND_ASSIGN(auto serial, write(/*use_threads=*/false, quoting_style));
+    ASSERT_OK_AND_ASSIGN(auto threaded, write(/*use_threads=*/true, quoting_style));
+    EXPECT_EQ(serial, threaded);
+  }
+}
+
+TEST(TestWriteCSV, DictionaryColumns) {
+  auto batch_schema = schema({field("i", dictionary(int32(), int64())),
+                              field("b", dictionary(int8(), boolean())),
+                              field("d", dictionary(int16(), float64()))});
+  auto i = DictArrayFromJSON(batch_schema->field(0)->type(), "[2, 0, null, 1, 2]",
+                             "[-7, 1234567890123, 42]");
+  auto b = DictArrayFromJSON(batch_schema->field(1)->type(), "[1, 1, 0, null, 0]",
+                             "[true, false]");
+  auto d = DictArrayFromJSON(batch_schema->field(2)->type(), "[0, null, 1, 1, 0]",
+                             "[1.5, -0.25]");
+  auto batch = RecordBatch::Make(batch_schema, 5, {i, b, d});
+
+  for (auto quoting_style : {QuotingStyle::Needed, QuotingStyle::AllValid}) {
+    ASSERT_OK_AND_ASSIGN(auto out, io::BufferOutputStream::Create());
+    ASSERT_OK(WriteCSV(*batch,
+                       DefaultTestOptions(/*include_header=*/false, /*null_string=*/"",
+                                          quoting_style),
+                       out.get()));
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<Buffer> buffer, out->Finish());
+    std::string expected = quoting_style == QuotingStyle::AllValid
+                               ? "\"42\",\"false\",\"1.5\"\n"
+                                 "\"-7\",\"false\",\n"
+                                 ",\"true\",\"-0.25\"\n"
+                                 "\"1234567890123\",,\"-0.25\"\n"
+                                 "\"42\",\"true\",\"1.5\"\n"
+                               : "42,false,1.5\n"
+                                 "-7,false,\n"
+                                 ",true,-0.25\n"
+                                 "1234567890123,,-0.25\n"
+                                 "42,true,1.5\n";
+    EXPECT_EQ(buffer->ToString(), expected);
+  }
+}
+
+// Columns formatted without going through the cast kernel must produce the same text
+// as casting them to utf8.
+TEST(TestWriteCSV, FormattedColumnsMatchCast) {
+  auto types = {float16(),
+                date64(),
+                time64(TimeUnit::NANO),
+                duration(TimeUnit::MICRO),
+                timestamp(TimeUnit::MILLI),
+                timestamp(TimeUnit::NANO)};
+  random::RandomArrayGenerator rng(0xca57);
+
+  for (const auto& type : types) {
+    ARROW_SCOPED_TRACE("type = ", type->ToString());
+    auto array = rng.ArrayOf(type, /*size=*/1000, /*null_probability=*/0.2);
+    ASSERT_OK_AND_ASSIGN(auto strings, compute::Cast(*array, utf8()));
+    const auto& string_array = checked_cast<const StringArray&>(*strings);
+    auto batch = RecordBatch::Make(schema({field("x", type)}), array->length(), {array});
+
+    for (auto quoting_style : {QuotingStyle::AllValid, QuotingStyle::None}) {
+      std::string expected;
+      for (int64_t i = 0; i < string_array.length(); ++i) {
+        if (string_array.IsValid(i)) {
+          if (quoting_style == QuotingStyle::AllValid) {
+            expected += "\"" + string_array.GetString(i) + "\"";
+          } else {
+            expected += string_array.GetString(i);
+          }
+        } else {
+          expected += "NA";
+        }
+        expected += "\n";
+      }
+
+      ASSERT_OK_AND_ASSIGN(auto out, io::BufferOutputStream::Create());
+      ASSERT_OK(WriteCSV(*batch,
+                         DefaultTestOptions(/*include_header=*/false,
+                                            /*null_string=*/"NA", quoting_style),
+                         out.get()));
+      ASSERT_OK_AND_ASSIGN(std::shared_ptr<Buffer> buffer, out->Finish());
+      EXPECT_EQ(buffer->ToString(), expected);
+    }
+  }
+}
+
 #ifndef _WIN32
 // TODO(ARROW-13168):
 INSTANTIATE_TEST_SUITE_P(
@@ -18,24 +18,48 @@
 #include "arrow/dataset/discovery.h"
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
 
+#include "arrow/array/array_binary.h"
+#include "arrow/array/array_primitive.h"
+#include "arrow/array/builder_binary.h"
+#include "arrow/array/builder_primitive.h"
+#include "arrow/compute/expression.h"
 #include "arrow/dataset/dataset.h"
 #include "arrow/dataset/file_base.h"
 #include "arrow/dataset/partition.h"
 #include "arrow/dataset/type_fwd.h"
+#include "arrow/filesystem/filesystem.h"
 #include "arrow/filesystem/path_util.h"
+#include "arrow/io/memory.h"
+#include "arrow/ipc/dictionary.h"
+#include "arrow/ipc/reader.h"
+#include "arrow/ipc/writer.h"
 #include "arrow/record_batch.h"
+#include "arrow/util/async_generator.h"
+#include "arrow/util/base64.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/hash_util.h"
+#include "arrow/util/key_value_metadata.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/string.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 
+using internal::checked_cast;
+using internal::hash_combine;
 using internal::StartsWith;
+using internal::ThreadPool;
 
 namespace dataset {
 
@@ -107,6 +131,167 @@ Result<std::shared_ptr<Dataset>> UnionDatasetFactory::Finish(FinishOptions optio
   return std::shared_ptr<Dataset>(new UnionDataset(options.schema, std::move(children)));
 }
 
+namespace {
+
+int64_t ToNanoseconds(fs::TimePoint time) {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch())
+      .count();
+}
+
+}  // namespace
+
+//
+// FileSchemaCache
+//
+
+class FileSchemaCache::Impl {
+ public:
+  struct Key {
+    std::string path;
+    int64_t size;
+    int64_t mtime_ns;
+
+    bool operator==(const Key& other) const {
+      return size == other.size && mtime_ns == other.mtime_ns && path == other.path;
+    }
+  };
+
+  struct KeyHash {
+    size_t operator()(const Key& key) const {
+      size_t seed = std::hash<std::string>{}(key.path);
+      hash_combine(seed, key.size);
+      hash_combine(seed, key.mtime_ns);
+      return seed;
+    }
+  };
+
+  static std::optional<Key> MakeKey(const fs::FileInfo& info) {
+    if (info.size() == fs::kNoSize || info.mtime() == fs::kNoTime) {
+      return std::nullopt;
+    }
+    return Key{info.path(), info.size(), ToNanoseconds(info.mtime())};
+  }
+
+  // The layout of a saved cache: one row per file, with its serialized schema
+  static const std::shared_ptr<Schema>& file_schema() {
+    static auto schema =
+        ::arrow::schema({field("path", utf8(), /*nullable=*/false),
+                         field("size", int64(), /*nullable=*/false),
+                         field("mtime", timestamp(TimeUnit::NANO), /*nullable=*/false),
+                         field("schema", binary(), /*nullable=*/false)});
+    return schema;
+  }
+
+  Result<std::shared_ptr<RecordBatch>> ToRecordBatch() const {
+    StringBuilder paths;
+    Int64Builder sizes;
+    TimestampBuilder mtimes(timestamp(TimeUnit::NANO), default_memory_pool());
+    BinaryBuilder schemas;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& [key, schema] : entries_) {
+      ARROW_ASSIGN_OR_RAISE(auto serialized, ipc::SerializeSchema(*schema));
+      RETURN_NOT_OK(paths.Append(key.path));
+      RETURN_NOT_OK(sizes.Append(key.size));
+      RETURN_NOT_OK(mtimes.Append(key.mtime_ns));
+      RETURN_NOT_OK(schemas.Append(serialized->data(), serialized->size()));
+    }
+    const auto num_rows = paths.length();
+    ArrayVector columns(4);
+    RETURN_NOT_OK(paths.Finish(&columns[0]));
+    RETURN_NOT_OK(sizes.Finish(&columns[1]));
+    RETURN_NOT_OK(mtimes.Finish(&columns[2]));
+    RETURN_NOT_OK(schemas.Finish(&columns[3]));
+    return RecordBatch::Make(file_schema(), num_rows, std::move(columns));
+  }
+
+  Status AddRecordBatch(const RecordBatch& batch) {
+    const auto& paths = checked_cast<const StringArray&>(*batch.column(0));
+    const auto& sizes = checked_cast<const Int64Array&>(*batch.column(1));
+    const auto& mtimes = checked_cast<const TimestampArray&>(*batch.column(2));
+    const auto& schemas = checked_cast<const BinaryArray&>(*batch.column(3));
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (int64_t i = 0; i < batch.num_rows(); ++i) {
+      io::BufferReader reader(std::make_shared<Buffer>(schemas.GetView(i)));
+      ipc::DictionaryMemo dictionary_memo;
+      ARROW_ASSIGN_OR_RAISE(auto schema, ipc::ReadSchema(&reader, &dictionary_memo));
+      entries_[Key{std::string(paths.GetView(i)), sizes.Value(i), mtimes.Value(i)}] =
+          std::move(schema);
+    }
+    return Status::OK();
+  }
+
+  std::shared_ptr<Schema> Get(const fs::FileInfo& info) const {
+    auto key = MakeKey(info);
+    if (!key.has_value()) return nullptr;
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(*key);
+    return it == entries_.end() ? nullptr : it->second;
+  }
+
+  void Put(const fs::FileInfo& info, std::shared_ptr<Schema> schema) {
+    auto key = MakeKey(info);
+    if (!key.has_value()) return;
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_[std::move(*key)] = std::move(schema);
+  }
+
+  int64_t size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return static_cast<int64_t>(entries_.size());
+  }
+
+ private:
+  mutable std::mutex mutex_;
+  std::unordered_map<Key, std::shared_ptr<Schema>, KeyHash> entries_;
+};
+
+FileSchemaCache::FileSchemaCache() : impl_(new Impl()) {}
+
+FileSchemaCache::~FileSchemaCache() = default;
+
+std::shared_ptr<Schema> FileSchemaCache::Get(const fs::FileInfo& info) const {
+  return impl_->Get(info);
+}
+
+void FileSchemaCache::Put(const fs::FileInfo& info, std::shared_ptr<Schema> schema) {
+  impl_->Put(info, std::move(schema));
+}
+
+int64_t FileSchemaCache::size() const { return impl_->size(); }
+
+Result<std::shared_ptr<FileSchemaCache>> FileSchemaCache::Load(
+    const std::shared_ptr<fs::FileSystem>& filesystem, const std::string& path) {
+  auto cache = std::make_shared<FileSchemaCache>();
+  ARROW_ASSIGN_OR_RAISE(auto info, filesystem->GetFileInfo(path));
+  if (info.type() == fs::FileType::NotFound) {
+    return cache;
+  }
+
+  ARROW_ASSIGN_OR_RAISE(auto file, filesystem->OpenInputFile(info));
+  ARROW_ASSIGN_OR_RAISE(auto reader, ipc::RecordBatchFileReader::Open(file));
+  if (!reader->schema()->Equals(*Impl::file_schema(), /*check_metadata=*/false)) {
+    return Status::Invalid("'", path, "' is not a schema cache file: unexpected schema ",
+                           reader->schema()->ToString());
+  }
+  for (int i = 0; i < reader->num_record_batches(); ++i) {
+    ARROW_ASSIGN_OR_RAISE(auto batch, reader->ReadRecordBatch(i));
+    RETURN_NOT_OK(cache->impl_->AddRecordBatch(*batch));
+  }
+  return cache;
+}
+
+Status FileSchemaCache::Save(const std::shared_ptr<fs::FileSystem>& filesystem,
+                             const std::string& path) const {
+  ARROW_ASSIGN_OR_RAISE(auto batch, impl_->ToRecordBatch());
+  ARROW_ASSIGN_OR_RAISE(auto stream, filesystem->OpenOutputStream(path));
+  ARROW_ASSIGN_OR_RAISE(auto writer, ipc::MakeFileWriter(stream, batch->schema()));
+  RETURN_NOT_OK(writer->WriteRecordBatch(*batch));
+  RETURN_NOT_OK(writer->Close());
+  return stream->Close();
+}
+
 FileSystemDatasetFactory::FileSystemDatasetFactory(
     std::vector<fs::FileInfo> files, std::shared_ptr<fs::FileSystem> filesystem,
     std::shared_ptr<FileFormat> format, FileSystemFactoryOptions options)
@@ -169,6 +354,80 @@ bool StartsWithAnyOf(const std::string& path, const std::vector<std::string>& pr
   });
 }
 
+namespace {
+
+// Formats inspect files synchronously, blocking on tasks submitted to the CPU and
+// I/O thread pools, so inspections run on a pool of their own.  The pool is shared
+// by all factories and grows to the largest concurrency asked for.
+Result<ThreadPool*> GetInspectionThreadPool(int concurrency) {
+  static std::mutex mutex;
+  static std::shared_ptr<ThreadPool> pool;
+  std::lock_guard<std::mutex> lock(mutex);
+  if (pool == nullptr) {
+    ARROW_ASSIGN_OR_RAISE(pool, ThreadPool::Make(concurrency));
+  } else if (pool->GetCapacity() < concurrency) {
+    RETURN_NOT_OK(pool->SetCapacity(concurrency));
+  }
+  return pool.get();
+}
+
+// List the files of selector that are not explicitly ignored
+Result<std::vector<fs::FileInfo>> ListFiles(
+    const std::shared_ptr<fs::FileSystem>& filesystem, const fs::FileSelector& selector,
+    const FileSystemFactoryOptions& options) {
+  std::vector<fs::FileInfo> files;
+  auto is_ignored = [&](const fs::FileInfo& info) -> Result<bool> {
+    auto relative = fs::internal::RemoveAncestor(selector.base_dir, info.path());
+    if (!relative.has_value()) {
+      return Status::Invalid("GetFileInfo() yielded path '", info.path(),
+                             "', which is outside base dir '", selector.base_dir, "'");
+    }
+    return StartsWithAnyOf(std::string(*relative), options.selector_ignore_prefixes);
+  };
+  auto add_files = [&](const std::vector<fs::FileInfo>& infos) -> Status {
+    for (const auto& info : infos) {
+      if (!info.IsFile()) continue;
+      ARROW_ASSIGN_OR_RAISE(auto ignored, is_ignored(info));
+      if (!ignored) files.push_back(info);
+    }
+    return Status::OK();
+  };
+
+  std::vector<fs::FileSelector> shards;
+  if (selector.recursive && selector.max_recursion > 0 &&
+      options.listing_concurrency > 1) {
+    // Shard the listing by subdirectory of the base directory
+    auto top_selector = selector;
+    top_selector.recursive = false;
+    ARROW_ASSIGN_OR_RAISE(auto top_infos, filesystem->GetFileInfo(top_selector));
+    RETURN_NOT_OK(add_files(top_infos));
+    for (const auto& info : top_infos) {
+      if (!info.IsDirectory()) continue;
+      ARROW_ASSIGN_OR_RAISE(auto ignored, is_ignored(info));
+      if (ignored) continue;
+      fs::FileSelector shard;
+      shard.base_dir = info.path();
+      shard.allow_not_found = true;
+      shard.recursive = true;
+      shard.max_recursion = selector.max_recursion - 1;
+      shards.push_back(std::move(shard));
+    }
+  } else {
+    shards.push_back(selector);
+  }
+
+  std::vector<fs::FileInfoGenerator> generators;
+  for (const auto& shard : shards) {
+    generators.push_back(filesystem->GetFileInfoGenerator(shard));
+  }
+  auto pages = MakeMergedGenerator(MakeVectorGenerator(std::move(generators)),
+                                   std::max(options.listing_concurrency, 1));
+  RETURN_NOT_OK(VisitAsyncGenerator(std::move(pages), add_files).status());
+  return files;
+}
+
+}  // namespace
+
 Result<std::shared_ptr<DatasetFactory>> FileSystemDatasetFactory::Make(
     std::shared_ptr<fs::FileSystem> filesystem, fs::FileSelector selector,
     std::shared_ptr<FileFormat> format, FileSystemFactoryOptions options) {
@@ -180,29 +439,7 @@ Result<std::shared_ptr<DatasetFactory>> FileSystemDatasetFactory::Make(
   }
 
   ARROW_ASSIGN_OR_RAISE(selector.base_dir, filesystem->NormalizePath(selector.base_dir));
-  ARROW_ASSIGN_OR_RAISE(auto files, filesystem->GetFileInfo(selector));
-
-  // Filter out anything that's not a file or that's explicitly ignored
-  Status st;
-  auto files_end =
-      std::remove_if(files.begin(), files.end(), [&](const fs::FileInfo& info) {
-        if (!info.IsFile()) return true;
-
-        auto relative = fs::internal::RemoveAncestor(selector.base_dir, info.path());
-        if (!relative.has_value()) {
-          st = Status::Invalid("GetFileInfo() yielded path '", info.path(),
-                               "', which is outside base dir '", selector.base_dir, "'");
-          return false;
-        }
-
-        if (StartsWithAnyOf(std::string(*relative), options.selector_ignore_prefixes)) {
-          return true;
-        }
-
-        return false;
-      });
-  RETURN_NOT_OK(st);
-  files.erase(files_end, files.end());
+  ARROW_ASSIGN_OR_RAISE(auto files, ListFiles(filesystem, selector, options));
 
   // Sorting by path guarantees a stability sometimes needed by unit tests.
   std::sort(files.begin(), files.end(), fs::FileInfo::ByPath());
@@ -235,19 +472,89 @@ Result<std::shared_ptr<DatasetFactory>> FileSystemDatasetFactory::Make(
 
 Result<std::vector<std::shared_ptr<Schema>>> FileSystemDatasetFactory::InspectSchemas(
     InspectOptions options) {
-  std::vector<std::shared_ptr<Schema>> schemas;
-
+  // Pick the files to inspect
   const bool has_fragments_limit = options.fragments >= 0;
-  int fragments = options.fragments;
+  const bool has_bytes_limit = options.bytes >= 0;
+  int64_t num_files = 0;
+  int64_t num_bytes = 0;
   for (const auto& info : files_) {
-    if (has_fragments_limit && fragments-- == 0) break;
+    if (has_fragments_limit && num_files == options.fragments) break;
+    if (has_bytes_limit && num_files > 0 && num_bytes >= options.bytes) break;
+    ++num_files;
+    num_bytes += std::max<int64_t>(info.size(), 0);
+  }
+
+  std::vector<std::shared_ptr<Schema>> schemas(num_files);
+  const auto& schema_cache = options_.schema_cache;
+  auto inspect_file = [&](int64_t i) -> Status {
+    fs::FileInfo info = files_[i];
+    if (schema_cache) {
+      if (info.size() == fs::kNoSize || info.mtime() == fs::kNoTime) {
+        // Files given by path only have no identity to cache them by
+        ARROW_ASSIGN_OR_RAISE(info, fs_->GetFileInfo(info.path()));
+      }
+      if ((schemas[i] = schema_cache->Get(info)) != nullptr) {
+        return Status::OK();
+      }
+    }
     auto result = format_->Inspect({info, fs_});
     if (ARROW_PREDICT_FALSE(!result.ok())) {
       return result.status().WithMessage(
           "Error creating dataset. Could not read schema from '", info.path(),
           "'. Is this a '", format_->type_name(), "' file?: ", result.status().message());
     }
-    schemas.push_back(result.MoveValueUnsafe());
+    schemas[i] = result.MoveValueUnsafe();
+    if (schema_cache) {
+      schema_cache->Put(info, schemas[i]);
+    }
+    return Status::OK();
+  };
+
+  const int concurrency =
+      static_cast<int>(std::min<int64_t>(options.concurrency, num_files));
+  if (concurrency > 1) {
+    // Each worker inspects the next file until all are claimed, or one failed to be
+    // inspected.  Files are claimed in order, so all files before the failed one
+    // are still inspected and the error of the first failing file is reported.
+    std::atomic<int64_t> next_file{0};
+    std::atomic<bool> failed{false};
+    std::mutex error_mutex;
+    int64_t error_file = num_files;
+    Status error;
+    auto inspect_files = [&]() {
+      for (int64_t i = next_file++; i < num_files && !failed.load(); i = next_file++) {
+        Status st = inspect_file(i);
+        if (!st.ok()) {
+          failed.store(true);
+          std::lock_guard<std::mutex> lock(error_mutex);
+          if (i < error_file) {
+            error_file = i;
+            error = std::move(st);
+          }
+          return;
+        }
+      }
+    };
+    ARROW_ASSIGN_OR_RAISE(auto thread_pool, GetInspectionThreadPool(concurrency));
+    std::vector<Future<>> workers;
+    Status st;
+    for (int i = 0; i < concurrency && st.ok(); ++i) {
+      auto maybe_worker = thread_pool->Submit(inspect_files);
+      if (maybe_worker.ok()) {
+        workers.push_back(maybe_worker.MoveValueUnsafe());
+      } else {
+        // The workers already submitted refer to this frame, wait for them
+        failed.store(true);
+        st = maybe_worker.status();
+      }
+    }
+    st &= AllFinished(workers).status();
+    RETURN_NOT_OK(st);
+    RETURN_NOT_OK(error);
+  } else {
+    for (int64_t i = 0; i < num_files; ++i) {
+      RETURN_NOT_OK(inspect_file(i));
+    }
   }
 
   ARROW_ASSIGN_OR_RAISE(auto partition_schema,
@@ -292,5 +599,145 @@ Result<std::shared_ptr<Dataset>> FileSystemDatasetFactory::Finish(FinishOptions
                                  std::move(fragments), std::move(partitioning));
 }
 
+//
+// Dataset manifests
+//
+
+namespace {
+
+constexpr char kManifestFormatKey[] = "format";
+constexpr char kManifestSchemaKey[] = "dataset_schema";
+constexpr char kManifestRootPartitionKey[] = "root_partition";
+
+// The layout of a manifest: one row per fragment, with its serialized partition
+// expression. The size and modification time are null if unknown.
+std::shared_ptr<Schema> ManifestSchema(
+    std::shared_ptr<const KeyValueMetadata> metadata = nullptr) {
+  return schema({field("path", utf8(), /*nullable=*/false), field("size", int64()),
+                 field("mtime", timestamp(TimeUnit::NANO)),
+                 field("partition", binary(), /*nullable=*/false)},
+                std::move(metadata));
+}
+
+}  // namespace
+
+Status WriteDatasetManifest(const std::shared_ptr<FileSystemDataset>& dataset,
+                            const std::shared_ptr<fs::FileSystem>& filesystem,
+                            const std::string& path) {
+  StringBuilder paths;
+  Int64Builder sizes;
+  TimestampBuilder mtimes(timestamp(TimeUnit::NANO), default_memory_pool());
+  BinaryBuilder partitions;
+
+  ARROW_ASSIGN_OR_RAISE(auto fragments, dataset->GetFragments());
+  for (auto maybe_fragment : fragments) {
+    ARROW_ASSIGN_OR_RAISE(auto fragment, maybe_fragment);
+    const auto& source = checked_cast<const FileFragment&>(*fragment).source();
+    if (source.filesystem() == nullptr) {
+      return Status::Invalid("Cannot write a manifest for a dataset of in-memory files");
+    }
+    const auto& info = source.file_info();
+    RETURN_NOT_OK(paths.Append(info.path()));
+    RETURN_NOT_OK(info.size() == fs::kNoSize ? sizes.AppendNull()
+                                             : sizes.Append(info.size()));
+    RETURN_NOT_OK(info.mtime() == fs::kNoTime
+                      ? mtimes.AppendNull()
+                      : mtimes.Append(ToNanoseconds(info.mtime())));
+    ARROW_ASSIGN_OR_RAISE(auto partition,
+                          compute::Serialize(fragment->partition_expression()));
+    RETURN_NOT_OK(partitions.Append(partition->data(), partition->size()));
+  }
+
+  ARROW_ASSIGN_OR_RAISE(auto dataset_schema, ipc::SerializeSchema(*dataset->schema()));
+  ARROW_ASSIGN_OR_RAISE(auto root_partition,
+                        compute::Serialize(dataset->partition_expression()));
+  auto metadata = key_value_metadata(
+      {kManifestFormatKey, kManifestSchemaKey, kManifestRootPartitionKey},
+      {dataset->format()->type_name(), util::base64_encode(dataset_schema->ToString()),
+       util::base64_encode(root_partition->ToString())});
+
+  const auto num_rows = paths.length();
+  ArrayVector columns(4);
+  RETURN_NOT_OK(paths.Finish(&columns[0]));
+  RETURN_NOT_OK(sizes.Finish(&columns[1]));
+  RETURN_NOT_OK(mtimes.Finish(&columns[2]));
+  RETURN_NOT_OK(partitions.Finish(&columns[3]));
+  auto batch = RecordBatch::Make(ManifestSchema(std::move(metadata)), num_rows,
+                                 std::move(columns));
+
+  ARROW_ASSIGN_OR_RAISE(auto stream, filesystem->OpenOutputStream(path));
+  ARROW_ASSIGN_OR_RAISE(auto writer, ipc::MakeFileWriter(stream, batch->schema()));
+  RETURN_NOT_OK(writer->WriteRecordBatch(*batch));
+  RETURN_NOT_OK(writer->Close());
+  return stream->Close();
+}
+
+Result<std::shared_ptr<FileSystemDataset>> ReadDatasetManifest(
+    const std::shared_ptr<fs::FileSystem>& filesystem, const std::string& path,
+    std::shared_ptr<FileFormat> format,
+    std::shared_ptr<fs::FileSystem> dataset_filesystem) {
+  if (dataset_filesystem == nullptr) {
+    dataset_filesystem = filesystem;
+  }
+
+  ARROW_ASSIGN_OR_RAISE(auto file, filesystem->OpenInputFile(path));
+  ARROW_ASSIGN_OR_RAISE(auto reader, ipc::RecordBatchFileReader::Open(file));
+  const auto& metadata = reader->schema()->metadata();
+  if (!reader->schema()->Equals(*ManifestSchema(), /*check_metadata=*/false) ||
+      metadata == nullptr || !metadata->Contains(kManifestFormatKey) ||
+      !metadata->Contains(kManifestSchemaKey) ||
+      !metadata->Contains(kManifestRootPartitionKey)) {
+    return Status::Invalid("'", path, "' is not a dataset manifest");
+  }
+
+  ARROW_ASSIGN_OR_RAISE(auto format_name, metadata->Get(kManifestFormatKey));
+  if (format_name != format->type_name()) {
+    return Status::TypeError("Dataset manifest '", path, "' describes a '", format_name,
+                             "' dataset, but format '", format->type_name(),
+                             "' was given");
+  }
+  ARROW_ASSIGN_OR_RAISE(auto encoded_schema, metadata->Get(kManifestSchemaKey));
+  io::BufferReader schema_reader(Buffer::FromString(util::base64_decode(encoded_schema)));
+  ipc::DictionaryMemo dictionary_memo;
+  ARROW_ASSIGN_OR_RAISE(auto dataset_schema,
+                        ipc::ReadSchema(&schema_reader, &dictionary_memo));
+  ARROW_ASSIGN_OR_RAISE(auto encoded_root_partition,
+                        metadata->Get(kManifestRootPartitionKey));
+  ARROW_ASSIGN_OR_RAISE(auto root_partition,
+                        compute::Deserialize(Buffer::FromString(
+                            util::base64_decode(encoded_root_partition))));
+
+  std::vector<std::shared_ptr<FileFragment>> fragments;
+  for (int i = 0; i < reader->num_record_batches(); ++i) {
+    ARROW_ASSIGN_OR_RAISE(auto batch, reader->ReadRecordBatch(i));
+    const auto& paths = checked_cast<const StringArray&>(*batch->column(0));
+    const auto& sizes = checked_cast<const Int64Array&>(*batch->column(1));
+    const auto& mtimes = checked_cast<const TimestampArray&>(*batch->column(2));
+    const auto& partitions = checked_cast<const BinaryArray&>(*batch->column(3));
+    for (int64_t row = 0; row < batch->num_rows(); ++row) {
+      fs::FileInfo info(std::string(paths.GetView(row)), fs::FileType::File);
+      if (sizes.IsValid(row)) {
+        info.set_size(sizes.Value(row));
+      }
+      if (mtimes.IsValid(row)) {
+        info.set_mtime(fs::TimePoint(std::chrono::nanoseconds(mtimes.Value(row))));
+      }
+      // Copy the partition expression, whose literals may reference its buffer
+      ARROW_ASSIGN_OR_RAISE(auto partition,
+                            compute::Deserialize(Buffer::FromString(
+                                std::string(partitions.GetView(row)))));
+      ARROW_ASSIGN_OR_RAISE(
+          auto fragment,
+          format->MakeFragment(FileSource(std::move(info), dataset_filesystem),
+                               std::move(partition)));
+      fragments.push_back(std::move(fragment));
+    }
+  }
+
+  return FileSystemDataset::Make(std::move(dataset_schema), std::move(root_partition),
+                                 std::move(format), std::move(dataset_filesystem),
+                                 std::move(fragments));
+}
+
 }  // namespace dataset
 }  // namespace arrow
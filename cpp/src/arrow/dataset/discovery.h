@@ -33,6 +33,7 @@
 #include "arrow/dataset/visibility.h"
 #include "arrow/filesystem/type_fwd.h"
 #include "arrow/result.h"
+#include "arrow/status.h"
 #include "arrow/util/macros.h"
 
 namespace arrow {
@@ -59,6 +60,30 @@ struct InspectOptions {
   /// altogether so only the partitioning schema will be inspected.
   int fragments = 1;
 
+  /// See `bytes` property.
+  static constexpr int64_t kInspectAllBytes = -1;
+
+  /// Indicate how many bytes worth of fragments should be inspected to infer the
+  /// unified dataset schema, in addition to the `fragments` limit.
+  ///
+  /// Fragments are inspected in order until the sum of their file sizes reaches
+  /// this value; the first fragment is always inspected. Fragments of unknown size
+  /// count as empty. The default value of `kInspectAllBytes` does not limit
+  /// inspection by size. Note that how much of each file is read is up to the
+  /// format, e.g. CSV and JSON formats only parse their first block.
+  int64_t bytes = kInspectAllBytes;
+
+  /// See `concurrency` property.
+  static constexpr int kDefaultConcurrency = 8;
+
+  /// Indicate how many fragments may be inspected at the same time.
+  ///
+  /// Inspecting a fragment usually opens the file and reads its first bytes, so
+  /// inspecting several fragments concurrently hides the latency of remote file
+  /// systems. A value of `1` inspects fragments one after another. In either
+  /// case, no more fragments are inspected once one fails to be.
+  int concurrency = kDefaultConcurrency;
+
   /// Control how to unify types. By default, types are merged strictly (the
   /// type must match exactly, except nulls can be merged with other types).
   Field::MergeOptions field_merge_options = Field::MergeOptions::Defaults();
@@ -146,6 +171,49 @@ class ARROW_DS_EXPORT UnionDatasetFactory : public DatasetFactory {
   std::vector<std::shared_ptr<DatasetFactory>> factories_;
 };
 
+/// \brief A cache of the schemas inferred for individual files.
+///
+/// Entries are keyed by file identity (path, size and modification time), so a file
+/// that was rewritten since its schema was recorded is inspected again. Files whose
+/// size or modification time is unknown are never cached. Inferred schemas depend on
+/// the format and its options: use one cache per format configuration.
+///
+/// A cache can be saved to and loaded from an Arrow IPC file, so that a restarted
+/// process does not have to inspect the same files again.
+///
+/// This class is thread-safe.
+/// \ingroup dataset-filesystem
+class ARROW_DS_EXPORT FileSchemaCache {
+ public:
+  FileSchemaCache();
+  ~FileSchemaCache();
+
+  /// \brief Return the schema recorded for a file, or null if there is none.
+  std::shared_ptr<Schema> Get(const fs::FileInfo& info) const;
+
+  /// \brief Record the schema inferred for a file.
+  ///
+  /// This does nothing if the file's size or modification time is unknown.
+  void Put(const fs::FileInfo& info, std::shared_ptr<Schema> schema);
+
+  /// \brief Return the number of files in the cache.
+  int64_t size() const;
+
+  /// \brief Load a cache previously written with Save().
+  ///
+  /// An empty cache is returned if there is no file at `path`.
+  static Result<std::shared_ptr<FileSchemaCache>> Load(
+      const std::shared_ptr<fs::FileSystem>& filesystem, const std::string& path);
+
+  /// \brief Write the cache to `path`, replacing any existing file.
+  Status Save(const std::shared_ptr<fs::FileSystem>& filesystem,
+              const std::string& path) const;
+
+ private:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
 /// \ingroup dataset-filesystem
 struct FileSystemFactoryOptions {
   /// Either an explicit Partitioning or a PartitioningFactory to discover one.
@@ -196,6 +264,23 @@ struct FileSystemFactoryOptions {
       ".",
       "_",
   };
+
+  /// If set, the schema of a file is looked up in this cache before inspecting the
+  /// file, and the schemas of inspected files are recorded into it.
+  std::shared_ptr<FileSchemaCache> schema_cache;
+
+  /// See `listing_concurrency` property.
+  static constexpr int kDefaultListingConcurrency = 8;
+
+  /// When discovering from a recursive Selector, how many directories may be listed
+  /// at the same time.
+  ///
+  /// The selector's base directory is listed first, then each of its subdirectories
+  /// is listed recursively, up to `listing_concurrency` at a time, consuming
+  /// FileSystem::GetFileInfoGenerator pages as they arrive. This mostly helps object
+  /// stores, where listing a prefix is a sequence of paginated requests. A value of
+  /// `1` lists the whole selector at once.
+  int listing_concurrency = kDefaultListingConcurrency;
 };
 
 /// \brief FileSystemDatasetFactory creates a Dataset from a vector of
@@ -271,5 +356,40 @@ class ARROW_DS_EXPORT FileSystemDatasetFactory : public DatasetFactory {
   FileSystemFactoryOptions options_;
 };
 
+/// \brief Write a manifest of a dataset's files.
+///
+/// The manifest records the schema, format type and root partition of the dataset,
+/// and the path, size, modification time and partition expression of each of its
+/// fragments, as an Arrow IPC file. ReadDatasetManifest() recreates the dataset from
+/// it without listing the file system or inspecting any file, e.g. in a later run.
+///
+/// The manifest is a snapshot: files added, removed or rewritten after it was written
+/// are not noticed when reading it back.
+///
+/// For Parquet datasets, row group statistics are better persisted as a `_metadata`
+/// file, see ParquetDatasetFactory.
+///
+/// \param[in] dataset the dataset to describe
+/// \param[in] filesystem the file system to write the manifest to
+/// \param[in] path the path of the manifest, replaced if it exists
+/// \ingroup dataset-filesystem
+ARROW_DS_EXPORT Status WriteDatasetManifest(
+    const std::shared_ptr<FileSystemDataset>& dataset,
+    const std::shared_ptr<fs::FileSystem>& filesystem, const std::string& path);
+
+/// \brief Create a dataset from a manifest written by WriteDatasetManifest().
+///
+/// \param[in] filesystem the file system to read the manifest from
+/// \param[in] path the path of the manifest
+/// \param[in] format the format of the dataset's files, which must have the type
+/// recorded in the manifest
+/// \param[in] dataset_filesystem the file system of the dataset's files, if not
+/// `filesystem`
+/// \ingroup dataset-filesystem
+ARROW_DS_EXPORT Result<std::shared_ptr<FileSystemDataset>> ReadDatasetManifest(
+    const std::shared_ptr<fs::FileSystem>& filesystem, const std::string& path,
+    std::shared_ptr<FileFormat> format,
+    std::shared_ptr<fs::FileSystem> dataset_filesystem = NULLPTR);
+
 }  // namespace dataset
 }  // namespace arrow
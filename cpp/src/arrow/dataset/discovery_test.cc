@@ -20,15 +20,23 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <chrono>
+#include <limits>
 #include <memory>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "arrow/dataset/partition.h"
 #include "arrow/dataset/test_util_internal.h"
 #include "arrow/filesystem/test_util.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/ipc/writer.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/type_fwd.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/key_value_metadata.h"
 
 using testing::SizeIs;
 
@@ -364,6 +372,315 @@ TEST_F(FileSystemDatasetFactoryTest, InspectFragmentsLimit) {
   }
 }
 
+// A format whose inferred schema names the inspected file, and which counts the
+// files it inspects.
+class PathSchemaFileFormat : public DummyFileFormat {
+ public:
+  Result<std::shared_ptr<Schema>> Inspect(const FileSource& source) const override {
+    ++num_inspected;
+    if (source.path() == "bad" || source.path() == "worse") {
+      return Status::IOError("cannot read ", source.path());
+    }
+    return schema({field(source.path(), int32())});
+  }
+
+  mutable std::atomic<int> num_inspected{0};
+};
+
+class FileSystemDatasetFactoryInspectTest : public FileSystemDatasetFactoryTest {
+ public:
+  static constexpr fs::TimePoint kMtime{std::chrono::seconds(42)};
+
+  void SetUp() override {
+    FileSystemDatasetFactoryTest::SetUp();
+    path_format_ = std::make_shared<PathSchemaFileFormat>();
+    format_ = path_format_;
+  }
+
+  void MakeFactory(const std::vector<fs::FileInfo>& files) {
+    MakeFileSystem(files);
+    ASSERT_OK_AND_ASSIGN(factory_, FileSystemDatasetFactory::Make(fs_, files, format_,
+                                                                  factory_options_));
+  }
+
+  static fs::FileInfo File(std::string path, int64_t size = 10,
+                           fs::TimePoint mtime = kMtime) {
+    auto info = fs::File(std::move(path));
+    info.set_size(size);
+    info.set_mtime(mtime);
+    return info;
+  }
+
+  static std::vector<std::shared_ptr<Schema>> PathSchemas(
+      const std::vector<std::string>& paths) {
+    std::vector<std::shared_ptr<Schema>> schemas;
+    for (const auto& path : paths) {
+      schemas.push_back(schema({field(path, int32())}));
+    }
+    // The (empty) partitioning schema
+    schemas.push_back(schema({}));
+    return schemas;
+  }
+
+ protected:
+  std::shared_ptr<PathSchemaFileFormat> path_format_;
+};
+
+TEST_F(FileSystemDatasetFactoryInspectTest, BytesLimit) {
+  MakeFactory({File("a", 10), File("b", 10), File("c", 10), File("d", 10)});
+
+  InspectOptions options;
+  options.fragments = InspectOptions::kInspectAllFragments;
+  options.bytes = 15;
+  AssertInspectSchemas(PathSchemas({"a", "b"}), options);
+  options.bytes = 20;
+  AssertInspectSchemas(PathSchemas({"a", "b"}), options);
+  options.bytes = 21;
+  AssertInspectSchemas(PathSchemas({"a", "b", "c"}), options);
+  // The first fragment is always inspected
+  options.bytes = 0;
+  AssertInspectSchemas(PathSchemas({"a"}), options);
+
+  // The fragments limit still applies
+  options.bytes = 25;
+  options.fragments = 1;
+  AssertInspectSchemas(PathSchemas({"a"}), options);
+  options.fragments = 0;
+  AssertInspectSchemas(PathSchemas({}), options);
+}
+
+TEST_F(FileSystemDatasetFactoryInspectTest, Concurrency) {
+  std::vector<fs::FileInfo> files;
+  std::vector<std::string> paths;
+  for (int i = 0; i < 50; ++i) {
+    paths.push_back("file" + std::to_string(i));
+    files.push_back(File(paths.back()));
+  }
+  MakeFactory(files);
+
+  InspectOptions options;
+  options.fragments = InspectOptions::kInspectAllFragments;
+  for (int concurrency : {1, 4, 100}) {
+    ARROW_SCOPED_TRACE("concurrency = ", concurrency);
+    options.concurrency = concurrency;
+    AssertInspectSchemas(PathSchemas(paths), options);
+  }
+
+  // The error reported is the one of the first failing file
+  files.insert(files.begin() + 20, File("bad"));
+  files.insert(files.begin() + 40, File("worse"));
+  MakeFactory(files);
+  options.concurrency = 4;
+  EXPECT_RAISES_WITH_MESSAGE_THAT(IOError,
+                                  testing::HasSubstr("Could not read schema from 'bad'"),
+                                  factory_->InspectSchemas(options));
+}
+
+TEST_F(FileSystemDatasetFactoryInspectTest, ConcurrencyStopsAtError) {
+  std::vector<fs::FileInfo> files{File("bad")};
+  for (int i = 0; i < 1000; ++i) {
+    files.push_back(File("file" + std::to_string(i)));
+  }
+  MakeFactory(files);
+
+  InspectOptions options;
+  options.fragments = InspectOptions::kInspectAllFragments;
+  options.concurrency = 4;
+  EXPECT_RAISES_WITH_MESSAGE_THAT(IOError,
+                                  testing::HasSubstr("Could not read schema from 'bad'"),
+                                  factory_->InspectSchemas(options));
+  // The other workers stop claiming files once the first one failed
+  ASSERT_LT(path_format_->num_inspected, static_cast<int>(files.size()));
+}
+
+TEST_F(FileSystemDatasetFactoryInspectTest, SchemaCache) {
+  auto cache = std::make_shared<FileSchemaCache>();
+  factory_options_.schema_cache = cache;
+  InspectOptions options;
+  options.fragments = InspectOptions::kInspectAllFragments;
+
+  MakeFactory({File("a"), File("b"), File("c")});
+  AssertInspectSchemas(PathSchemas({"a", "b", "c"}), options);
+  ASSERT_EQ(path_format_->num_inspected, 3);
+  ASSERT_EQ(cache->size(), 3);
+  AssertInspectSchemas(PathSchemas({"a", "b", "c"}), options);
+  ASSERT_EQ(path_format_->num_inspected, 3);
+
+  // Modified files are inspected again
+  MakeFactory({File("a"), File("b", /*size=*/11),
+               File("c", /*size=*/10, fs::TimePoint(std::chrono::seconds(43)))});
+  AssertInspectSchemas(PathSchemas({"a", "b", "c"}), options);
+  ASSERT_EQ(path_format_->num_inspected, 5);
+  ASSERT_EQ(cache->size(), 5);
+
+  // Files of unknown identity are not cached
+  auto unknown = fs::File("d");
+  cache->Put(unknown, schema({}));
+  ASSERT_EQ(cache->Get(unknown), nullptr);
+  ASSERT_EQ(cache->size(), 5);
+}
+
+TEST_F(FileSystemDatasetFactoryInspectTest, SchemaCacheWithPaths) {
+  // Files given by path are looked up to get their identity
+  auto cache = std::make_shared<FileSchemaCache>();
+  factory_options_.schema_cache = cache;
+  ASSERT_OK_AND_ASSIGN(
+      fs_, fs::internal::MockFileSystem::Make(kMtime, {fs::File("a"), fs::File("b")}));
+  for (int i = 0; i < 2; ++i) {
+    ASSERT_OK_AND_ASSIGN(
+        factory_, FileSystemDatasetFactory::Make(fs_, std::vector<std::string>{"a", "b"},
+                                                 format_, factory_options_));
+    InspectOptions options;
+    options.fragments = InspectOptions::kInspectAllFragments;
+    AssertInspectSchemas(PathSchemas({"a", "b"}), options);
+    ASSERT_EQ(path_format_->num_inspected, 2);
+    ASSERT_EQ(cache->size(), 2);
+  }
+}
+
+TEST_F(FileSystemDatasetFactoryInspectTest, SaveAndLoadSchemaCache) {
+  ASSERT_OK_AND_ASSIGN(auto cache_fs,
+                       fs::internal::MockFileSystem::Make(fs::kNoTime, {}));
+
+  // Loading a missing cache gives an empty cache
+  ASSERT_OK_AND_ASSIGN(auto cache, FileSchemaCache::Load(cache_fs, "schemas.arrow"));
+  ASSERT_EQ(cache->size(), 0);
+
+  auto dict_schema = schema({field("dict", dictionary(int32(), utf8())),
+                             field("list", list(float64()))},
+                            key_value_metadata({"key"}, {"value"}));
+  cache->Put(File("a"), schema({field("a", int32())}));
+  cache->Put(File("b", /*size=*/0), dict_schema);
+  ASSERT_OK(cache->Save(cache_fs, "schemas.arrow"));
+
+  ASSERT_OK_AND_ASSIGN(auto loaded, FileSchemaCache::Load(cache_fs, "schemas.arrow"));
+  ASSERT_EQ(loaded->size(), 2);
+  AssertSchemaEqual(*loaded->Get(File("a")), *schema({field("a", int32())}),
+                    /*check_metadata=*/true);
+  AssertSchemaEqual(*loaded->Get(File("b", /*size=*/0)), *dict_schema,
+                    /*check_metadata=*/true);
+  ASSERT_EQ(loaded->Get(File("b")), nullptr);
+
+  // A loaded cache spares inspecting files
+  factory_options_.schema_cache = loaded;
+  MakeFactory({File("a"), File("c")});
+  InspectOptions options;
+  options.fragments = InspectOptions::kInspectAllFragments;
+  AssertInspectSchemas({schema({field("a", int32())}), schema({field("c", int32())}),
+                        schema({})},
+                       options);
+  ASSERT_EQ(path_format_->num_inspected, 1);
+
+  // Files that are not schema caches are rejected
+  ASSERT_OK_AND_ASSIGN(auto stream, cache_fs->OpenOutputStream("other.arrow"));
+  ASSERT_OK_AND_ASSIGN(auto writer, ipc::MakeFileWriter(stream, schema({})));
+  ASSERT_OK(writer->Close());
+  ASSERT_OK(stream->Close());
+  EXPECT_RAISES_WITH_MESSAGE_THAT(Invalid, testing::HasSubstr("not a schema cache"),
+                                  FileSchemaCache::Load(cache_fs, "other.arrow"));
+}
+
+TEST_F(FileSystemDatasetFactoryTest, ListingConcurrency) {
+  auto listed_paths = [&](int listing_concurrency) -> std::vector<std::string> {
+    factory_options_.listing_concurrency = listing_concurrency;
+    EXPECT_OK_AND_ASSIGN(factory_, FileSystemDatasetFactory::Make(
+                                       fs_, selector_, format_, factory_options_));
+    EXPECT_OK_AND_ASSIGN(auto dataset, factory_->Finish());
+    return checked_cast<const FileSystemDataset&>(*dataset).files();
+  };
+
+  MakeFileSystem({fs::File("outside"), fs::File("base/top"), fs::File("base/a/1"),
+                  fs::File("base/a/b/2"), fs::File("base/c/d/e/3"),
+                  fs::File("base/_ignored/4"), fs::File("base/c/.hidden"),
+                  fs::Dir("base/empty")});
+  selector_.base_dir = "base";
+  selector_.recursive = true;
+  auto all_paths = std::vector<std::string>{"base/a/1", "base/a/b/2", "base/c/d/e/3",
+                                            "base/top"};
+  for (int listing_concurrency : {1, 2, 8}) {
+    ARROW_SCOPED_TRACE("listing_concurrency = ", listing_concurrency);
+    selector_.max_recursion = std::numeric_limits<int32_t>::max();
+    EXPECT_EQ(listed_paths(listing_concurrency), all_paths);
+    // Sharding by subdirectory respects the maximum recursion
+    for (int max_recursion : {0, 1, 2}) {
+      ARROW_SCOPED_TRACE("max_recursion = ", max_recursion);
+      selector_.max_recursion = max_recursion;
+      EXPECT_EQ(listed_paths(listing_concurrency), listed_paths(1));
+    }
+  }
+
+  selector_.base_dir = "missing";
+  selector_.max_recursion = std::numeric_limits<int32_t>::max();
+  selector_.allow_not_found = true;
+  EXPECT_THAT(listed_paths(8), testing::IsEmpty());
+  selector_.allow_not_found = false;
+  factory_options_.listing_concurrency = 8;
+  ASSERT_RAISES(IOError, FileSystemDatasetFactory::Make(fs_, selector_, format_,
+                                                        factory_options_));
+}
+
+TEST_F(FileSystemDatasetFactoryTest, DatasetManifest) {
+  auto mtime = fs::TimePoint(std::chrono::seconds(42));
+  ASSERT_OK_AND_ASSIGN(
+      fs_, fs::internal::MockFileSystem::Make(
+               mtime, {fs::File("base/a=1/b=x/data"), fs::File("base/a=2/data")}));
+  ASSERT_OK(checked_cast<fs::internal::MockFileSystem&>(*fs_).CreateFile(
+      "base/a=2/more", "some content", /*recursive=*/false));
+  selector_.base_dir = "base";
+  selector_.recursive = true;
+  factory_options_.partitioning = HivePartitioning::MakeFactory();
+  format_ = std::make_shared<DummyFileFormat>(schema({field("f", utf8())}));
+  ASSERT_OK_AND_ASSIGN(factory_, FileSystemDatasetFactory::Make(fs_, selector_, format_,
+                                                                factory_options_));
+  ASSERT_OK(factory_->SetRootPartition(equal(field_ref("root"), literal(true))));
+  ASSERT_OK_AND_ASSIGN(auto dataset, factory_->Finish());
+  auto expected = checked_pointer_cast<FileSystemDataset>(dataset);
+
+  ASSERT_OK_AND_ASSIGN(auto manifest_fs,
+                       fs::internal::MockFileSystem::Make(fs::kNoTime, {}));
+  ASSERT_OK(WriteDatasetManifest(expected, manifest_fs, "manifest.arrow"));
+  ASSERT_OK_AND_ASSIGN(auto actual,
+                       ReadDatasetManifest(manifest_fs, "manifest.arrow", format_, fs_));
+
+  AssertSchemaEqual(*actual->schema(), *expected->schema());
+  EXPECT_EQ(actual->partition_expression(), expected->partition_expression());
+  EXPECT_EQ(actual->format(), format_);
+  EXPECT_EQ(actual->filesystem(), fs_);
+  ASSERT_EQ(actual->files(), expected->files());
+  ASSERT_OK_AND_ASSIGN(auto actual_fragments, actual->GetFragments());
+  ASSERT_OK_AND_ASSIGN(auto expected_fragments, expected->GetFragments());
+  for (auto maybe_expected_fragment : expected_fragments) {
+    ASSERT_OK_AND_ASSIGN(auto expected_fragment, maybe_expected_fragment);
+    ASSERT_OK_AND_ASSIGN(auto actual_fragment, actual_fragments.Next());
+    ASSERT_NE(actual_fragment, nullptr);
+    EXPECT_EQ(actual_fragment->partition_expression(),
+              expected_fragment->partition_expression());
+    const auto& actual_info =
+        checked_cast<const FileFragment&>(*actual_fragment).source().file_info();
+    const auto& expected_info =
+        checked_cast<const FileFragment&>(*expected_fragment).source().file_info();
+    EXPECT_EQ(actual_info, expected_info);
+    EXPECT_EQ(actual_info.mtime(), mtime);
+  }
+
+  // The manifest's file system is used for the dataset by default
+  ASSERT_OK_AND_ASSIGN(actual,
+                       ReadDatasetManifest(manifest_fs, "manifest.arrow", format_));
+  EXPECT_EQ(actual->filesystem(), manifest_fs);
+
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      TypeError, testing::HasSubstr("describes a 'dummy' dataset"),
+      ReadDatasetManifest(manifest_fs, "manifest.arrow",
+                          std::make_shared<JSONRecordBatchFileFormat>(schema({}))));
+  ASSERT_OK_AND_ASSIGN(auto stream, manifest_fs->OpenOutputStream("other.arrow"));
+  ASSERT_OK_AND_ASSIGN(auto writer, ipc::MakeFileWriter(stream, schema({})));
+  ASSERT_OK(writer->Close());
+  ASSERT_OK(stream->Close());
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, testing::HasSubstr("not a dataset manifest"),
+      ReadDatasetManifest(manifest_fs, "other.arrow", format_));
+}
+
 TEST_F(FileSystemDatasetFactoryTest, FilenameNotPartOfPartitions) {
   // ARROW-8726: Ensure filename is not a partition.
 
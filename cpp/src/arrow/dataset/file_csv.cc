@@ -270,7 +270,7 @@ static inline Result<csv::ReadOptions> GetReadOptions(
   auto read_options = csv_scan_options->read_options;
   // Multithreaded conversion of individual files would lead to excessive thread
   // contention when ScanTasks are also executed in multiple threads, so we disable it
-  // here.  Also, this is a no-op since the streaming CSV reader is currently serial
+  // here.
   read_options.use_threads = false;
   return read_options;
 }
@@ -29,9 +29,11 @@
 #include "arrow/io/buffered.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/io/type_fwd.h"
+#include "arrow/ipc/writer.h"
 #include "arrow/json/chunker.h"
 #include "arrow/json/parser.h"
 #include "arrow/json/reader.h"
+#include "arrow/json/writer.h"
 #include "arrow/record_batch.h"
 #include "arrow/type.h"
 #include "arrow/util/async_generator.h"
@@ -419,5 +421,52 @@ Future<std::shared_ptr<FragmentScanner>> JsonFileFormat::BeginScan(
       static_cast<const JsonInspectedFragment&>(inspected), exec_context->executor());
 }
 
+//
+// JsonFileWriter, JsonFileWriteOptions
+//
+
+std::shared_ptr<FileWriteOptions> JsonFileFormat::DefaultWriteOptions() {
+  std::shared_ptr<JsonFileWriteOptions> json_options(
+      new JsonFileWriteOptions(shared_from_this()));
+  json_options->write_options =
+      std::make_shared<json::WriteOptions>(json::WriteOptions::Defaults());
+  return json_options;
+}
+
+Result<std::shared_ptr<FileWriter>> JsonFileFormat::MakeWriter(
+    std::shared_ptr<io::OutputStream> destination, std::shared_ptr<Schema> schema,
+    std::shared_ptr<FileWriteOptions> options,
+    fs::FileLocator destination_locator) const {
+  if (!Equals(*options->format())) {
+    return Status::TypeError("Mismatching format/write options.");
+  }
+  auto json_options = checked_pointer_cast<JsonFileWriteOptions>(options);
+  ARROW_ASSIGN_OR_RAISE(
+      auto writer,
+      json::MakeNDJSONWriter(destination, schema, *json_options->write_options));
+  return std::shared_ptr<FileWriter>(
+      new JsonFileWriter(std::move(destination), std::move(writer), std::move(schema),
+                         std::move(json_options), std::move(destination_locator)));
+}
+
+JsonFileWriter::JsonFileWriter(std::shared_ptr<io::OutputStream> destination,
+                               std::shared_ptr<ipc::RecordBatchWriter> writer,
+                               std::shared_ptr<Schema> schema,
+                               std::shared_ptr<JsonFileWriteOptions> options,
+                               fs::FileLocator destination_locator)
+    : FileWriter(std::move(schema), std::move(options), std::move(destination),
+                 std::move(destination_locator)),
+      batch_writer_(std::move(writer)) {}
+
+Status JsonFileWriter::Write(const std::shared_ptr<RecordBatch>& batch) {
+  return batch_writer_->WriteRecordBatch(*batch);
+}
+
+Future<> JsonFileWriter::FinishInternal() {
+  // The JSON writer's Close() is a no-op, so just treat it as synchronous
+  RETURN_NOT_OK(batch_writer_->Close());
+  return Status::OK();
+}
+
 }  // namespace dataset
 }  // namespace arrow
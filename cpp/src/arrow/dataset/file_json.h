@@ -40,7 +40,7 @@ namespace arrow::dataset {
 
 constexpr char kJsonTypeName[] = "json";
 
-/// \brief A FileFormat implementation that reads from JSON files
+/// \brief A FileFormat implementation that reads from and writes to JSON files
 class ARROW_DS_EXPORT JsonFileFormat : public FileFormat {
  public:
   JsonFileFormat();
@@ -73,11 +73,9 @@ class ARROW_DS_EXPORT JsonFileFormat : public FileFormat {
   Result<std::shared_ptr<FileWriter>> MakeWriter(
       std::shared_ptr<io::OutputStream> destination, std::shared_ptr<Schema> schema,
       std::shared_ptr<FileWriteOptions> options,
-      fs::FileLocator destination_locator) const override {
-    return Status::NotImplemented("Writing JSON files is not currently supported");
-  }
+      fs::FileLocator destination_locator) const override;
 
-  std::shared_ptr<FileWriteOptions> DefaultWriteOptions() override { return NULLPTR; }
+  std::shared_ptr<FileWriteOptions> DefaultWriteOptions() override;
 };
 
 /// \brief Per-scan options for JSON fragments
@@ -93,6 +91,37 @@ struct ARROW_DS_EXPORT JsonFragmentScanOptions : public FragmentScanOptions {
   json::ReadOptions read_options = json::ReadOptions::Defaults();
 };
 
+class ARROW_DS_EXPORT JsonFileWriteOptions : public FileWriteOptions {
+ public:
+  /// Options passed to json::MakeNDJSONWriter.
+  std::shared_ptr<json::WriteOptions> write_options;
+
+ protected:
+  explicit JsonFileWriteOptions(std::shared_ptr<FileFormat> format)
+      : FileWriteOptions(std::move(format)) {}
+
+  friend class JsonFileFormat;
+};
+
+class ARROW_DS_EXPORT JsonFileWriter : public FileWriter {
+ public:
+  Status Write(const std::shared_ptr<RecordBatch>& batch) override;
+
+ private:
+  JsonFileWriter(std::shared_ptr<io::OutputStream> destination,
+                 std::shared_ptr<ipc::RecordBatchWriter> writer,
+                 std::shared_ptr<Schema> schema,
+                 std::shared_ptr<JsonFileWriteOptions> options,
+                 fs::FileLocator destination_locator);
+
+  Future<> FinishInternal() override;
+
+  std::shared_ptr<io::OutputStream> destination_;
+  std::shared_ptr<ipc::RecordBatchWriter> batch_writer_;
+
+  friend class JsonFileFormat;
+};
+
 /// @}
 
 }  // namespace arrow::dataset
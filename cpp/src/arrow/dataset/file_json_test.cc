@@ -22,6 +22,7 @@
 #include "arrow/filesystem/mockfs.h"
 #include "arrow/json/parser.h"
 #include "arrow/json/rapidjson_defs.h"
+#include "arrow/testing/generator.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
 
@@ -297,6 +298,28 @@ TEST_F(TestJsonFormat, InspectFailureWithRelevantError) {
 }
 TEST_F(TestJsonFormat, CountRows) { TestCountRows(); }
 
+TEST_F(TestJsonFormat, WriteRecordBatchReaderCustomOptions) {
+  auto options =
+      checked_pointer_cast<JsonFileWriteOptions>(format_->DefaultWriteOptions());
+  options->write_options->batch_size = 2;
+  options->write_options->use_threads = true;
+  auto data_schema = schema({field("f64", float64())});
+  ASSERT_OK_AND_ASSIGN(auto sink, GetFileSink());
+  ASSERT_OK_AND_ASSIGN(auto fs, fs::internal::MockFileSystem::Make(fs::kNoTime, {}));
+  ASSERT_OK_AND_ASSIGN(auto writer,
+                       format_->MakeWriter(sink, data_schema, options, {fs, "<buffer>"}));
+  ASSERT_OK(writer->Write(ConstantArrayGenerator::Zeroes(5, data_schema)));
+  ASSERT_FINISHES_OK(writer->Finish());
+  ASSERT_OK_AND_ASSIGN(auto written, sink->Finish());
+  ASSERT_EQ(R"({"f64":0}
+{"f64":0}
+{"f64":0}
+{"f64":0}
+{"f64":0}
+)",
+            written->ToString());
+}
+
 // Common tests for new API
 TEST_F(TestJsonFormatV2, IsSupported) { TestIsSupported(); }
 TEST_F(TestJsonFormatV2, Inspect) { TestInspect(); }
@@ -19,6 +19,7 @@
 
 #include <memory>
 #include <mutex>
+#include <string>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -44,6 +45,7 @@
 #include "parquet/encryption/encryption.h"
 #include "parquet/encryption/kms_client.h"
 #include "parquet/file_reader.h"
+#include "parquet/metadata.h"
 #include "parquet/properties.h"
 #include "parquet/statistics.h"
 
@@ -108,6 +110,38 @@ parquet::ReaderProperties MakeReaderProperties(
   return properties;
 }
 
+// Look up the footer of source in the metadata cache of the scan options, if any.
+// If it isn't cached but may be, return the key to cache it under once read.
+std::optional<std::string> LookUpCachedMetadata(
+    const ParquetFragmentScanOptions& parquet_scan_options,
+    const parquet::ReaderProperties& properties, const FileSource& source,
+    std::shared_ptr<parquet::FileMetaData>* metadata) {
+  const auto& info = source.file_info();
+  if (*metadata || !parquet_scan_options.metadata_cache || !source.filesystem() ||
+      properties.file_decryption_properties() || info.size() == fs::kNoSize ||
+      info.mtime() == fs::kNoTime) {
+    return std::nullopt;
+  }
+  // Identify the version of the file, so that the footer of a file that was since
+  // rewritten is not reused
+  std::string key = source.filesystem()->type_name() + ":" + info.path() + ":" +
+                    std::to_string(info.size()) + ":" +
+                    std::to_string(info.mtime().time_since_epoch().count());
+  *metadata = parquet_scan_options.metadata_cache->Get(key);
+  if (*metadata) {
+    return std::nullopt;
+  }
+  return key;
+}
+
+void CacheMetadata(const ParquetFragmentScanOptions& parquet_scan_options,
+                   const std::optional<std::string>& key,
+                   const std::shared_ptr<parquet::FileMetaData>& metadata) {
+  if (key && !metadata->is_encryption_algorithm_set()) {
+    parquet_scan_options.metadata_cache->Put(*key, metadata);
+  }
+}
+
 parquet::ArrowReaderProperties MakeArrowReaderProperties(
     const ParquetFileFormat& format, const parquet::FileMetaData& metadata) {
   parquet::ArrowReaderProperties properties(/* use_threads = */ false);
@@ -483,13 +517,16 @@ Result<std::shared_ptr<parquet::arrow::FileReader>> ParquetFileFormat::GetReader
                                                          default_fragment_scan_options));
   auto properties =
       MakeReaderProperties(*this, parquet_scan_options.get(), "", nullptr, options->pool);
+  std::shared_ptr<parquet::FileMetaData> cached_metadata = metadata;
+  auto cache_key = LookUpCachedMetadata(*parquet_scan_options, properties, source,
+                                        &cached_metadata);
   ARROW_ASSIGN_OR_RAISE(auto input, source.Open());
   // `parquet::ParquetFileReader::Open` will not wrap the exception as status,
   // so using `open_parquet_file` to wrap it.
   auto open_parquet_file = [&]() -> Result<std::unique_ptr<parquet::ParquetFileReader>> {
     BEGIN_PARQUET_CATCH_EXCEPTIONS
-    auto reader = parquet::ParquetFileReader::Open(std::move(input),
-                                                   std::move(properties), metadata);
+    auto reader = parquet::ParquetFileReader::Open(
+        std::move(input), std::move(properties), std::move(cached_metadata));
     return reader;
     END_PARQUET_CATCH_EXCEPTIONS
   };
@@ -501,6 +538,7 @@ Result<std::shared_ptr<parquet::arrow::FileReader>> ParquetFileFormat::GetReader
   auto reader = std::move(reader_opt).ValueOrDie();
 
   std::shared_ptr<parquet::FileMetaData> reader_metadata = reader->metadata();
+  CacheMetadata(*parquet_scan_options, cache_key, reader_metadata);
   auto arrow_properties =
       MakeArrowReaderProperties(*this, *reader_metadata, *options, *parquet_scan_options);
   std::unique_ptr<parquet::arrow::FileReader> arrow_reader;
@@ -524,15 +562,19 @@ Future<std::shared_ptr<parquet::arrow::FileReader>> ParquetFileFormat::GetReader
                                                          default_fragment_scan_options));
   auto properties = MakeReaderProperties(*this, parquet_scan_options.get(), source.path(),
                                          source.filesystem(), options->pool);
+  std::shared_ptr<parquet::FileMetaData> cached_metadata = metadata;
+  auto cache_key = LookUpCachedMetadata(*parquet_scan_options, properties, source,
+                                        &cached_metadata);
   auto self = checked_pointer_cast<const ParquetFileFormat>(shared_from_this());
 
   return source.OpenAsync().Then(
       [=](const std::shared_ptr<io::RandomAccessFile>& input) mutable {
         return parquet::ParquetFileReader::OpenAsync(input, std::move(properties),
-                                                     metadata)
+                                                     std::move(cached_metadata))
             .Then(
                 [=](const std::unique_ptr<parquet::ParquetFileReader>& reader) mutable
                 -> Result<std::shared_ptr<parquet::arrow::FileReader>> {
+                  CacheMetadata(*parquet_scan_options, cache_key, reader->metadata());
                   auto arrow_properties = MakeArrowReaderProperties(
                       *self, *reader->metadata(), *options, *parquet_scan_options);
 
@@ -38,6 +38,7 @@ class Statistics;
 class ColumnChunkMetaData;
 class RowGroupMetaData;
 class FileMetaData;
+class FileMetaDataCache;
 class FileDecryptionProperties;
 class FileEncryptionProperties;
 
@@ -247,6 +248,13 @@ class ARROW_DS_EXPORT ParquetFragmentScanOptions : public FragmentScanOptions {
   std::shared_ptr<parquet::ArrowReaderProperties> arrow_reader_properties;
   /// A configuration structure that provides decryption properties for a dataset
   std::shared_ptr<ParquetDecryptionConfig> parquet_decryption_config = NULLPTR;
+  /// A cache of file footers, which lets scans of files already opened skip reading
+  /// and decoding their footer, e.g. parquet::FileMetaDataCache::Default() to share
+  /// them across the process. Footers are keyed by file path, size and modification
+  /// time, so only files with a known size and modification time (such as those
+  /// discovered by a FileSystemDatasetFactory) are cached. Footers of files read
+  /// with decryption properties are never cached.
+  std::shared_ptr<parquet::FileMetaDataCache> metadata_cache = NULLPTR;
 };
 
 class ARROW_DS_EXPORT ParquetFileWriteOptions : public FileWriteOptions {
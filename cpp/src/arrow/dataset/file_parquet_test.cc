@@ -39,6 +39,7 @@
 #include "arrow/util/io_util.h"
 #include "arrow/util/range.h"
 
+#include "parquet/arrow/reader.h"
 #include "parquet/arrow/writer.h"
 #include "parquet/file_reader.h"
 #include "parquet/metadata.h"
@@ -362,6 +363,53 @@ TEST_F(TestParquetFileFormat, CachedMetadata) {
   ASSERT_NE(nullptr, pq_fragment->metadata());
 }
 
+TEST_F(TestParquetFileFormat, SharedMetadataCache) {
+  const fs::TimePoint mtime{std::chrono::seconds(42)};
+  auto mock_fs = std::make_shared<fs::internal::MockFileSystem>(mtime);
+  std::shared_ptr<Schema> test_schema = schema({field("x", int32())});
+  std::shared_ptr<RecordBatch> batch = RecordBatchFromJSON(test_schema, "[[0]]");
+  ASSERT_OK_AND_ASSIGN(std::shared_ptr<io::OutputStream> out_stream,
+                       mock_fs->OpenOutputStream("/foo.parquet"));
+  ASSERT_OK_AND_ASSIGN(
+      std::shared_ptr<FileWriter> writer,
+      format_->MakeWriter(out_stream, test_schema, format_->DefaultWriteOptions(),
+                          {mock_fs, "/foo.parquet"}));
+  ASSERT_OK(writer->Write(batch));
+  ASSERT_FINISHES_OK(writer->Finish());
+  ASSERT_OK_AND_ASSIGN(auto info, mock_fs->GetFileInfo("/foo.parquet"));
+
+  auto cache = std::make_shared<parquet::FileMetaDataCache>();
+  auto parquet_scan_options = std::make_shared<ParquetFragmentScanOptions>();
+  parquet_scan_options->metadata_cache = cache;
+  auto options = std::make_shared<ScanOptions>();
+  options->fragment_scan_options = parquet_scan_options;
+
+  // The first reader decodes the footer and caches it
+  ASSERT_OK_AND_ASSIGN(auto reader, format_->GetReader({info, mock_fs}, options));
+  ASSERT_EQ(1, cache->num_entries());
+  auto metadata = reader->parquet_reader()->metadata();
+
+  // Readers of other fragments of the same file reuse it, synchronously or not
+  ASSERT_OK_AND_ASSIGN(reader, format_->GetReader({info, mock_fs}, options));
+  ASSERT_EQ(metadata, reader->parquet_reader()->metadata());
+  ASSERT_FINISHES_OK_AND_ASSIGN(reader,
+                                format_->GetReaderAsync({info, mock_fs}, options));
+  ASSERT_EQ(metadata, reader->parquet_reader()->metadata());
+  ASSERT_EQ(1, cache->num_entries());
+
+  // A file modified since is read again
+  auto modified = info;
+  modified.set_mtime(mtime + std::chrono::seconds(1));
+  ASSERT_OK_AND_ASSIGN(reader, format_->GetReader({modified, mock_fs}, options));
+  ASSERT_NE(metadata, reader->parquet_reader()->metadata());
+  ASSERT_EQ(2, cache->num_entries());
+
+  // Files of unknown modification time are not cached
+  ASSERT_OK_AND_ASSIGN(reader, format_->GetReader({"/foo.parquet", mock_fs}, options));
+  ASSERT_NE(metadata, reader->parquet_reader()->metadata());
+  ASSERT_EQ(2, cache->num_entries());
+}
+
 TEST_F(TestParquetFileFormat, MultithreadedScan) {
   constexpr int64_t kNumRowGroups = 16;
 
@@ -48,6 +48,7 @@ class FileFormat;
 class FileFragment;
 class FileWriter;
 class FileWriteOptions;
+class FileSchemaCache;
 class FileSystemDataset;
 class FileSystemDatasetFactory;
 struct FileSystemDatasetWriteOptions;
@@ -0,0 +1,966 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/filesystem/cachingfs.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <list>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "arrow/buffer.h"
+#include "arrow/filesystem/localfs.h"
+#include "arrow/filesystem/path_util.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/io/util_internal.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/future.h"
+#include "arrow/util/hashing.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/string.h"
+#include "arrow/util/string_builder.h"
+#include "arrow/util/value_parsing.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace fs {
+
+using internal::ConcatAbstractPath;
+using internal::EnsureTrailingSlash;
+
+namespace {
+
+// Name of the file holding the FileKey of a cache directory entry
+constexpr std::string_view kKeyFileName = "key";
+
+int64_t ToNanoseconds(TimePoint t) {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(t.time_since_epoch())
+      .count();
+}
+
+bool ParseInt64(std::string_view s, int64_t* out) {
+  return !s.empty() && std::all_of(s.begin(), s.end(),
+                                   [](char c) { return c >= '0' && c <= '9'; }) &&
+         ::arrow::internal::ParseValue<Int64Type>(s.data(), s.size(), out);
+}
+
+// The version of a file whose blocks are cached
+struct FileKey {
+  std::string path;
+  int64_t size;
+  int64_t mtime;
+
+  bool operator==(const FileKey& other) const {
+    return size == other.size && mtime == other.mtime && path == other.path;
+  }
+
+  // The name of the directory holding the blocks of this file version
+  std::string DirName() const {
+    std::string s = ToString();
+    const uint64_t hash = ::arrow::internal::ComputeStringHash<0>(
+        s.data(), static_cast<int64_t>(s.size()));
+    return ::arrow::HexEncode(reinterpret_cast<const uint8_t*>(&hash), sizeof(hash));
+  }
+
+  // The path comes last, as it may contain any character
+  std::string ToString(int64_t block_size = 0) const {
+    return ::arrow::util::StringBuilder(size, "\n", mtime, "\n", block_size, "\n", path);
+  }
+
+  static bool FromString(std::string_view s, FileKey* key, int64_t* block_size) {
+    std::string_view fields[3];
+    for (auto& field : fields) {
+      const auto pos = s.find('\n');
+      if (pos == std::string_view::npos) {
+        return false;
+      }
+      field = s.substr(0, pos);
+      s.remove_prefix(pos + 1);
+    }
+    key->path = std::string(s);
+    return ParseInt64(fields[0], &key->size) && ParseInt64(fields[1], &key->mtime) &&
+           ParseInt64(fields[2], block_size);
+  }
+};
+
+}  // namespace
+
+CachingFileSystemOptions CachingFileSystemOptions::Defaults() {
+  return CachingFileSystemOptions();
+}
+
+bool CachingFileSystemOptions::Equals(const CachingFileSystemOptions& other) const {
+  return cache_dir == other.cache_dir && block_size == other.block_size &&
+         max_cache_size == other.max_cache_size;
+}
+
+// The block cache shared by a CachingFileSystem and the files it opened.
+//
+// Each cached file version has a directory in the cache directory, named after
+// a hash of its FileKey and holding a key file and one file per cached block
+// (named after the block index).  Blocks are written to a temporary file and
+// then renamed, so that a crash never leaves a truncated block behind.
+//
+// The mutex only guards the bookkeeping: files and directories are created,
+// written and deleted after releasing it.  A new entry's directory is set up by
+// the read that created the entry, which other reads of the entry wait for, and
+// is only set up once any pending deletion of the same directory is done.
+class CachingFileSystem::Impl : public std::enable_shared_from_this<Impl> {
+ public:
+  class CachedFile;
+
+  Impl(const CachingFileSystemOptions& options, const io::IOContext& io_context)
+      : options_(options), io_context_(io_context), local_fs_(io_context) {}
+
+  Status Init() {
+    if (options_.cache_dir.empty()) {
+      return Status::Invalid("CachingFileSystem requires a cache directory");
+    }
+    if (options_.block_size <= 0) {
+      return Status::Invalid("CachingFileSystem block size must be positive");
+    }
+    if (options_.max_cache_size < options_.block_size) {
+      return Status::Invalid("CachingFileSystem cache size (", options_.max_cache_size,
+                             ") must be at least the block size (", options_.block_size,
+                             ")");
+    }
+    ARROW_ASSIGN_OR_RAISE(cache_dir_, local_fs_.NormalizePath(options_.cache_dir));
+    RETURN_NOT_OK(local_fs_.CreateDir(cache_dir_, /*recursive=*/true));
+    return LoadCacheDir();
+  }
+
+  const io::IOContext& io_context() const { return io_context_; }
+
+  CachingFileSystemStats stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+  }
+
+  // Open `info` through the cache, or return null if it cannot be cached
+  Result<std::shared_ptr<io::RandomAccessFile>> OpenInputFile(
+      const std::shared_ptr<FileSystem>& base_fs, const FileInfo& info);
+
+  // Drop the cached blocks of the given file
+  void Invalidate(const std::string& path) {
+    Deletions deletions;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = entries_.find(path);
+      if (it != entries_.end()) {
+        DropEntry(it->second, &deletions);
+      }
+    }
+    Delete(&deletions);
+  }
+
+  // Drop the cached blocks of the files under the given directory
+  // (all files if `dir` is empty)
+  void InvalidateTree(const std::string& dir) {
+    const auto prefix = EnsureTrailingSlash(dir);
+    Deletions deletions;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      std::vector<std::shared_ptr<Entry>> to_drop;
+      for (const auto& [path, entry] : entries_) {
+        if (dir.empty() || path == dir || ::arrow::internal::StartsWith(path, prefix)) {
+          to_drop.push_back(entry);
+        }
+      }
+      for (const auto& entry : to_drop) {
+        DropEntry(entry, &deletions);
+      }
+    }
+    Delete(&deletions);
+  }
+
+ private:
+  struct Block {
+    std::string path;
+    int64_t index;
+    int64_t size;
+  };
+  using BlockList = std::list<Block>;
+
+  struct Entry {
+    FileKey key;
+    std::string dir;
+    std::unordered_map<int64_t, BlockList::iterator> blocks;
+    // Blocks being fetched from the base filesystem, which concurrent reads
+    // wait for rather than fetching them again
+    std::unordered_map<int64_t, Future<std::shared_ptr<Buffer>>> fetches;
+    // Finished once the directory is set up, or failed to be
+    Future<> ready = Future<>::MakeFinished();
+    // The deletion of the directory by a previously dropped entry, which must be
+    // done before the directory is set up
+    Future<> previous_deleted = Future<>::MakeFinished();
+    // Finished once the directory is deleted, after the entry was dropped
+    Future<> deleted = Future<>::Make();
+  };
+
+  // Local files and directories to delete once the mutex is released
+  struct Deletions {
+    std::vector<std::string> files;
+    // Dropped entries, whose directories are deleted
+    std::vector<std::shared_ptr<Entry>> entries;
+  };
+
+  Result<std::shared_ptr<Buffer>> ReadRange(CachedFile* file, int64_t position,
+                                            int64_t nbytes);
+
+  int64_t BlockLength(const FileKey& key, int64_t index) const {
+    return std::min(options_.block_size, key.size - index * options_.block_size);
+  }
+
+  std::string BlockPath(const Entry& entry, int64_t index) const {
+    return ConcatAbstractPath(entry.dir, ::arrow::internal::ToChars(index));
+  }
+
+  Status LoadCacheDir();
+  Status LoadEntry(const FileInfo& dir_info, std::vector<std::pair<TimePoint, Block>>*);
+
+  // The following must be called with the mutex held.  They record the local
+  // files and directories to delete in `deletions`.
+
+  // Return the entry for `key`, replacing any entry for another version of the
+  // file.  `*created` is set if the entry is new, in which case the caller must
+  // call SetUpEntry() once the mutex is released.
+  std::shared_ptr<Entry> GetEntry(const FileKey& key, bool* created,
+                                  Deletions* deletions);
+  // `entry` is taken by value, as callers may pass the one held by `entries_`
+  void DropEntry(std::shared_ptr<Entry> entry, Deletions* deletions);
+  void DropBlock(Entry* entry, int64_t index, Deletions* deletions);
+  void InsertBlock(Entry* entry, int64_t index, int64_t size);
+  void Evict(Deletions* deletions);
+
+  // The following must be called without the mutex held
+
+  // Create the directory of a new entry and write its key file
+  void SetUpEntry(const std::shared_ptr<Entry>& entry);
+  void Delete(Deletions* deletions);
+  // Write a fetched block to the cache directory and unregister its fetch
+  void StoreBlock(const std::shared_ptr<Entry>& entry, int64_t index,
+                  const std::shared_ptr<Buffer>& data);
+
+  Result<std::shared_ptr<Buffer>> ReadLocalFile(const std::string& path) {
+    ARROW_ASSIGN_OR_RAISE(auto file, local_fs_.OpenInputFile(path));
+    ARROW_ASSIGN_OR_RAISE(auto size, file->GetSize());
+    return file->ReadAt(0, size);
+  }
+
+  Status WriteLocalFile(const std::string& path, const Buffer& data) {
+    ARROW_ASSIGN_OR_RAISE(auto file, local_fs_.OpenOutputStream(path));
+    RETURN_NOT_OK(file->Write(data.data(), data.size()));
+    return file->Close();
+  }
+
+  const CachingFileSystemOptions options_;
+  const io::IOContext io_context_;
+  LocalFileSystem local_fs_;
+  std::string cache_dir_;
+  std::atomic<int64_t> temp_counter_{0};
+
+  mutable std::mutex mutex_;
+  // By file path
+  std::unordered_map<std::string, std::shared_ptr<Entry>> entries_;
+  // File path by entry directory, to detect hash collisions
+  std::unordered_map<std::string, std::string> dir_paths_;
+  // Dropped entries by directory, until their directory is deleted
+  std::unordered_map<std::string, std::shared_ptr<Entry>> deleting_dirs_;
+  // Cached blocks, most recently used first
+  BlockList lru_;
+  CachingFileSystemStats stats_;
+};
+
+class CachingFileSystem::Impl::CachedFile : public io::RandomAccessFile {
+ public:
+  CachedFile(std::shared_ptr<CachingFileSystem::Impl> impl,
+             std::shared_ptr<FileSystem> base_fs, FileInfo info, FileKey key)
+      : impl_(std::move(impl)),
+        base_fs_(std::move(base_fs)),
+        info_(std::move(info)),
+        key_(std::move(key)) {}
+
+  const FileKey& key() const { return key_; }
+
+  // The base file is only opened once a block must be fetched
+  Result<std::shared_ptr<io::RandomAccessFile>> base_file() {
+    std::lock_guard<std::mutex> lock(base_file_mutex_);
+    RETURN_NOT_OK(CheckClosed());
+    if (base_file_ == nullptr) {
+      ARROW_ASSIGN_OR_RAISE(base_file_, base_fs_->OpenInputFile(info_));
+    }
+    return base_file_;
+  }
+
+  Status CheckClosed() const {
+    if (closed_) {
+      return Status::Invalid("Operation on closed file");
+    }
+    return Status::OK();
+  }
+
+  Status Close() override {
+    std::lock_guard<std::mutex> lock(base_file_mutex_);
+    closed_ = true;
+    if (base_file_ != nullptr) {
+      auto base_file = std::move(base_file_);
+      return base_file->Close();
+    }
+    return Status::OK();
+  }
+
+  bool closed() const override { return closed_; }
+
+  Result<int64_t> Tell() const override {
+    RETURN_NOT_OK(CheckClosed());
+    return pos_;
+  }
+
+  Result<int64_t> GetSize() override {
+    RETURN_NOT_OK(CheckClosed());
+    return key_.size;
+  }
+
+  Status Seek(int64_t position) override {
+    RETURN_NOT_OK(CheckClosed());
+    if (position < 0 || position > key_.size) {
+      return Status::IOError("Cannot seek to position ", position, " in file of size ",
+                             key_.size);
+    }
+    pos_ = position;
+    return Status::OK();
+  }
+
+  Result<std::shared_ptr<Buffer>> ReadAt(int64_t position, int64_t nbytes) override {
+    RETURN_NOT_OK(CheckClosed());
+    ARROW_ASSIGN_OR_RAISE(nbytes,
+                          io::internal::ValidateReadRange(position, nbytes, key_.size));
+    if (nbytes == 0) {
+      return std::make_shared<Buffer>(nullptr, 0);
+    }
+    return impl_->ReadRange(this, position, nbytes);
+  }
+
+  Result<int64_t> ReadAt(int64_t position, int64_t nbytes, void* out) override {
+    ARROW_ASSIGN_OR_RAISE(auto buffer, ReadAt(position, nbytes));
+    if (buffer->size() > 0) {
+      std::memcpy(out, buffer->data(), static_cast<size_t>(buffer->size()));
+    }
+    return buffer->size();
+  }
+
+  Result<std::shared_ptr<Buffer>> Read(int64_t nbytes) override {
+    ARROW_ASSIGN_OR_RAISE(auto buffer, ReadAt(pos_, nbytes));
+    pos_ += buffer->size();
+    return buffer;
+  }
+
+  Result<int64_t> Read(int64_t nbytes, void* out) override {
+    ARROW_ASSIGN_OR_RAISE(int64_t bytes_read, ReadAt(pos_, nbytes, out));
+    pos_ += bytes_read;
+    return bytes_read;
+  }
+
+ private:
+  const std::shared_ptr<CachingFileSystem::Impl> impl_;
+  const std::shared_ptr<FileSystem> base_fs_;
+  const FileInfo info_;
+  const FileKey key_;
+
+  std::mutex base_file_mutex_;
+  std::shared_ptr<io::RandomAccessFile> base_file_;
+  std::atomic<bool> closed_{false};
+  int64_t pos_ = 0;
+};
+
+Result<std::shared_ptr<io::RandomAccessFile>> CachingFileSystem::Impl::OpenInputFile(
+    const std::shared_ptr<FileSystem>& base_fs, const FileInfo& info) {
+  if (!info.IsFile() || info.size() == kNoSize || info.mtime() == kNoTime) {
+    return nullptr;
+  }
+  FileKey key{info.path(), info.size(), ToNanoseconds(info.mtime())};
+  return std::make_shared<CachedFile>(shared_from_this(), base_fs, info, std::move(key));
+}
+
+Result<std::shared_ptr<Buffer>> CachingFileSystem::Impl::ReadRange(CachedFile* file,
+                                                                   int64_t position,
+                                                                   int64_t nbytes) {
+  const FileKey& key = file->key();
+  const int64_t block_size = options_.block_size;
+  const int64_t first_block = position / block_size;
+  const int64_t end_block = (position + nbytes - 1) / block_size + 1;
+
+  std::shared_ptr<Entry> entry;
+  bool created = false;
+  Deletions deletions;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entry = GetEntry(key, &created, &deletions);
+  }
+  Delete(&deletions);
+  if (created) {
+    SetUpEntry(entry);
+  }
+  Status ready = entry->ready.status();
+  if (!ready.ok()) {
+    // The cache directory is unusable, read from the base file
+    ready.Warn();
+    ARROW_ASSIGN_OR_RAISE(auto base, file->base_file());
+    return base->ReadAt(position, nbytes);
+  }
+
+  // Sort the blocks into those read from the cache directory, those fetched
+  // by this call and those being fetched by another call
+  std::vector<int64_t> cached_blocks, fetched_blocks;
+  std::vector<Future<std::shared_ptr<Buffer>>> fetch_futures;
+  std::vector<std::pair<int64_t, Future<std::shared_ptr<Buffer>>>> pending_blocks;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (int64_t index = first_block; index < end_block; ++index) {
+      auto block_it = entry->blocks.find(index);
+      if (block_it != entry->blocks.end()) {
+        lru_.splice(lru_.begin(), lru_, block_it->second);
+        cached_blocks.push_back(index);
+        ++stats_.hits;
+        continue;
+      }
+      auto fetch_it = entry->fetches.find(index);
+      if (fetch_it != entry->fetches.end()) {
+        pending_blocks.emplace_back(index, fetch_it->second);
+        ++stats_.hits;
+      } else {
+        auto fut = Future<std::shared_ptr<Buffer>>::Make();
+        entry->fetches.emplace(index, fut);
+        fetched_blocks.push_back(index);
+        fetch_futures.push_back(std::move(fut));
+        ++stats_.misses;
+      }
+    }
+  }
+
+  // The part of each block covered by the read
+  std::vector<std::shared_ptr<Buffer>> pieces(end_block - first_block);
+  auto block_piece = [&](int64_t index, int64_t* offset, int64_t* length) {
+    const int64_t block_start = index * block_size;
+    *offset = std::max(position, block_start) - block_start;
+    *length = std::min(position + nbytes, block_start + BlockLength(key, index)) -
+              block_start - *offset;
+  };
+  auto set_piece = [&](int64_t index, const std::shared_ptr<Buffer>& block) {
+    int64_t offset, length;
+    block_piece(index, &offset, &length);
+    pieces[index - first_block] = SliceBuffer(block, offset, length);
+  };
+
+  // Fetch missing blocks from the base filesystem, coalescing consecutive ones.
+  // Every future this call registered must be finished, even on error.
+  Status fetch_status;
+  for (size_t run_start = 0; run_start < fetched_blocks.size();) {
+    size_t run_end = run_start + 1;
+    while (run_end < fetched_blocks.size() &&
+           fetched_blocks[run_end] == fetched_blocks[run_end - 1] + 1) {
+      ++run_end;
+    }
+    const int64_t first = fetched_blocks[run_start];
+    const int64_t last = fetched_blocks[run_end - 1];
+    const int64_t offset = first * block_size;
+    const int64_t length = last * block_size + BlockLength(key, last) - offset;
+
+    Result<std::shared_ptr<Buffer>> maybe_data;
+    if (fetch_status.ok()) {
+      maybe_data = file->base_file().Map([&](std::shared_ptr<io::RandomAccessFile> base) {
+        return base->ReadAt(offset, length);
+      });
+      if (maybe_data.ok() && (*maybe_data)->size() != length) {
+        maybe_data = Status::IOError("File '", key.path, "' was modified while reading");
+      }
+      fetch_status = maybe_data.status();
+    } else {
+      maybe_data = fetch_status;
+    }
+    if (maybe_data.ok()) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stats_.bytes_fetched += length;
+    }
+
+    for (size_t i = run_start; i < run_end; ++i) {
+      const int64_t index = fetched_blocks[i];
+      Result<std::shared_ptr<Buffer>> block;
+      if (maybe_data.ok()) {
+        block = SliceBuffer(*maybe_data, (index - first) * block_size,
+                            BlockLength(key, index));
+        set_piece(index, *block);
+        StoreBlock(entry, index, *block);
+      } else {
+        block = maybe_data.status();
+        std::lock_guard<std::mutex> lock(mutex_);
+        entry->fetches.erase(index);
+      }
+      fetch_futures[i].MarkFinished(std::move(block));
+    }
+    run_start = run_end;
+  }
+  RETURN_NOT_OK(fetch_status);
+
+  // Read cached blocks from the cache directory
+  for (const int64_t index : cached_blocks) {
+    int64_t offset, length;
+    block_piece(index, &offset, &length);
+    auto maybe_piece =
+        local_fs_.OpenInputFile(BlockPath(*entry, index))
+            .Map([&](std::shared_ptr<io::RandomAccessFile> local) {
+              return local->ReadAt(offset, length);
+            });
+    if (maybe_piece.ok() && (*maybe_piece)->size() == length) {
+      pieces[index - first_block] = std::move(maybe_piece).MoveValueUnsafe();
+      continue;
+    }
+    // The block file is unreadable (or was just evicted), read from the base file
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      DropBlock(entry.get(), index, &deletions);
+    }
+    Delete(&deletions);
+    ARROW_ASSIGN_OR_RAISE(auto base, file->base_file());
+    ARROW_ASSIGN_OR_RAISE(pieces[index - first_block],
+                          base->ReadAt(index * block_size + offset, length));
+  }
+
+  // Wait for blocks fetched by other reads
+  for (auto& [index, fut] : pending_blocks) {
+    ARROW_ASSIGN_OR_RAISE(auto block, fut.result());
+    set_piece(index, block);
+  }
+
+  if (pieces.size() == 1) {
+    return std::move(pieces[0]);
+  }
+  ARROW_ASSIGN_OR_RAISE(auto out, AllocateBuffer(nbytes, io_context_.pool()));
+  uint8_t* dest = out->mutable_data();
+  for (const auto& piece : pieces) {
+    std::memcpy(dest, piece->data(), static_cast<size_t>(piece->size()));
+    dest += piece->size();
+  }
+  return std::shared_ptr<Buffer>(std::move(out));
+}
+
+Status CachingFileSystem::Impl::LoadCacheDir() {
+  // Nothing else uses the cache before Init() returns, so the directory is
+  // scanned without the mutex
+  FileSelector select;
+  select.base_dir = cache_dir_;
+  ARROW_ASSIGN_OR_RAISE(auto infos, local_fs_.GetFileInfo(select));
+  std::vector<std::pair<TimePoint, Block>> blocks;
+  for (const auto& info : infos) {
+    if (info.IsDirectory()) {
+      RETURN_NOT_OK(LoadEntry(info, &blocks));
+    } else {
+      RETURN_NOT_OK(local_fs_.DeleteFile(info.path()));
+    }
+  }
+
+  // The last use of a block isn't persisted, so assume it is when it was written
+  std::stable_sort(blocks.begin(), blocks.end(), [](const auto& a, const auto& b) {
+    return a.first > b.first;
+  });
+  Deletions deletions;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto& [mtime, block] : blocks) {
+      Entry* entry = entries_[block.path].get();
+      lru_.push_back(std::move(block));
+      entry->blocks.emplace(lru_.back().index, std::prev(lru_.end()));
+      stats_.bytes_cached += lru_.back().size;
+    }
+    Evict(&deletions);
+  }
+  Delete(&deletions);
+  return Status::OK();
+}
+
+Status CachingFileSystem::Impl::LoadEntry(
+    const FileInfo& dir_info, std::vector<std::pair<TimePoint, Block>>* blocks) {
+  // Entries of another block size, with an invalid key, or for a file version
+  // already loaded, are dropped
+  FileKey key;
+  int64_t block_size;
+  auto maybe_key = ReadLocalFile(ConcatAbstractPath(dir_info.path(), kKeyFileName));
+  if (!maybe_key.ok() ||
+      !FileKey::FromString(std::string_view(**maybe_key), &key, &block_size) ||
+      block_size != options_.block_size || key.DirName() != dir_info.base_name() ||
+      entries_.find(key.path) != entries_.end()) {
+    return local_fs_.DeleteDir(dir_info.path());
+  }
+
+  auto entry = std::make_shared<Entry>();
+  entry->key = key;
+  entry->dir = dir_info.path();
+  const int64_t num_blocks = (key.size + block_size - 1) / block_size;
+
+  FileSelector select;
+  select.base_dir = dir_info.path();
+  ARROW_ASSIGN_OR_RAISE(auto infos, local_fs_.GetFileInfo(select));
+  for (const auto& info : infos) {
+    if (info.base_name() == kKeyFileName) {
+      continue;
+    }
+    // Leftover temporary files and truncated blocks are dropped
+    int64_t index;
+    if (info.IsFile() && ParseInt64(info.base_name(), &index) && index < num_blocks &&
+        info.size() == BlockLength(key, index)) {
+      blocks->emplace_back(info.mtime(), Block{key.path, index, info.size()});
+    } else {
+      RETURN_NOT_OK(info.IsDirectory() ? local_fs_.DeleteDir(info.path())
+                                       : local_fs_.DeleteFile(info.path()));
+    }
+  }
+  dir_paths_.emplace(entry->dir, key.path);
+  entries_.emplace(key.path, std::move(entry));
+  return Status::OK();
+}
+
+std::shared_ptr<CachingFileSystem::Impl::Entry> CachingFileSystem::Impl::GetEntry(
+    const FileKey& key, bool* created, Deletions* deletions) {
+  *created = false;
+  auto it = entries_.find(key.path);
+  if (it != entries_.end()) {
+    if (it->second->key == key) {
+      return it->second;
+    }
+    DropEntry(it->second, deletions);
+  }
+  const auto dir = ConcatAbstractPath(cache_dir_, key.DirName());
+  auto dir_it = dir_paths_.find(dir);
+  if (dir_it != dir_paths_.end()) {
+    // Hash collision with another file
+    DropEntry(entries_.at(dir_it->second), deletions);
+  }
+
+  auto entry = std::make_shared<Entry>();
+  entry->key = key;
+  entry->dir = dir;
+  entry->ready = Future<>::Make();
+  auto deleting_it = deleting_dirs_.find(dir);
+  if (deleting_it != deleting_dirs_.end()) {
+    entry->previous_deleted = deleting_it->second->deleted;
+  }
+  dir_paths_.emplace(dir, key.path);
+  entries_.emplace(key.path, entry);
+  *created = true;
+  return entry;
+}
+
+void CachingFileSystem::Impl::DropEntry(std::shared_ptr<Entry> entry,
+                                        Deletions* deletions) {
+  for (const auto& [index, block_it] : entry->blocks) {
+    stats_.bytes_cached -= block_it->size;
+    lru_.erase(block_it);
+  }
+  entry->blocks.clear();
+  auto it = entries_.find(entry->key.path);
+  if (it != entries_.end() && it->second == entry) {
+    entries_.erase(it);
+    dir_paths_.erase(entry->dir);
+    deleting_dirs_[entry->dir] = entry;
+    deletions->entries.push_back(std::move(entry));
+  }
+}
+
+void CachingFileSystem::Impl::DropBlock(Entry* entry, int64_t index,
+                                        Deletions* deletions) {
+  auto it = entry->blocks.find(index);
+  if (it == entry->blocks.end()) {
+    return;
+  }
+  stats_.bytes_cached -= it->second->size;
+  lru_.erase(it->second);
+  entry->blocks.erase(it);
+  deletions->files.push_back(BlockPath(*entry, index));
+}
+
+void CachingFileSystem::Impl::InsertBlock(Entry* entry, int64_t index, int64_t size) {
+  lru_.push_front(Block{entry->key.path, index, size});
+  entry->blocks.emplace(index, lru_.begin());
+  stats_.bytes_cached += size;
+}
+
+void CachingFileSystem::Impl::Evict(Deletions* deletions) {
+  while (stats_.bytes_cached > options_.max_cache_size && !lru_.empty()) {
+    const auto entry = entries_.at(lru_.back().path);
+    DropBlock(entry.get(), lru_.back().index, deletions);
+    ++stats_.evictions;
+    if (entry->blocks.empty() && entry->fetches.empty()) {
+      DropEntry(entry, deletions);
+    }
+  }
+}
+
+void CachingFileSystem::Impl::SetUpEntry(const std::shared_ptr<Entry>& entry) {
+  auto set_up = [&]() -> Status {
+    RETURN_NOT_OK(entry->previous_deleted.status());
+    // The directory may be a leftover from an entry that failed to be deleted
+    RETURN_NOT_OK(local_fs_.CreateDir(entry->dir, /*recursive=*/false));
+    RETURN_NOT_OK(local_fs_.DeleteDirContents(entry->dir));
+    return WriteLocalFile(ConcatAbstractPath(entry->dir, kKeyFileName),
+                          *Buffer::FromString(entry->key.ToString(options_.block_size)));
+  };
+  Status st = set_up();
+  if (!st.ok()) {
+    Deletions deletions;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      DropEntry(entry, &deletions);
+    }
+    entry->ready.MarkFinished(st);
+    Delete(&deletions);
+    return;
+  }
+  entry->ready.MarkFinished();
+}
+
+void CachingFileSystem::Impl::Delete(Deletions* deletions) {
+  // A block file may already be gone, if it was found missing when reading it
+  for (const auto& path : deletions->files) {
+    ARROW_UNUSED(local_fs_.DeleteFile(path));
+  }
+  for (const auto& entry : deletions->entries) {
+    // Don't race with the setup of the directory
+    ARROW_UNUSED(entry->ready.status());
+    ARROW_WARN_NOT_OK(local_fs_.DeleteDir(entry->dir), "Failed to delete cache entry");
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = deleting_dirs_.find(entry->dir);
+      if (it != deleting_dirs_.end() && it->second == entry) {
+        deleting_dirs_.erase(it);
+      }
+    }
+    entry->deleted.MarkFinished();
+  }
+  deletions->files.clear();
+  deletions->entries.clear();
+}
+
+void CachingFileSystem::Impl::StoreBlock(const std::shared_ptr<Entry>& entry,
+                                         int64_t index,
+                                         const std::shared_ptr<Buffer>& data) {
+  const auto path = BlockPath(*entry, index);
+  const auto temp_path = path + ".tmp" + ::arrow::internal::ToChars(temp_counter_++);
+  // Failing to cache a block doesn't fail the read
+  Status st = WriteLocalFile(temp_path, *data);
+  if (st.ok()) {
+    st = local_fs_.Move(temp_path, path);
+  }
+
+  Deletions deletions;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entry->fetches.erase(index);
+    auto it = entries_.find(entry->key.path);
+    if (st.ok() && it != entries_.end() && it->second == entry) {
+      InsertBlock(entry.get(), index, data->size());
+      Evict(&deletions);
+    } else {
+      // The entry may have been dropped along with its directory
+      deletions.files.push_back(st.ok() ? path : temp_path);
+    }
+  }
+  if (!st.ok()) {
+    st.Warn();
+  }
+  Delete(&deletions);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// CachingFileSystem implementation
+
+namespace {
+
+// Return a FileInfo with the file's type, size and modification time
+Result<FileInfo> CompleteFileInfo(FileSystem* base_fs, const FileInfo& info) {
+  if (info.IsFile() && info.size() != kNoSize && info.mtime() != kNoTime) {
+    return info;
+  }
+  return base_fs->GetFileInfo(info.path());
+}
+
+}  // namespace
+
+CachingFileSystem::CachingFileSystem(std::shared_ptr<FileSystem> base_fs,
+                                     const CachingFileSystemOptions& options)
+    : FileSystem(base_fs->io_context()),
+      base_fs_(std::move(base_fs)),
+      options_(options),
+      impl_(std::make_shared<Impl>(options_, io_context_)) {
+  default_async_is_sync_ = false;
+}
+
+CachingFileSystem::~CachingFileSystem() = default;
+
+Result<std::shared_ptr<CachingFileSystem>> CachingFileSystem::Make(
+    std::shared_ptr<FileSystem> base_fs, const CachingFileSystemOptions& options) {
+  if (base_fs == nullptr) {
+    return Status::Invalid("CachingFileSystem requires a base filesystem");
+  }
+  std::shared_ptr<CachingFileSystem> fs(
+      new CachingFileSystem(std::move(base_fs), options));
+  RETURN_NOT_OK(fs->impl_->Init());
+  return fs;
+}
+
+CachingFileSystemStats CachingFileSystem::stats() const { return impl_->stats(); }
+
+Result<std::string> CachingFileSystem::NormalizePath(std::string path) {
+  return base_fs_->NormalizePath(std::move(path));
+}
+
+Result<std::string> CachingFileSystem::PathFromUri(const std::string& uri_string) const {
+  return base_fs_->PathFromUri(uri_string);
+}
+
+bool CachingFileSystem::Equals(const FileSystem& other) const {
+  if (this == &other) {
+    return true;
+  }
+  if (other.type_name() != type_name()) {
+    return false;
+  }
+  const auto& caching = checked_cast<const CachingFileSystem&>(other);
+  return options_.Equals(caching.options_) && base_fs_->Equals(caching.base_fs_);
+}
+
+Result<FileInfo> CachingFileSystem::GetFileInfo(const std::string& path) {
+  return base_fs_->GetFileInfo(path);
+}
+
+Result<FileInfoVector> CachingFileSystem::GetFileInfo(const FileSelector& select) {
+  return base_fs_->GetFileInfo(select);
+}
+
+FileInfoGenerator CachingFileSystem::GetFileInfoGenerator(const FileSelector& select) {
+  return base_fs_->GetFileInfoGenerator(select);
+}
+
+Status CachingFileSystem::CreateDir(const std::string& path, bool recursive) {
+  return base_fs_->CreateDir(path, recursive);
+}
+
+Status CachingFileSystem::DeleteDir(const std::string& path) {
+  auto st = base_fs_->DeleteDir(path);
+  impl_->InvalidateTree(path);
+  return st;
+}
+
+Status CachingFileSystem::DeleteDirContents(const std::string& path,
+                                            bool missing_dir_ok) {
+  auto st = base_fs_->DeleteDirContents(path, missing_dir_ok);
+  if (!path.empty()) {
+    impl_->InvalidateTree(path);
+  }
+  return st;
+}
+
+Status CachingFileSystem::DeleteRootDirContents() {
+  auto st = base_fs_->DeleteRootDirContents();
+  impl_->InvalidateTree("");
+  return st;
+}
+
+Status CachingFileSystem::DeleteFile(const std::string& path) {
+  auto st = base_fs_->DeleteFile(path);
+  impl_->Invalidate(path);
+  return st;
+}
+
+Status CachingFileSystem::Move(const std::string& src, const std::string& dest) {
+  auto st = base_fs_->Move(src, dest);
+  impl_->InvalidateTree(src);
+  impl_->InvalidateTree(dest);
+  return st;
+}
+
+Status CachingFileSystem::CopyFile(const std::string& src, const std::string& dest) {
+  auto st = base_fs_->CopyFile(src, dest);
+  impl_->Invalidate(dest);
+  return st;
+}
+
+Result<std::shared_ptr<io::InputStream>> CachingFileSystem::OpenInputStream(
+    const std::string& path) {
+  ARROW_ASSIGN_OR_RAISE(auto info, base_fs_->GetFileInfo(path));
+  if (!info.IsFile()) {
+    // Let the base filesystem report the error
+    return base_fs_->OpenInputStream(path);
+  }
+  return OpenInputStream(info);
+}
+
+Result<std::shared_ptr<io::InputStream>> CachingFileSystem::OpenInputStream(
+    const FileInfo& info) {
+  ARROW_ASSIGN_OR_RAISE(auto full_info, CompleteFileInfo(base_fs_.get(), info));
+  ARROW_ASSIGN_OR_RAISE(auto file, impl_->OpenInputFile(base_fs_, full_info));
+  if (file == nullptr) {
+    return base_fs_->OpenInputStream(info);
+  }
+  return io::RandomAccessFile::GetStream(std::move(file), 0, full_info.size());
+}
+
+Result<std::shared_ptr<io::RandomAccessFile>> CachingFileSystem::OpenInputFile(
+    const std::string& path) {
+  ARROW_ASSIGN_OR_RAISE(auto info, base_fs_->GetFileInfo(path));
+  if (!info.IsFile()) {
+    // Let the base filesystem report the error
+    return base_fs_->OpenInputFile(path);
+  }
+  return OpenInputFile(info);
+}
+
+Result<std::shared_ptr<io::RandomAccessFile>> CachingFileSystem::OpenInputFile(
+    const FileInfo& info) {
+  ARROW_ASSIGN_OR_RAISE(auto full_info, CompleteFileInfo(base_fs_.get(), info));
+  ARROW_ASSIGN_OR_RAISE(auto file, impl_->OpenInputFile(base_fs_, full_info));
+  if (file == nullptr) {
+    return base_fs_->OpenInputFile(info);
+  }
+  return file;
+}
+
+Result<std::shared_ptr<io::OutputStream>> CachingFileSystem::OpenOutputStream(
+    const std::string& path, const std::shared_ptr<const KeyValueMetadata>& metadata) {
+  auto maybe_stream = base_fs_->OpenOutputStream(path, metadata);
+  impl_->Invalidate(path);
+  return maybe_stream;
+}
+
+Result<std::shared_ptr<io::OutputStream>> CachingFileSystem::OpenAppendStream(
+    const std::string& path, const std::shared_ptr<const KeyValueMetadata>& metadata) {
+  auto maybe_stream = base_fs_->OpenAppendStream(path, metadata);
+  impl_->Invalidate(path);
+  return maybe_stream;
+}
+
+}  // namespace fs
+}  // namespace arrow
@@ -0,0 +1,164 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "arrow/filesystem/filesystem.h"
+
+namespace arrow {
+namespace fs {
+
+/// Options for the CachingFileSystem implementation.
+struct ARROW_EXPORT CachingFileSystemOptions {
+  static constexpr int64_t kDefaultBlockSize = 4 * 1024 * 1024;
+  static constexpr int64_t kDefaultMaxCacheSize = int64_t(10) * 1024 * 1024 * 1024;
+
+  /// The local directory holding the cached data.
+  ///
+  /// The directory is created if it doesn't exist.  It is owned by the
+  /// CachingFileSystem: unrecognized files in it may be deleted, and it must
+  /// not be used by several CachingFileSystem instances at once.
+  std::string cache_dir;
+
+  /// The size of the blocks in which files are fetched and cached.
+  ///
+  /// Reads are widened to whole blocks when fetching from the base filesystem,
+  /// so larger blocks issue fewer requests but fetch more unneeded data.
+  int64_t block_size = kDefaultBlockSize;
+
+  /// The maximum number of bytes kept in the cache directory.
+  ///
+  /// The least recently used blocks are evicted above this size.
+  int64_t max_cache_size = kDefaultMaxCacheSize;
+
+  /// \brief Initialize with defaults
+  static CachingFileSystemOptions Defaults();
+
+  bool Equals(const CachingFileSystemOptions& other) const;
+};
+
+/// \brief Statistics about a CachingFileSystem's cache.
+struct ARROW_EXPORT CachingFileSystemStats {
+  /// Number of block reads served from the cache directory
+  int64_t hits = 0;
+  /// Number of block reads fetched from the base filesystem
+  int64_t misses = 0;
+  /// Number of bytes fetched from the base filesystem
+  int64_t bytes_fetched = 0;
+  /// Number of bytes currently in the cache directory
+  int64_t bytes_cached = 0;
+  /// Number of blocks evicted from the cache directory
+  int64_t evictions = 0;
+};
+
+/// \brief EXPERIMENTAL: A FileSystem implementation that delegates to another
+/// implementation and caches the contents of the files it reads in a local
+/// directory.
+///
+/// This is intended for remote filesystems such as S3FileSystem, where the
+/// same immutable files are read repeatedly: files read through
+/// OpenInputFile and OpenInputStream are fetched in blocks of
+/// `CachingFileSystemOptions::block_size` bytes, which are kept in
+/// `CachingFileSystemOptions::cache_dir` across instances (and processes)
+/// until evicted by the size limit.  Concurrent reads of a block being
+/// fetched wait for that fetch instead of issuing another one.
+///
+/// Cached data is keyed on the file's path, size and modification time, so
+/// opening a file still queries the base filesystem for its FileInfo
+/// (unless given one).  Files without a known modification time are not
+/// cached.  Writes, moves and deletions made through the CachingFileSystem
+/// drop the affected files from the cache; changes made through another
+/// filesystem are only noticed if they change the file's size or
+/// modification time.
+class ARROW_EXPORT CachingFileSystem : public FileSystem {
+ public:
+  ~CachingFileSystem() override;
+
+  /// \brief Create a CachingFileSystem wrapping `base_fs`
+  ///
+  /// Data already in the cache directory is reused.
+  static Result<std::shared_ptr<CachingFileSystem>> Make(
+      std::shared_ptr<FileSystem> base_fs, const CachingFileSystemOptions& options);
+
+  std::string type_name() const override { return "caching"; }
+  std::shared_ptr<FileSystem> base_fs() const { return base_fs_; }
+  const CachingFileSystemOptions& options() const { return options_; }
+
+  /// Return a snapshot of the cache statistics.
+  CachingFileSystemStats stats() const;
+
+  Result<std::string> NormalizePath(std::string path) override;
+  Result<std::string> PathFromUri(const std::string& uri_string) const override;
+
+  bool Equals(const FileSystem& other) const override;
+
+  /// \cond FALSE
+  using FileSystem::CreateDir;
+  using FileSystem::DeleteDirContents;
+  using FileSystem::GetFileInfo;
+  using FileSystem::OpenAppendStream;
+  using FileSystem::OpenOutputStream;
+  /// \endcond
+
+  Result<FileInfo> GetFileInfo(const std::string& path) override;
+  Result<FileInfoVector> GetFileInfo(const FileSelector& select) override;
+
+  FileInfoGenerator GetFileInfoGenerator(const FileSelector& select) override;
+
+  Status CreateDir(const std::string& path, bool recursive) override;
+
+  Status DeleteDir(const std::string& path) override;
+  Status DeleteDirContents(const std::string& path, bool missing_dir_ok) override;
+  Status DeleteRootDirContents() override;
+
+  Status DeleteFile(const std::string& path) override;
+
+  Status Move(const std::string& src, const std::string& dest) override;
+
+  Status CopyFile(const std::string& src, const std::string& dest) override;
+
+  Result<std::shared_ptr<io::InputStream>> OpenInputStream(
+      const std::string& path) override;
+  Result<std::shared_ptr<io::InputStream>> OpenInputStream(const FileInfo& info) override;
+  Result<std::shared_ptr<io::RandomAccessFile>> OpenInputFile(
+      const std::string& path) override;
+  Result<std::shared_ptr<io::RandomAccessFile>> OpenInputFile(
+      const FileInfo& info) override;
+
+  Result<std::shared_ptr<io::OutputStream>> OpenOutputStream(
+      const std::string& path,
+      const std::shared_ptr<const KeyValueMetadata>& metadata) override;
+  Result<std::shared_ptr<io::OutputStream>> OpenAppendStream(
+      const std::string& path,
+      const std::shared_ptr<const KeyValueMetadata>& metadata) override;
+
+ protected:
+  CachingFileSystem(std::shared_ptr<FileSystem> base_fs,
+                    const CachingFileSystemOptions& options);
+
+  class Impl;
+  std::shared_ptr<FileSystem> base_fs_;
+  CachingFileSystemOptions options_;
+  std::shared_ptr<Impl> impl_;
+};
+
+}  // namespace fs
+}  // namespace arrow
@@ -0,0 +1,379 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/buffer.h"
+#include "arrow/filesystem/cachingfs.h"
+#include "arrow/filesystem/localfs.h"
+#include "arrow/filesystem/mockfs.h"
+#include "arrow/filesystem/test_util.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/io_util.h"
+
+namespace arrow {
+namespace fs {
+
+using ::arrow::internal::TemporaryDir;
+
+class TestCachingFileSystem : public ::testing::Test {
+ public:
+  void SetUp() override {
+    ASSERT_OK_AND_ASSIGN(temp_dir_, TemporaryDir::Make("test-cachingfs-"));
+    time_ = TimePoint(TimePoint::duration(42));
+    base_fs_ = std::make_shared<internal::MockFileSystem>(time_);
+    options_.cache_dir = temp_dir_->path().ToString() + "cache";
+    options_.block_size = 16;
+    options_.max_cache_size = 1024;
+    MakeFileSystem();
+  }
+
+  void MakeFileSystem() {
+    fs_.reset();
+    ASSERT_OK_AND_ASSIGN(fs_, CachingFileSystem::Make(base_fs_, options_));
+  }
+
+  static std::string MakeData(int64_t size, char seed = 'a') {
+    std::string data(static_cast<size_t>(size), 0);
+    for (int64_t i = 0; i < size; ++i) {
+      data[i] = static_cast<char>(seed + i % 26);
+    }
+    return data;
+  }
+
+  void AssertReadAt(const std::string& path, int64_t position, int64_t nbytes,
+                    const std::string& expected) {
+    ASSERT_OK_AND_ASSIGN(auto file, fs_->OpenInputFile(path));
+    ASSERT_OK_AND_ASSIGN(auto buffer, file->ReadAt(position, nbytes));
+    AssertBufferEqual(*buffer, expected.substr(position, nbytes));
+  }
+
+  // The block files in the cache directory
+  std::vector<FileInfo> CachedBlocks() {
+    LocalFileSystem local_fs;
+    FileSelector select;
+    select.base_dir = options_.cache_dir;
+    select.recursive = true;
+    std::vector<FileInfo> blocks;
+    for (auto& info : local_fs.GetFileInfo(select).ValueOrDie()) {
+      if (info.IsFile() && info.base_name() != "key") {
+        blocks.push_back(std::move(info));
+      }
+    }
+    return blocks;
+  }
+
+ protected:
+  std::unique_ptr<TemporaryDir> temp_dir_;
+  TimePoint time_;
+  std::shared_ptr<FileSystem> base_fs_;
+  CachingFileSystemOptions options_;
+  std::shared_ptr<CachingFileSystem> fs_;
+};
+
+TEST_F(TestCachingFileSystem, InvalidOptions) {
+  auto options = options_;
+  options.cache_dir = "";
+  ASSERT_RAISES(Invalid, CachingFileSystem::Make(base_fs_, options));
+  options = options_;
+  options.block_size = 0;
+  ASSERT_RAISES(Invalid, CachingFileSystem::Make(base_fs_, options));
+  options = options_;
+  options.max_cache_size = options.block_size - 1;
+  ASSERT_RAISES(Invalid, CachingFileSystem::Make(base_fs_, options));
+}
+
+TEST_F(TestCachingFileSystem, Equals) {
+  ASSERT_TRUE(fs_->Equals(*fs_));
+  ASSERT_OK_AND_ASSIGN(auto other, CachingFileSystem::Make(base_fs_, options_));
+  ASSERT_TRUE(fs_->Equals(*other));
+  auto options = options_;
+  options.block_size = 32;
+  ASSERT_OK_AND_ASSIGN(other, CachingFileSystem::Make(base_fs_, options));
+  ASSERT_FALSE(fs_->Equals(*other));
+  ASSERT_FALSE(fs_->Equals(*base_fs_));
+}
+
+TEST_F(TestCachingFileSystem, ReadAt) {
+  const auto data = MakeData(100);
+  ASSERT_OK(base_fs_->CreateDir("AB"));
+  CreateFile(base_fs_.get(), "AB/ab", data);
+
+  // Spans blocks 0 to 2
+  AssertReadAt("AB/ab", 5, 40, data);
+  auto stats = fs_->stats();
+  ASSERT_EQ(stats.misses, 3);
+  ASSERT_EQ(stats.hits, 0);
+  ASSERT_EQ(stats.bytes_fetched, 48);
+  ASSERT_EQ(stats.bytes_cached, 48);
+  ASSERT_EQ(CachedBlocks().size(), 3);
+
+  // Served from the cache
+  AssertReadAt("AB/ab", 0, 48, data);
+  AssertReadAt("AB/ab", 20, 1, data);
+  stats = fs_->stats();
+  ASSERT_EQ(stats.misses, 3);
+  ASSERT_EQ(stats.hits, 4);
+  ASSERT_EQ(stats.bytes_fetched, 48);
+
+  // The last block is short, and reads are truncated at the end of the file
+  AssertReadAt("AB/ab", 90, 10, data);
+  ASSERT_OK_AND_ASSIGN(auto file, fs_->OpenInputFile("AB/ab"));
+  ASSERT_OK_AND_ASSIGN(auto buffer, file->ReadAt(90, 50));
+  AssertBufferEqual(*buffer, data.substr(90));
+  ASSERT_OK_AND_ASSIGN(buffer, file->ReadAt(100, 1));
+  ASSERT_EQ(buffer->size(), 0);
+  ASSERT_RAISES(IOError, file->ReadAt(101, 1));
+  ASSERT_EQ(fs_->stats().bytes_fetched, 68);
+
+  ASSERT_OK_AND_ASSIGN(auto size, file->GetSize());
+  ASSERT_EQ(size, 100);
+  ASSERT_OK(file->Seek(30));
+  ASSERT_OK_AND_ASSIGN(buffer, file->Read(10));
+  AssertBufferEqual(*buffer, data.substr(30, 10));
+  ASSERT_OK_AND_ASSIGN(auto pos, file->Tell());
+  ASSERT_EQ(pos, 40);
+  ASSERT_OK(file->Close());
+  ASSERT_RAISES(Invalid, file->ReadAt(0, 1));
+}
+
+TEST_F(TestCachingFileSystem, OpenInputStream) {
+  const auto data = MakeData(100);
+  CreateFile(base_fs_.get(), "ab", data);
+
+  for (int i = 0; i < 2; ++i) {
+    ASSERT_OK_AND_ASSIGN(auto stream, fs_->OpenInputStream("ab"));
+    std::string contents;
+    while (true) {
+      ASSERT_OK_AND_ASSIGN(auto buffer, stream->Read(7));
+      if (buffer->size() == 0) {
+        break;
+      }
+      contents += buffer->ToString();
+    }
+    ASSERT_EQ(contents, data);
+  }
+  auto stats = fs_->stats();
+  ASSERT_EQ(stats.misses, 7);
+  ASSERT_EQ(stats.bytes_fetched, 100);
+}
+
+TEST_F(TestCachingFileSystem, OpenWithFileInfo) {
+  const auto data = MakeData(50);
+  CreateFile(base_fs_.get(), "ab", data);
+
+  // A FileInfo without a size and modification time is completed
+  // from the base filesystem
+  ASSERT_OK_AND_ASSIGN(auto file, fs_->OpenInputFile(FileInfo("ab")));
+  ASSERT_OK_AND_ASSIGN(auto buffer, file->ReadAt(0, 50));
+  AssertBufferEqual(*buffer, data);
+  ASSERT_EQ(fs_->stats().misses, 4);
+
+  ASSERT_OK_AND_ASSIGN(auto info, base_fs_->GetFileInfo("ab"));
+  ASSERT_OK_AND_ASSIGN(file, fs_->OpenInputFile(info));
+  ASSERT_OK_AND_ASSIGN(buffer, file->ReadAt(0, 50));
+  AssertBufferEqual(*buffer, data);
+  ASSERT_EQ(fs_->stats().hits, 4);
+
+  // Errors are reported by the base filesystem
+  ASSERT_RAISES(IOError, fs_->OpenInputFile("nonexistent"));
+  ASSERT_OK(base_fs_->CreateDir("AB"));
+  ASSERT_RAISES(IOError, fs_->OpenInputStream("AB"));
+}
+
+TEST_F(TestCachingFileSystem, Persistence) {
+  const auto data = MakeData(100);
+  CreateFile(base_fs_.get(), "ab", data);
+  AssertReadAt("ab", 0, 100, data);
+  ASSERT_EQ(fs_->stats().bytes_fetched, 100);
+
+  // A new instance reuses the cache directory
+  MakeFileSystem();
+  ASSERT_EQ(fs_->stats().bytes_cached, 100);
+  AssertReadAt("ab", 0, 100, data);
+  auto stats = fs_->stats();
+  ASSERT_EQ(stats.hits, 7);
+  ASSERT_EQ(stats.misses, 0);
+  ASSERT_EQ(stats.bytes_fetched, 0);
+
+  // Another block size invalidates the cache directory
+  options_.block_size = 32;
+  MakeFileSystem();
+  ASSERT_EQ(fs_->stats().bytes_cached, 0);
+  ASSERT_EQ(CachedBlocks().size(), 0);
+}
+
+TEST_F(TestCachingFileSystem, CorruptCacheDir) {
+  const auto data = MakeData(100);
+  CreateFile(base_fs_.get(), "ab", data);
+  AssertReadAt("ab", 0, 100, data);
+
+  LocalFileSystem local_fs;
+  auto blocks = CachedBlocks();
+  ASSERT_EQ(blocks.size(), 7);
+  // Truncate a block, and add unrecognized files
+  CreateFile(&local_fs, blocks[0].path(), "xyz");
+  CreateFile(&local_fs, blocks[1].path() + ".tmp0", "xyz");
+  CreateFile(&local_fs, options_.cache_dir + "/unknown", "xyz");
+  ASSERT_OK(local_fs.CreateDir(options_.cache_dir + "/unknown_dir"));
+  CreateFile(&local_fs, options_.cache_dir + "/unknown_dir/key", "xyz");
+
+  MakeFileSystem();
+  ASSERT_EQ(CachedBlocks().size(), 6);
+  ASSERT_EQ(fs_->stats().bytes_cached, 100 - blocks[0].size());
+  AssertReadAt("ab", 0, 100, data);
+  ASSERT_EQ(fs_->stats().misses, 1);
+  ASSERT_EQ(CachedBlocks().size(), 7);
+
+  // A block deleted behind the cache's back is read from the base filesystem
+  for (const auto& block : CachedBlocks()) {
+    ASSERT_OK(local_fs.DeleteFile(block.path()));
+  }
+  AssertReadAt("ab", 0, 100, data);
+}
+
+TEST_F(TestCachingFileSystem, Invalidation) {
+  const auto data = MakeData(100);
+  const auto other_data = MakeData(100, 'A');
+  ASSERT_OK(base_fs_->CreateDir("AB"));
+  CreateFile(base_fs_.get(), "AB/ab", data);
+  CreateFile(base_fs_.get(), "AB/cd", data);
+  AssertReadAt("AB/ab", 0, 100, data);
+  AssertReadAt("AB/cd", 0, 100, data);
+
+  // The mock filesystem's modification times don't change, so an overwrite
+  // through the base filesystem isn't noticed...
+  CreateFile(base_fs_.get(), "AB/ab", other_data);
+  AssertReadAt("AB/ab", 0, 100, data);
+  // ...but one through the caching filesystem is
+  CreateFile(fs_.get(), "AB/ab", other_data);
+  AssertReadAt("AB/ab", 0, 100, other_data);
+
+  // A change of size is noticed
+  const auto longer_data = MakeData(120, 'A');
+  CreateFile(base_fs_.get(), "AB/cd", longer_data);
+  AssertReadAt("AB/cd", 0, 120, longer_data);
+
+  ASSERT_OK(fs_->CopyFile("AB/cd", "AB/ab"));
+  AssertReadAt("AB/ab", 0, 120, longer_data);
+  ASSERT_OK(fs_->Move("AB", "CD"));
+  ASSERT_OK(fs_->DeleteDir("CD"));
+  ASSERT_EQ(fs_->stats().bytes_cached, 0);
+  ASSERT_EQ(CachedBlocks().size(), 0);
+}
+
+TEST_F(TestCachingFileSystem, Eviction) {
+  options_.max_cache_size = 64;
+  MakeFileSystem();
+  const auto data = MakeData(160);
+  CreateFile(base_fs_.get(), "ab", data);
+
+  AssertReadAt("ab", 0, 160, data);
+  auto stats = fs_->stats();
+  ASSERT_EQ(stats.misses, 10);
+  ASSERT_EQ(stats.evictions, 6);
+  ASSERT_EQ(stats.bytes_cached, 64);
+  ASSERT_EQ(CachedBlocks().size(), 4);
+
+  // The last blocks are still cached
+  AssertReadAt("ab", 96, 64, data);
+  ASSERT_EQ(fs_->stats().hits, 4);
+  // Keep block 6 recently used
+  AssertReadAt("ab", 96, 1, data);
+  AssertReadAt("ab", 0, 1, data);
+  stats = fs_->stats();
+  ASSERT_EQ(stats.misses, 11);
+  ASSERT_EQ(stats.evictions, 7);
+  AssertReadAt("ab", 96, 16, data);
+  ASSERT_EQ(fs_->stats().misses, 11);
+}
+
+TEST_F(TestCachingFileSystem, ConcurrentReads) {
+  // Make fetches slow, so that concurrent reads overlap
+  base_fs_ = std::make_shared<SlowFileSystem>(base_fs_, /*average_latency=*/0.01,
+                                              /*seed=*/42);
+  options_.block_size = 1024;
+  options_.max_cache_size = 1 << 20;
+  MakeFileSystem();
+  const auto data = MakeData(10000);
+  CreateFile(base_fs_.get(), "ab", data);
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 8; ++i) {
+    threads.emplace_back([&, i] {
+      // Each thread reads the file in a different order
+      for (int j = 0; j < 10; ++j) {
+        const int64_t position = ((i + j) % 10) * 1000;
+        AssertReadAt("ab", position, 1500, data);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  // Each block was fetched once
+  auto stats = fs_->stats();
+  ASSERT_EQ(stats.misses, 10);
+  ASSERT_EQ(stats.bytes_fetched, 10000);
+}
+
+TEST_F(TestCachingFileSystem, ConcurrentReadsAndEviction) {
+  // A cache of two blocks, so that entries are dropped and their directories
+  // deleted and set up again while other reads use them
+  base_fs_ = std::make_shared<SlowFileSystem>(base_fs_, /*average_latency=*/0.001,
+                                              /*seed=*/43);
+  options_.block_size = 1024;
+  options_.max_cache_size = 2048;
+  MakeFileSystem();
+  const auto data = MakeData(10000);
+  const auto other_data = MakeData(10000, 'A');
+  CreateFile(base_fs_.get(), "ab", data);
+  CreateFile(base_fs_.get(), "cd", other_data);
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 8; ++i) {
+    threads.emplace_back([&, i] {
+      for (int j = 0; j < 20; ++j) {
+        const int64_t position = ((i + j) % 10) * 850;
+        if ((i + j) % 2 == 0) {
+          AssertReadAt("ab", position, 1500, data);
+        } else {
+          AssertReadAt("cd", position, 1500, other_data);
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  ASSERT_LE(fs_->stats().bytes_cached, 2048);
+
+  // The cache directory is left consistent
+  MakeFileSystem();
+  ASSERT_LE(CachedBlocks().size(), 2);
+  AssertReadAt("ab", 0, 10000, data);
+  AssertReadAt("cd", 0, 10000, other_data);
+}
+
+}  // namespace fs
+}  // namespace arrow
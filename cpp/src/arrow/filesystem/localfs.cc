@@ -220,7 +220,9 @@ Status StatSelector(const PlatformFilename& dir_fn, const FileSelector& select,
 LocalFileSystemOptions LocalFileSystemOptions::Defaults() { return {}; }
 
 bool LocalFileSystemOptions::Equals(const LocalFileSystemOptions& other) const {
-  return use_mmap == other.use_mmap && directory_readahead == other.directory_readahead &&
+  return use_mmap == other.use_mmap && use_io_uring == other.use_io_uring &&
+         page_cache.Equals(other.page_cache) &&
+         directory_readahead == other.directory_readahead &&
          file_info_batch_size == other.file_info_batch_size;
 }
 
@@ -250,6 +252,15 @@ Result<LocalFileSystemOptions> LocalFileSystemOptions::FromUri(
   LocalFileSystemOptions options;
   ARROW_ASSIGN_OR_RAISE(auto params, uri.query_items());
   for (const auto& [key, value] : params) {
+    if (key == "use_io_uring") {
+      if (value.empty()) {
+        options.use_io_uring = true;
+      } else {
+        ARROW_ASSIGN_OR_RAISE(options.use_io_uring,
+                              ::arrow::internal::ParseBoolean(value));
+      }
+      continue;
+    }
     if (key == "use_mmap") {
       if (value.empty()) {
         options.use_mmap = true;
@@ -288,7 +299,14 @@ Result<std::string> LocalFileSystem::PathFromUri(const std::string& uri_string)
 
 Result<std::string> LocalFileSystem::MakeUri(std::string path) const {
   ARROW_ASSIGN_OR_RAISE(path, DoNormalizePath(std::move(path)));
-  return "file://" + path + (options_.use_mmap ? "?use_mmap" : "");
+  std::string query;
+  if (options_.use_mmap) {
+    query = "?use_mmap";
+  }
+  if (options_.use_io_uring) {
+    query += query.empty() ? "?use_io_uring" : "&use_io_uring";
+  }
+  return "file://" + path + query;
 }
 
 bool LocalFileSystem::Equals(const FileSystem& other) const {
@@ -653,8 +671,10 @@ Result<std::shared_ptr<InputStreamType>> OpenInputStreamGeneric(
   RETURN_NOT_OK(ValidatePath(path));
   if (options.use_mmap) {
     return io::MemoryMappedFile::Open(path, io::FileMode::READ);
+  } else if (options.use_io_uring) {
+    return io::UringReadableFile::Open(path, io_context.pool());
   } else {
-    return io::ReadableFile::Open(path, io_context.pool());
+    return io::ReadableFile::Open(path, io_context.pool(), options.page_cache);
   }
 }
 
@@ -672,16 +692,17 @@ Result<std::shared_ptr<io::RandomAccessFile>> LocalFileSystem::OpenInputFile(
 
 namespace {
 
-Result<std::shared_ptr<io::OutputStream>> OpenOutputStreamGeneric(const std::string& path,
-                                                                  bool truncate,
-                                                                  bool append) {
+Result<std::shared_ptr<io::OutputStream>> OpenOutputStreamGeneric(
+    const std::string& path, bool truncate, bool append,
+    const LocalFileSystemOptions& options, const io::IOContext& io_context) {
   RETURN_NOT_OK(ValidatePath(path));
   ARROW_ASSIGN_OR_RAISE(auto fn, PlatformFilename::FromString(path));
   const bool write_only = true;
   ARROW_ASSIGN_OR_RAISE(
       auto fd, ::arrow::internal::FileOpenWritable(fn, write_only, truncate, append));
   int raw_fd = fd.Detach();
-  auto maybe_stream = io::FileOutputStream::Open(raw_fd);
+  auto maybe_stream =
+      io::FileOutputStream::Open(raw_fd, options.page_cache, io_context.pool());
   if (!maybe_stream.ok()) {
     ARROW_UNUSED(::arrow::internal::FileClose(raw_fd));
   }
@@ -694,14 +715,14 @@ Result<std::shared_ptr<io::OutputStream>> LocalFileSystem::OpenOutputStream(
     const std::string& path, const std::shared_ptr<const KeyValueMetadata>& metadata) {
   bool truncate = true;
   bool append = false;
-  return OpenOutputStreamGeneric(path, truncate, append);
+  return OpenOutputStreamGeneric(path, truncate, append, options_, io_context());
 }
 
 Result<std::shared_ptr<io::OutputStream>> LocalFileSystem::OpenAppendStream(
     const std::string& path, const std::shared_ptr<const KeyValueMetadata>& metadata) {
   bool truncate = false;
   bool append = true;
-  return OpenOutputStreamGeneric(path, truncate, append);
+  return OpenOutputStreamGeneric(path, truncate, append, options_, io_context());
 }
 
 static Result<std::shared_ptr<fs::FileSystem>> LocalFileSystemFactory(
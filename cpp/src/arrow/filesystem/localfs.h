@@ -22,6 +22,7 @@
 #include <vector>
 
 #include "arrow/filesystem/filesystem.h"
+#include "arrow/io/file.h"
 
 namespace arrow {
 namespace internal {
@@ -41,6 +42,19 @@ struct ARROW_EXPORT LocalFileSystemOptions {
   /// or a regular one.
   bool use_mmap = false;
 
+  /// EXPERIMENTAL: Whether OpenInputStream and OpenInputFile return a file
+  /// submitting its asynchronous reads through io_uring (Linux only).
+  ///
+  /// See io::UringReadableFile.  Ignored if `use_mmap` is true.
+  bool use_io_uring = false;
+
+  /// EXPERIMENTAL: How files opened by OpenInputStream, OpenInputFile,
+  /// OpenOutputStream and OpenAppendStream use the OS page cache.
+  ///
+  /// See io::PageCacheOptions.  Ignored for input files if `use_mmap` or
+  /// `use_io_uring` is true.
+  io::PageCacheOptions page_cache;
+
   /// Options related to `GetFileInfoGenerator` interface.
 
   /// EXPERIMENTAL: The maximum number of directories processed in parallel
@@ -445,6 +445,9 @@ bool S3Options::Equals(const S3Options& other) const {
           proxy_options.Equals(other.proxy_options) &&
           credentials_kind == other.credentials_kind &&
           background_writes == other.background_writes &&
+          max_background_uploads == other.max_background_uploads &&
+          read_part_size == other.read_part_size &&
+          read_concurrency == other.read_concurrency &&
           allow_bucket_creation == other.allow_bucket_creation &&
           allow_bucket_deletion == other.allow_bucket_deletion &&
           tls_ca_file_path == other.tls_ca_file_path &&
@@ -1453,13 +1456,14 @@ bool IsDirectory(std::string_view key, const S3Model::HeadObjectResult& result)
 class ObjectInputFile final : public io::RandomAccessFile {
  public:
   ObjectInputFile(std::shared_ptr<S3ClientHolder> holder, const io::IOContext& io_context,
-                  const S3Path& path, int64_t size = kNoSize,
-                  const std::string& sse_customer_key = "")
+                  const S3Path& path, int64_t size, const S3Options& options)
       : holder_(std::move(holder)),
         io_context_(io_context),
         path_(path),
         content_length_(size),
-        sse_customer_key_(sse_customer_key) {}
+        sse_customer_key_(options.sse_customer_key),
+        read_part_size_(options.read_part_size),
+        read_concurrency_(options.read_concurrency) {}
 
   Status Init() {
     // Issue a HEAD Object to get the content-length and ensure any
@@ -1555,17 +1559,10 @@ class ObjectInputFile final : public io::RandomAccessFile {
       return 0;
     }
 
-    // Read the desired range of bytes
-    ARROW_ASSIGN_OR_RAISE(auto client_lock, holder_->Lock());
-    ARROW_ASSIGN_OR_RAISE(S3Model::GetObjectResult result,
-                          GetObjectRange(client_lock.get(), path_, sse_customer_key_,
-                                         position, nbytes, out));
-
-    auto& stream = result.GetBody();
-    stream.ignore(nbytes);
-    // NOTE: the stream is a stringstream by default, there is no actual error
-    // to check for.  However, stream.fail() may return true if EOF is reached.
-    return stream.gcount();
+    if (read_part_size_ > 0 && read_concurrency_ > 1 && nbytes > read_part_size_) {
+      return ReadAtConcurrently(position, nbytes, static_cast<uint8_t*>(out));
+    }
+    return GetRange(holder_, path_, sse_customer_key_, position, nbytes, out);
   }
 
   Result<std::shared_ptr<Buffer>> ReadAt(int64_t position, int64_t nbytes) override {
@@ -1599,6 +1596,85 @@ class ObjectInputFile final : public io::RandomAccessFile {
   }
 
  protected:
+  // Read the given range of bytes with a single GET request
+  static Result<int64_t> GetRange(const std::shared_ptr<S3ClientHolder>& holder,
+                                  const S3Path& path, const std::string& sse_customer_key,
+                                  int64_t position, int64_t nbytes, void* out) {
+    ARROW_ASSIGN_OR_RAISE(auto client_lock, holder->Lock());
+    ARROW_ASSIGN_OR_RAISE(S3Model::GetObjectResult result,
+                          GetObjectRange(client_lock.get(), path, sse_customer_key,
+                                         position, nbytes, out));
+
+    auto& stream = result.GetBody();
+    stream.ignore(nbytes);
+    // NOTE: the stream is a stringstream by default, there is no actual error
+    // to check for.  However, stream.fail() may return true if EOF is reached.
+    return stream.gcount();
+  }
+
+  // Read the given range of bytes as parts of read_part_size_ bytes, fetched
+  // by concurrent GET requests directly into `out`.
+  Result<int64_t> ReadAtConcurrently(int64_t position, int64_t nbytes, uint8_t* out) {
+    // The parts are claimed in order by the calling thread and by up to
+    // read_concurrency_ - 1 tasks on the I/O executor.  As the calling thread
+    // itself reads any part not claimed yet, it only ever waits for parts
+    // being read, which avoids deadlocking if it runs on the I/O executor.
+    struct State {
+      std::shared_ptr<S3ClientHolder> holder;
+      S3Path path;
+      std::string sse_customer_key;
+      int64_t position, nbytes, part_size;
+      uint8_t* out;
+      std::vector<Future<int64_t>> parts;
+      std::atomic<size_t> next_part{0};
+
+      // Read parts until none is left
+      void ReadParts() {
+        size_t i;
+        while ((i = next_part.fetch_add(1)) < parts.size()) {
+          const int64_t offset = static_cast<int64_t>(i) * part_size;
+          const int64_t length = std::min(part_size, nbytes - offset);
+          parts[i].MarkFinished(GetRange(holder, path, sse_customer_key,
+                                         position + offset, length, out + offset));
+        }
+      }
+    };
+    auto state = std::make_shared<State>();
+    state->holder = holder_;
+    state->path = path_;
+    state->sse_customer_key = sse_customer_key_;
+    state->position = position;
+    state->nbytes = nbytes;
+    state->part_size = read_part_size_;
+    state->out = out;
+    const int64_t num_parts = bit_util::CeilDiv(nbytes, read_part_size_);
+    for (int64_t i = 0; i < num_parts; ++i) {
+      state->parts.push_back(Future<int64_t>::Make());
+    }
+
+    const int64_t num_tasks = std::min<int64_t>(num_parts, read_concurrency_) - 1;
+    for (int64_t i = 0; i < num_tasks; ++i) {
+      // Failing to submit a task is fine, as the remaining parts are read below
+      ARROW_UNUSED(SubmitIO(io_context_, [state]() { state->ReadParts(); }));
+    }
+    state->ReadParts();
+    // Don't return before all writes to `out` are done
+    for (const auto& part : state->parts) {
+      part.Wait();
+    }
+
+    // A short part means the object was truncated since it was opened
+    int64_t bytes_read = 0;
+    for (const auto& part : state->parts) {
+      ARROW_ASSIGN_OR_RAISE(int64_t part_bytes_read, part.result());
+      bytes_read += part_bytes_read;
+      if (part_bytes_read < state->part_size) {
+        break;
+      }
+    }
+    return bytes_read;
+  }
+
   std::shared_ptr<S3ClientHolder> holder_;
   const io::IOContext io_context_;
   S3Path path_;
@@ -1608,6 +1684,8 @@ class ObjectInputFile final : public io::RandomAccessFile {
   int64_t content_length_ = kNoSize;
   std::shared_ptr<const KeyValueMetadata> metadata_;
   std::string sse_customer_key_;
+  int64_t read_part_size_;
+  int read_concurrency_;
 };
 
 // Upload size per part. While AWS and Minio support different sizes for each
@@ -1644,6 +1722,7 @@ class ObjectOutputStream final : public io::OutputStream {
         metadata_(metadata),
         default_metadata_(options.default_metadata),
         background_writes_(options.background_writes),
+        max_background_uploads_(options.max_background_uploads),
         allow_delayed_open_(options.allow_delayed_open),
         sse_customer_key_(options.sse_customer_key) {}
 
@@ -1717,6 +1796,8 @@ class ObjectOutputStream final : public io::OutputStream {
     }
 
     upload_state_ = std::make_shared<UploadState>();
+    upload_state_->max_free_part_buffers =
+        static_cast<size_t>(std::max(max_background_uploads_, 1));
     closed_ = false;
     return Status::OK();
   }
@@ -1880,7 +1961,7 @@ class ObjectOutputStream final : public io::OutputStream {
     if (current_part_size_ > 0) {
       // Try to fill current buffer
       const int64_t to_copy = std::min(nbytes, kPartUploadSize - current_part_size_);
-      RETURN_NOT_OK(current_part_->Write(data_ptr, to_copy));
+      memcpy(current_part_->mutable_data() + current_part_size_, data_ptr, to_copy);
       current_part_size_ += to_copy;
       advance_ptr(to_copy);
       pos_ += to_copy;
@@ -1905,9 +1986,8 @@ class ObjectOutputStream final : public io::OutputStream {
     // Buffer remaining bytes
     if (nbytes > 0) {
       current_part_size_ = nbytes;
-      ARROW_ASSIGN_OR_RAISE(current_part_, io::BufferOutputStream::Create(
-                                               kPartUploadSize, io_context_.pool()));
-      RETURN_NOT_OK(current_part_->Write(data_ptr, current_part_size_));
+      ARROW_ASSIGN_OR_RAISE(current_part_, AcquirePartBuffer(kPartUploadSize));
+      memcpy(current_part_->mutable_data(), data_ptr, current_part_size_);
       pos_ += current_part_size_;
     }
 
@@ -1935,10 +2015,52 @@ class ObjectOutputStream final : public io::OutputStream {
       RETURN_NOT_OK(CreateMultipartUpload());
     }
 
-    ARROW_ASSIGN_OR_RAISE(auto buf, current_part_->Finish());
-    current_part_.reset();
+    ARROW_ASSIGN_OR_RAISE(auto buf, FinishCurrentPart());
+    return UploadPart(buf->data(), buf->size(), buf, /*recyclable=*/true);
+  }
+
+  Result<std::shared_ptr<ResizableBuffer>> FinishCurrentPart() {
+    RETURN_NOT_OK(current_part_->Resize(current_part_size_, /*shrink_to_fit=*/false));
     current_part_size_ = 0;
-    return UploadPart(buf);
+    return std::move(current_part_);
+  }
+
+  // Get a buffer of `size` bytes for a part, reusing the buffer of an uploaded
+  // part if possible
+  Result<std::shared_ptr<ResizableBuffer>> AcquirePartBuffer(int64_t size) {
+    std::shared_ptr<ResizableBuffer> buffer;
+    if (size <= kPartUploadSize) {
+      std::unique_lock<std::mutex> lock(upload_state_->mutex);
+      if (!upload_state_->free_part_buffers.empty()) {
+        buffer = std::move(upload_state_->free_part_buffers.back());
+        upload_state_->free_part_buffers.pop_back();
+      }
+    }
+    if (buffer == nullptr) {
+      ARROW_ASSIGN_OR_RAISE(
+          buffer,
+          AllocateResizableBuffer(std::max(size, kPartUploadSize), io_context_.pool()));
+    }
+    RETURN_NOT_OK(buffer->Resize(size, /*shrink_to_fit=*/false));
+    return buffer;
+  }
+
+  static void ReleasePartBuffer(const std::shared_ptr<UploadState>& state,
+                                std::shared_ptr<Buffer> buffer) {
+    std::unique_lock<std::mutex> lock(state->mutex);
+    if (state->free_part_buffers.size() < state->max_free_part_buffers) {
+      state->free_part_buffers.push_back(
+          std::static_pointer_cast<ResizableBuffer>(std::move(buffer)));
+    }
+  }
+
+  // Whether the maximum number of background uploads is reached
+  bool BackgroundUploadsFull() {
+    if (max_background_uploads_ <= 0) {
+      return false;
+    }
+    std::unique_lock<std::mutex> lock(upload_state_->mutex);
+    return upload_state_->uploads_in_progress >= max_background_uploads_;
   }
 
   Status UploadUsingSingleRequest() {
@@ -1948,10 +2070,9 @@ class ObjectOutputStream final : public io::OutputStream {
       // anything, we'll have to create an empty buffer.
       buf = std::make_shared<Buffer>("");
     } else {
-      ARROW_ASSIGN_OR_RAISE(buf, current_part_->Finish());
+      ARROW_ASSIGN_OR_RAISE(buf, FinishCurrentPart());
     }
 
-    current_part_.reset();
     current_part_size_ = 0;
     return UploadUsingSingleRequest(buf);
   }
@@ -1980,13 +2101,16 @@ class ObjectOutputStream final : public io::OutputStream {
       RequestType&& req,
       UploadResultCallbackFunction<RequestType, OutcomeType> sync_result_callback,
       UploadResultCallbackFunction<RequestType, OutcomeType> async_result_callback,
-      const void* data, int64_t nbytes, std::shared_ptr<Buffer> owned_buffer = nullptr) {
+      const void* data, int64_t nbytes, std::shared_ptr<Buffer> owned_buffer = nullptr,
+      bool recyclable = false) {
     req.SetBucket(ToAwsString(path_.bucket));
     req.SetKey(ToAwsString(path_.key));
     req.SetContentLength(nbytes);
     RETURN_NOT_OK(SetSSECustomerKey(&req, sse_customer_key_));
 
-    if (!background_writes_) {
+    // If too many parts are being uploaded in the background, upload this one
+    // before returning, so as to apply backpressure to the writer.
+    if (!background_writes_ || BackgroundUploadsFull()) {
       // GH-45304: avoid setting a body stream if length is 0.
       // This workaround can be removed once we require AWS SDK 1.11.489 or later.
       if (nbytes != 0) {
@@ -1996,13 +2120,18 @@ class ObjectOutputStream final : public io::OutputStream {
       ARROW_ASSIGN_OR_RAISE(auto outcome, TriggerUploadRequest(req, holder_));
 
       RETURN_NOT_OK(sync_result_callback(req, upload_state_, part_number_, outcome));
+      if (recyclable) {
+        ReleasePartBuffer(upload_state_, std::move(owned_buffer));
+      }
     } else {
       // (GH-45304: avoid setting a body stream if length is 0, see above)
       if (nbytes != 0) {
         // If the data isn't owned, make an immutable copy for the lifetime of the closure
         if (owned_buffer == nullptr) {
-          ARROW_ASSIGN_OR_RAISE(owned_buffer, AllocateBuffer(nbytes, io_context_.pool()));
-          memcpy(owned_buffer->mutable_data(), data, nbytes);
+          ARROW_ASSIGN_OR_RAISE(auto part_buffer, AcquirePartBuffer(nbytes));
+          memcpy(part_buffer->mutable_data(), data, nbytes);
+          owned_buffer = std::move(part_buffer);
+          recyclable = true;
         } else {
           DCHECK_EQ(data, owned_buffer->data());
           DCHECK_EQ(nbytes, owned_buffer->size());
@@ -2019,11 +2148,15 @@ class ObjectOutputStream final : public io::OutputStream {
       }
 
       // The closure keeps the buffer and the upload state alive
-      auto deferred = [owned_buffer, holder = holder_, req = std::move(req),
+      auto deferred = [owned_buffer, recyclable, holder = holder_, req = std::move(req),
                        state = upload_state_, async_result_callback,
                        part_number = part_number_]() mutable -> Status {
         ARROW_ASSIGN_OR_RAISE(auto outcome, TriggerUploadRequest(req, holder));
 
+        // The request doesn't reference the buffer anymore
+        if (recyclable) {
+          ReleasePartBuffer(state, std::move(owned_buffer));
+        }
         return async_result_callback(req, state, part_number, outcome);
       };
       RETURN_NOT_OK(SubmitIO(io_context_, std::move(deferred)));
@@ -2075,10 +2208,6 @@ class ObjectOutputStream final : public io::OutputStream {
         data, nbytes, std::move(owned_buffer));
   }
 
-  Status UploadPart(std::shared_ptr<Buffer> buffer) {
-    return UploadPart(buffer->data(), buffer->size(), buffer);
-  }
-
   static Status UploadPartError(const Aws::S3::Model::UploadPartRequest& request,
                                 const Aws::S3::Model::UploadPartOutcome& outcome) {
     return ErrorToStatus(
@@ -2088,7 +2217,8 @@ class ObjectOutputStream final : public io::OutputStream {
   }
 
   Status UploadPart(const void* data, int64_t nbytes,
-                    std::shared_ptr<Buffer> owned_buffer = nullptr) {
+                    std::shared_ptr<Buffer> owned_buffer = nullptr,
+                    bool recyclable = false) {
     if (!IsMultipartCreated()) {
       RETURN_NOT_OK(CreateMultipartUpload());
     }
@@ -2104,6 +2234,8 @@ class ObjectOutputStream final : public io::OutputStream {
       if (!outcome.IsSuccess()) {
         return UploadPartError(request, outcome);
       } else {
+        // Other parts may be uploading in the background
+        std::unique_lock<std::mutex> lock(state->mutex);
         AddCompletedPart(state, part_number, outcome.GetResult());
       }
 
@@ -2120,7 +2252,7 @@ class ObjectOutputStream final : public io::OutputStream {
 
     return Upload<Aws::S3::Model::UploadPartRequest, Aws::S3::Model::UploadPartOutcome>(
         std::move(req), std::move(sync_result_callback), std::move(async_result_callback),
-        data, nbytes, std::move(owned_buffer));
+        data, nbytes, std::move(owned_buffer), recyclable);
   }
 
   static void HandleUploadUsingSingleRequestOutcome(
@@ -2185,13 +2317,14 @@ class ObjectOutputStream final : public io::OutputStream {
   const std::shared_ptr<const KeyValueMetadata> metadata_;
   const std::shared_ptr<const KeyValueMetadata> default_metadata_;
   const bool background_writes_;
+  const int max_background_uploads_;
   const bool allow_delayed_open_;
 
   Aws::String multipart_upload_id_;
   bool closed_ = true;
   int64_t pos_ = 0;
   int32_t part_number_ = 1;
-  std::shared_ptr<io::BufferOutputStream> current_part_;
+  std::shared_ptr<ResizableBuffer> current_part_;
   int64_t current_part_size_ = 0;
 
   // This struct is kept alive through background writes to avoid problems
@@ -2203,6 +2336,9 @@ class ObjectOutputStream final : public io::OutputStream {
     int64_t uploads_in_progress = 0;
     Status status;
     Future<> pending_uploads_completed = Future<>::MakeFinished(Status::OK());
+    // Buffers of uploaded parts, for reuse by the next parts
+    std::vector<std::shared_ptr<ResizableBuffer>> free_part_buffers;
+    size_t max_free_part_buffers = 1;
   };
   std::shared_ptr<UploadState> upload_state_;
   std::string sse_customer_key_;
@@ -3028,7 +3164,7 @@ class S3FileSystem::Impl : public std::enable_shared_from_this<S3FileSystem::Imp
     RETURN_NOT_OK(CheckS3Initialized());
 
     auto ptr = std::make_shared<ObjectInputFile>(holder_, fs->io_context(), path, kNoSize,
-                                                 fs->options().sse_customer_key);
+                                                 fs->options());
     RETURN_NOT_OK(ptr->Init());
     return ptr;
   }
@@ -3048,8 +3184,8 @@ class S3FileSystem::Impl : public std::enable_shared_from_this<S3FileSystem::Imp
 
     RETURN_NOT_OK(CheckS3Initialized());
 
-    auto ptr = std::make_shared<ObjectInputFile>(
-        holder_, fs->io_context(), path, info.size(), fs->options().sse_customer_key);
+    auto ptr = std::make_shared<ObjectInputFile>(holder_, fs->io_context(), path,
+                                                 info.size(), fs->options());
     RETURN_NOT_OK(ptr->Init());
     return ptr;
   }
@@ -100,6 +100,10 @@ class ARROW_EXPORT S3RetryStrategy {
 
 /// Options for the S3FileSystem implementation.
 struct ARROW_EXPORT S3Options {
+  static constexpr int64_t kDefaultReadPartSize = 8 * 1024 * 1024;
+  static constexpr int kDefaultReadConcurrency = 8;
+  static constexpr int kDefaultMaxBackgroundUploads = 4;
+
   /// \brief AWS region to connect to.
   ///
   /// If unset, the AWS SDK will choose a default value.  The exact algorithm
@@ -155,6 +159,16 @@ struct ARROW_EXPORT S3Options {
   /// Whether OutputStream writes will be issued in the background, without blocking.
   bool background_writes = true;
 
+  /// \brief Maximum number of parts uploaded in the background at once by an
+  /// OutputStream
+  ///
+  /// When this many parts are being uploaded, a write that completes a part
+  /// uploads it before returning, which bounds the memory held by each stream
+  /// to about `max_background_uploads + 1` parts.  Part buffers are recycled
+  /// once uploaded.  If zero, the number of background uploads is unbounded.
+  /// This option only applies if `background_writes` is true.
+  int max_background_uploads = kDefaultMaxBackgroundUploads;
+
   /// Whether to allow creation of buckets
   ///
   /// When S3FileSystem creates new buckets, it does not pass any non-default settings.
@@ -187,6 +201,20 @@ struct ARROW_EXPORT S3Options {
   /// when attempting to close the file).
   bool allow_delayed_open = false;
 
+  /// \brief Size of the ranged GET requests that large reads are split into, in bytes
+  ///
+  /// Reads of more than this many bytes from a file opened with OpenInputFile
+  /// are issued as several ranged GET requests running concurrently, each one
+  /// writing directly into its part of the destination buffer.
+  /// If zero, each read issues a single GET request.
+  int64_t read_part_size = kDefaultReadPartSize;
+
+  /// \brief Maximum number of concurrent GET requests issued by a single read
+  ///
+  /// The requests run on the filesystem's I/O executor, and on the thread
+  /// calling the read.  If 1, reads are not split.
+  int read_concurrency = kDefaultReadConcurrency;
+
   /// \brief Default metadata for OpenOutputStream.
   ///
   /// This will be ignored if non-empty metadata is passed to OpenOutputStream.
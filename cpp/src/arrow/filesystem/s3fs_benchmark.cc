@@ -366,6 +366,21 @@ BENCHMARK_DEFINE_F(MinioFixture, ReadAll500Mib)(benchmark::State& st) {
 }
 BENCHMARK_REGISTER_F(MinioFixture, ReadAll500Mib)->UseRealTime();
 
+/// Read the entire file in one go, split into a varying number of concurrent GETs.
+BENCHMARK_DEFINE_F(MinioFixture, ReadAllConcurrent500Mib)(benchmark::State& st) {
+  options_.read_concurrency = static_cast<int>(st.range(0));
+  MakeFileSystem();
+  NaiveRead(st, fs_.get(), bucket_ + "/bytes_500mib");
+}
+BENCHMARK_REGISTER_F(MinioFixture, ReadAllConcurrent500Mib)
+    ->ArgName("concurrency")
+    ->Arg(1)
+    ->Arg(2)
+    ->Arg(4)
+    ->Arg(8)
+    ->Arg(16)
+    ->UseRealTime();
+
 BENCHMARK_DEFINE_F(MinioFixture, ReadChunked100Mib)(benchmark::State& st) {
   ChunkedRead(st, fs_.get(), bucket_ + "/bytes_100mib");
 }
@@ -1356,6 +1356,43 @@ TEST_F(TestS3FS, OpenInputFile) {
   ASSERT_RAISES(IOError, file->Seek(10));
 }
 
+TEST_F(TestS3FS, OpenInputFileConcurrentRead) {
+  std::string data(1000, '\0');
+  for (size_t i = 0; i < data.size(); ++i) {
+    data[i] = static_cast<char>('a' + i % 26);
+  }
+  ASSERT_OK_AND_ASSIGN(auto stream, fs_->OpenOutputStream("bucket/largefile"));
+  ASSERT_OK(stream->Write(data));
+  ASSERT_OK(stream->Close());
+
+  for (int read_concurrency : {1, 2, 8}) {
+    ARROW_SCOPED_TRACE("read_concurrency = ", read_concurrency);
+    options_.read_part_size = 64;
+    options_.read_concurrency = read_concurrency;
+    MakeFileSystem();
+    ASSERT_OK_AND_ASSIGN(auto file, fs_->OpenInputFile("bucket/largefile"));
+
+    // Split into parts, the last one being partial
+    ASSERT_OK_AND_ASSIGN(auto buf, file->ReadAt(10, 900));
+    AssertBufferEqual(*buf, std::string_view(data).substr(10, 900));
+    // Truncated at end of file
+    ASSERT_OK_AND_ASSIGN(buf, file->ReadAt(500, 1000));
+    AssertBufferEqual(*buf, std::string_view(data).substr(500));
+    std::string out(1000, '\0');
+    ASSERT_OK_AND_EQ(1000, file->ReadAt(0, 1000, out.data()));
+    ASSERT_EQ(out, data);
+    // Concurrent reads from the I/O executor
+    std::vector<Future<std::shared_ptr<Buffer>>> futures;
+    for (int64_t position = 0; position < 1000; position += 200) {
+      futures.push_back(file->ReadAsync({}, position, 200));
+    }
+    for (size_t i = 0; i < futures.size(); ++i) {
+      ASSERT_FINISHES_OK_AND_ASSIGN(buf, futures[i]);
+      AssertBufferEqual(*buf, std::string_view(data).substr(i * 200, 200));
+    }
+  }
+}
+
 // Minio only allows Server Side Encryption on HTTPS client connections.
 #ifdef ENABLE_TLS_TESTS
 class TestS3FSHTTPS : public TestS3FS {
@@ -1511,6 +1548,31 @@ TEST_F(TestS3FS, OpenOutputStreamCloseAsyncFutureDeadlockSyncWrite) {
   ASSERT_OK(RestoreTestBucket());
 }
 
+TEST_F(TestS3FS, OpenOutputStreamBoundedBackgroundUploads) {
+  // Several parts of 10 MB, written in small and large chunks
+  const std::string chunk = random_string(3 * 1024 * 1024, /*seed=*/42);
+  const std::string large_chunk = random_string(25 * 1024 * 1024, /*seed=*/43);
+  std::string expected;
+  for (int max_background_uploads : {0, 1, 2}) {
+    ARROW_SCOPED_TRACE("max_background_uploads = ", max_background_uploads);
+    options_.max_background_uploads = max_background_uploads;
+    MakeFileSystem();
+
+    ASSERT_OK_AND_ASSIGN(auto stream, fs_->OpenOutputStream("bucket/newfile_bounded"));
+    expected.clear();
+    for (int i = 0; i < 10; ++i) {
+      ASSERT_OK(stream->Write(chunk));
+      expected += chunk;
+    }
+    ASSERT_OK(stream->Write(large_chunk));
+    expected += large_chunk;
+    ASSERT_OK(stream->Write("end"));
+    expected += "end";
+    ASSERT_OK(stream->Close());
+    AssertObjectContents(client_.get(), "bucket", "newfile_bounded", expected);
+  }
+}
+
 TEST_F(TestS3FS, OpenOutputStreamMetadata) {
   std::shared_ptr<io::OutputStream> stream;
 
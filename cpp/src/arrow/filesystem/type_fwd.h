@@ -43,6 +43,7 @@ struct FileSelector;
 
 class FileSystem;
 class AzureFileSystem;
+class CachingFileSystem;
 class GcsFileSystem;
 class LocalFileSystem;
 class S3FileSystem;
@@ -28,10 +28,35 @@
 #include "arrow/result.h"
 #include "arrow/util/future.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/stopwatch.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 namespace io {
 
+namespace {
+
+// See CacheOptions::MakeFromNetworkMetrics for the derivation
+CacheOptions CacheOptionsFromMetrics(double time_to_first_byte_sec,
+                                     double transfer_bandwidth_bytes_per_sec,
+                                     double ideal_bandwidth_utilization_frac,
+                                     int64_t max_ideal_request_size_bytes) {
+  // hole_size_limit = TTFB * BW
+  const auto hole_size_limit = static_cast<int64_t>(
+      std::round(time_to_first_byte_sec * transfer_bandwidth_bytes_per_sec));
+
+  // range_size_limit = min(MAX_IDEAL_REQUEST_SIZE,
+  //                        hole_size_limit * BW_util_frac / (1 - BW_util_frac))
+  const int64_t range_size_limit = std::min(
+      max_ideal_request_size_bytes,
+      static_cast<int64_t>(std::round(hole_size_limit * ideal_bandwidth_utilization_frac /
+                                      (1 - ideal_bandwidth_utilization_frac))));
+
+  return {hole_size_limit, range_size_limit, /*lazy=*/false, /*prefetch_limit=*/0};
+}
+
+}  // namespace
+
 CacheOptions CacheOptions::Defaults() {
   return CacheOptions{internal::ReadRangeCache::kDefaultHoleSizeLimit,
                       internal::ReadRangeCache::kDefaultRangeSizeLimit,
@@ -114,20 +139,112 @@ CacheOptions CacheOptions::MakeFromNetworkMetrics(int64_t time_to_first_byte_mil
       transfer_bandwidth_mib_per_sec * 1024 * 1024;
   const int64_t max_ideal_request_size_bytes = max_ideal_request_size_mib * 1024 * 1024;
 
-  // hole_size_limit = TTFB * BW
-  const auto hole_size_limit = static_cast<int64_t>(
-      std::round(time_to_first_byte_sec * transfer_bandwidth_bytes_per_sec));
-  DCHECK_GT(hole_size_limit, 0) << "Computed hole_size_limit must be > 0";
+  auto options = CacheOptionsFromMetrics(
+      time_to_first_byte_sec, static_cast<double>(transfer_bandwidth_bytes_per_sec),
+      ideal_bandwidth_utilization_frac, max_ideal_request_size_bytes);
+  DCHECK_GT(options.hole_size_limit, 0) << "Computed hole_size_limit must be > 0";
+  DCHECK_GT(options.range_size_limit, 0) << "Computed range_size_limit must be > 0";
+  return options;
+}
 
-  // range_size_limit = min(MAX_IDEAL_REQUEST_SIZE,
-  //                        hole_size_limit * BW_util_frac / (1 - BW_util_frac))
-  const int64_t range_size_limit = std::min(
-      max_ideal_request_size_bytes,
-      static_cast<int64_t>(std::round(hole_size_limit * ideal_bandwidth_utilization_frac /
-                                      (1 - ideal_bandwidth_utilization_frac))));
-  DCHECK_GT(range_size_limit, 0) << "Computed range_size_limit must be > 0";
+struct ReadMetricsEstimator::Impl {
+  double ideal_bandwidth_utilization_frac;
+  int64_t max_ideal_request_size_mib;
+  double decay;
+  int64_t min_samples;
+
+  mutable std::mutex mutex;
+  int64_t num_samples = 0;
+  // Exponentially weighted moments of the read sizes (x) and durations (y)
+  double mean_x = 0, mean_y = 0, mean_xx = 0, mean_xy = 0;
+
+  double VarianceX() const { return mean_xx - mean_x * mean_x; }
+  double CovarianceXY() const { return mean_xy - mean_x * mean_y; }
+
+  bool ready() const {
+    // The sizes must be spread enough for the slope to be meaningful
+    const double min_stddev = 0.1 * mean_x;
+    return num_samples >= min_samples && VarianceX() > min_stddev * min_stddev &&
+           CovarianceXY() > 0;
+  }
 
-  return {hole_size_limit, range_size_limit, /*lazy=*/false, /*prefetch_limit=*/0};
+  // The duration of a read is fitted as `y = ttfb + x / bandwidth`
+  double seconds_per_byte() const { return ready() ? CovarianceXY() / VarianceX() : 0; }
+
+  double time_to_first_byte() const {
+    return ready() ? std::max(0.0, mean_y - seconds_per_byte() * mean_x) : 0;
+  }
+
+  double bandwidth() const { return ready() ? 1 / seconds_per_byte() : 0; }
+};
+
+ReadMetricsEstimator::ReadMetricsEstimator(double ideal_bandwidth_utilization_frac,
+                                           int64_t max_ideal_request_size_mib,
+                                           double decay, int64_t min_samples)
+    : impl_(new Impl()) {
+  DCHECK_GT(ideal_bandwidth_utilization_frac, 0);
+  DCHECK_LT(ideal_bandwidth_utilization_frac, 1.0);
+  DCHECK_GT(max_ideal_request_size_mib, 0);
+  DCHECK_GT(decay, 0);
+  DCHECK_LE(decay, 1.0);
+  impl_->ideal_bandwidth_utilization_frac = ideal_bandwidth_utilization_frac;
+  impl_->max_ideal_request_size_mib = max_ideal_request_size_mib;
+  impl_->decay = decay;
+  impl_->min_samples = std::max<int64_t>(min_samples, 2);
+}
+
+ReadMetricsEstimator::~ReadMetricsEstimator() = default;
+
+void ReadMetricsEstimator::Record(int64_t nbytes, double seconds) {
+  const auto x = static_cast<double>(nbytes);
+  std::lock_guard<std::mutex> lock(impl_->mutex);
+  ++impl_->num_samples;
+  // Average the first samples evenly, then decay exponentially
+  const double alpha = std::max(impl_->decay, 1.0 / impl_->num_samples);
+  impl_->mean_x += alpha * (x - impl_->mean_x);
+  impl_->mean_y += alpha * (seconds - impl_->mean_y);
+  impl_->mean_xx += alpha * (x * x - impl_->mean_xx);
+  impl_->mean_xy += alpha * (x * seconds - impl_->mean_xy);
+}
+
+int64_t ReadMetricsEstimator::num_samples() const {
+  std::lock_guard<std::mutex> lock(impl_->mutex);
+  return impl_->num_samples;
+}
+
+bool ReadMetricsEstimator::ready() const {
+  std::lock_guard<std::mutex> lock(impl_->mutex);
+  return impl_->ready();
+}
+
+double ReadMetricsEstimator::time_to_first_byte() const {
+  std::lock_guard<std::mutex> lock(impl_->mutex);
+  return impl_->time_to_first_byte();
+}
+
+double ReadMetricsEstimator::bandwidth() const {
+  std::lock_guard<std::mutex> lock(impl_->mutex);
+  return impl_->bandwidth();
+}
+
+CacheOptions ReadMetricsEstimator::Tune(const CacheOptions& options) const {
+  double time_to_first_byte, bandwidth;
+  {
+    std::lock_guard<std::mutex> lock(impl_->mutex);
+    if (!impl_->ready()) {
+      return options;
+    }
+    time_to_first_byte = impl_->time_to_first_byte();
+    bandwidth = impl_->bandwidth();
+  }
+  const auto derived = CacheOptionsFromMetrics(
+      time_to_first_byte, bandwidth, impl_->ideal_bandwidth_utilization_frac,
+      impl_->max_ideal_request_size_mib * 1024 * 1024);
+  CacheOptions tuned = options;
+  tuned.range_size_limit = std::max(derived.range_size_limit, kMinRangeSizeLimit);
+  // Coalescing requires holes to be smaller than ranges
+  tuned.hole_size_limit = std::min(derived.hole_size_limit, tuned.range_size_limit - 1);
+  return tuned;
 }
 
 namespace internal {
@@ -156,6 +273,75 @@ struct ReadRangeCache::Impl {
 
   virtual ~Impl() = default;
 
+  // The options to coalesce ranges with
+  CacheOptions CurrentOptions() const {
+    return options.metrics ? options.metrics->Tune(options) : options;
+  }
+
+  // Read a range, recording the duration of the read if metrics are enabled
+  Future<std::shared_ptr<Buffer>> ReadAsync(const ReadRange& range) {
+    if (!options.metrics) {
+      return file->ReadAsync(ctx, range.offset, range.length);
+    }
+    // Once the bandwidth is known, split large ranges into parallel reads
+    // of the ideal request size
+    int64_t num_parts = 1;
+    if (options.metrics->ready()) {
+      const int64_t part_size = CurrentOptions().range_size_limit;
+      num_parts = std::min<int64_t>((range.length + part_size - 1) / part_size,
+                                    std::max(ctx.executor()->GetCapacity(), 1));
+    }
+    auto self = std::dynamic_pointer_cast<RandomAccessFile>(file->shared_from_this());
+    auto metrics = options.metrics;
+    if (num_parts <= 1) {
+      auto read = [self, metrics, range]() -> Result<std::shared_ptr<Buffer>> {
+        ::arrow::internal::StopWatch watch;
+        watch.Start();
+        ARROW_ASSIGN_OR_RAISE(auto buf, self->ReadAt(range.offset, range.length));
+        metrics->Record(buf->size(), watch.Stop() * 1e-9);
+        return buf;
+      };
+      return DeferNotOk(internal::SubmitIO(ctx, std::move(read)));
+    }
+
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<ResizableBuffer> buffer,
+                          AllocateResizableBuffer(range.length, ctx.pool()));
+    const int64_t part_size = (range.length + num_parts - 1) / num_parts;
+    std::vector<Future<int64_t>> parts;
+    parts.reserve(num_parts);
+    for (int64_t offset = 0; offset < range.length; offset += part_size) {
+      const int64_t position = range.offset + offset;
+      const int64_t length = std::min(part_size, range.length - offset);
+      uint8_t* out = buffer->mutable_data() + offset;
+      auto read_part = [self, metrics, buffer, position, length,
+                        out]() -> Result<int64_t> {
+        ::arrow::internal::StopWatch watch;
+        watch.Start();
+        ARROW_ASSIGN_OR_RAISE(int64_t bytes_read, self->ReadAt(position, length, out));
+        metrics->Record(bytes_read, watch.Stop() * 1e-9);
+        return bytes_read;
+      };
+      parts.push_back(DeferNotOk(internal::SubmitIO(ctx, std::move(read_part))));
+    }
+    return All(std::move(parts))
+        .Then([buffer, part_size](const std::vector<Result<int64_t>>& results)
+                  -> Result<std::shared_ptr<Buffer>> {
+          // A short read means the end of the file was reached
+          int64_t size = 0;
+          for (const auto& result : results) {
+            ARROW_ASSIGN_OR_RAISE(int64_t bytes_read, result);
+            size += bytes_read;
+            if (bytes_read < part_size) {
+              break;
+            }
+          }
+          if (size < buffer->size()) {
+            RETURN_NOT_OK(buffer->Resize(size));
+          }
+          return buffer;
+        });
+  }
+
   // Get the future corresponding to a range
   virtual Future<std::shared_ptr<Buffer>> MaybeRead(RangeCacheEntry* entry) {
     return entry->future;
@@ -166,17 +352,27 @@ struct ReadRangeCache::Impl {
       const std::vector<ReadRange>& ranges) {
     std::vector<RangeCacheEntry> new_entries;
     new_entries.reserve(ranges.size());
-    for (const auto& range : ranges) {
-      new_entries.emplace_back(range, file->ReadAsync(ctx, range.offset, range.length));
+    if (options.metrics) {
+      // Reads are measured one by one
+      for (const auto& range : ranges) {
+        new_entries.emplace_back(range, ReadAsync(range));
+      }
+      return new_entries;
+    }
+    // Issue all reads at once, so that the file can submit them as a batch
+    auto futures = file->ReadManyAsync(ctx, ranges);
+    for (size_t i = 0; i < ranges.size(); ++i) {
+      new_entries.emplace_back(ranges[i], std::move(futures[i]));
     }
     return new_entries;
   }
 
   // Add the given ranges to the cache, coalescing them where possible
   virtual Status Cache(std::vector<ReadRange> ranges) {
-    ARROW_ASSIGN_OR_RAISE(
-        ranges, internal::CoalesceReadRanges(std::move(ranges), options.hole_size_limit,
-                                             options.range_size_limit));
+    const auto current_options = CurrentOptions();
+    ARROW_ASSIGN_OR_RAISE(ranges, internal::CoalesceReadRanges(
+                                      std::move(ranges), current_options.hole_size_limit,
+                                      current_options.range_size_limit));
     std::vector<RangeCacheEntry> new_entries = MakeCacheEntries(ranges);
     // Add new entries, themselves ordered by offset
     if (entries.size() > 0) {
@@ -213,8 +409,7 @@ struct ReadRangeCache::Impl {
              next_it != entries.end() && num_prefetched < options.prefetch_limit;
              ++next_it) {
           if (!next_it->future.is_valid()) {
-            next_it->future =
-                file->ReadAsync(ctx, next_it->range.offset, next_it->range.length);
+            next_it->future = ReadAsync(next_it->range);
           }
           ++num_prefetched;
         }
@@ -267,7 +462,7 @@ struct ReadRangeCache::LazyImpl : public ReadRangeCache::Impl {
   Future<std::shared_ptr<Buffer>> MaybeRead(RangeCacheEntry* entry) override {
     // Called by superclass Read()/WaitFor() so we have the lock
     if (!entry->future.is_valid()) {
-      entry->future = file->ReadAsync(ctx, entry->range.offset, entry->range.length);
+      entry->future = ReadAsync(entry->range);
     }
     return entry->future;
   }
@@ -30,6 +30,8 @@
 namespace arrow {
 namespace io {
 
+class ReadMetricsEstimator;
+
 struct ARROW_EXPORT CacheOptions {
   static constexpr double kDefaultIdealBandwidthUtilizationFrac = 0.9;
   static constexpr int64_t kDefaultMaxIdealRequestSizeMib = 64;
@@ -51,11 +53,19 @@ struct ARROW_EXPORT CacheOptions {
   /// \brief The maximum number of ranges to be prefetched. This is only used
   ///   for lazy cache to asynchronously read some ranges after reading the target range.
   int64_t prefetch_limit = 0;
+  /// \brief EXPERIMENTAL: If set, the cache measures the reads it issues, and
+  ///   derives hole_size_limit and range_size_limit from the estimated latency
+  ///   and bandwidth once available.  Ranges larger than the derived
+  ///   range_size_limit are then also split into parallel reads.
+  ///
+  ///   The estimator should be shared by the caches reading from a given
+  ///   filesystem.  See ReadMetricsEstimator.
+  std::shared_ptr<ReadMetricsEstimator> metrics;
 
   bool operator==(const CacheOptions& other) const {
     return hole_size_limit == other.hole_size_limit &&
            range_size_limit == other.range_size_limit && lazy == other.lazy &&
-           prefetch_limit == other.prefetch_limit;
+           prefetch_limit == other.prefetch_limit && metrics == other.metrics;
   }
 
   /// \brief Construct CacheOptions from network storage metrics (e.g. S3).
@@ -82,6 +92,67 @@ struct ARROW_EXPORT CacheOptions {
   static CacheOptions LazyDefaults();
 };
 
+/// \brief EXPERIMENTAL: Estimate the latency and bandwidth of a storage backend
+/// from the reads issued to it, so as to tune read coalescing at runtime.
+///
+/// Each read is modelled as taking `time_to_first_byte + size / bandwidth`.
+/// Both are fitted by least squares over the recorded reads, older reads being
+/// given exponentially less weight so that the estimates follow changing
+/// conditions.  Telling latency from bandwidth requires reads of different
+/// sizes: until enough of them were recorded, ready() returns false.
+///
+/// A ReadRangeCache whose CacheOptions::metrics is set records its reads here.
+/// This class is thread-safe.
+class ARROW_EXPORT ReadMetricsEstimator {
+ public:
+  static constexpr double kDefaultDecay = 0.05;
+  static constexpr int64_t kDefaultMinSamples = 8;
+  /// The smallest range_size_limit returned by Tune()
+  static constexpr int64_t kMinRangeSizeLimit = 64 * 1024;
+
+  /// \param[in] ideal_bandwidth_utilization_frac See
+  ///   CacheOptions::MakeFromNetworkMetrics
+  /// \param[in] max_ideal_request_size_mib See CacheOptions::MakeFromNetworkMetrics
+  /// \param[in] decay The weight of each new read in the estimates, between 0 and 1
+  /// \param[in] min_samples The number of reads to record before ready() may be true
+  explicit ReadMetricsEstimator(
+      double ideal_bandwidth_utilization_frac =
+          CacheOptions::kDefaultIdealBandwidthUtilizationFrac,
+      int64_t max_ideal_request_size_mib = CacheOptions::kDefaultMaxIdealRequestSizeMib,
+      double decay = kDefaultDecay, int64_t min_samples = kDefaultMinSamples);
+  ~ReadMetricsEstimator();
+
+  /// \brief Record a read of `nbytes` bytes that took `seconds` to complete
+  void Record(int64_t nbytes, double seconds);
+
+  /// \brief The number of reads recorded
+  int64_t num_samples() const;
+
+  /// \brief Whether latency and bandwidth can be estimated yet
+  bool ready() const;
+
+  /// \brief The estimated time to first byte of a read, in seconds
+  ///
+  /// Zero if not ready().
+  double time_to_first_byte() const;
+
+  /// \brief The estimated transfer bandwidth of a read, in bytes/sec
+  ///
+  /// Zero if not ready().
+  double bandwidth() const;
+
+  /// \brief Return `options` with coalescing limits derived from the estimates
+  ///
+  /// hole_size_limit and range_size_limit are computed as in
+  /// CacheOptions::MakeFromNetworkMetrics (range_size_limit being at least
+  /// kMinRangeSizeLimit).  If not ready(), `options` is returned unchanged.
+  CacheOptions Tune(const CacheOptions& options) const;
+
+ private:
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
 namespace internal {
 
 /// \brief A read cache designed to hide IO latencies when reading.
@@ -48,6 +48,7 @@
 
 #include "arrow/io/file.h"
 #include "arrow/io/interfaces.h"
+#include "arrow/io/uring_internal.h"
 #include "arrow/io/util_internal.h"
 
 #include "arrow/buffer.h"
@@ -64,6 +65,136 @@ using internal::IOErrorFromErrno;
 
 namespace io {
 
+namespace {
+
+constexpr int64_t kDirectIOAlignment = PageCacheOptions::kDirectIOAlignment;
+
+// Size of the aligned staging buffer of direct I/O writes
+constexpr int64_t kDirectWriteBufferSize = 1 << 20;
+
+// Largest single direct I/O read, a multiple of kDirectIOAlignment
+constexpr int64_t kMaxDirectReadSize = int64_t(1) << 30;
+
+int64_t AlignDown(int64_t value) { return value - value % kDirectIOAlignment; }
+
+int64_t AlignUp(int64_t value) { return AlignDown(value + kDirectIOAlignment - 1); }
+
+// Page cache advice is only a hint, so only logic errors are raised
+Status ReportAdviseError(int errnum, const char* msg) {
+  if (errnum == EBADF || errnum == EINVAL) {
+    // These are logic errors, so raise them
+    return IOErrorFromErrno(errnum, msg);
+  }
+#ifndef NDEBUG
+  // Other errors may be encountered if the target device or filesystem
+  // does not support fadvise advisory (for example, macOS can return
+  // ENOTTY on macOS: ARROW-13983).  Log the error for diagnosis
+  // on debug builds, but avoid bothering the user otherwise.
+  ARROW_LOG(WARNING) << IOErrorFromErrno(errnum, msg).ToString();
+#else
+  ARROW_UNUSED(msg);
+#endif
+  return Status::OK();
+}
+
+enum class FileAdvice { kSequential, kDontNeed };
+
+// Advise the kernel about the use of a region of a file (a zero length
+// extends the region to the end of the file)
+Status AdviseFile(int fd, int64_t offset, int64_t length, FileAdvice advice) {
+#if defined(POSIX_FADV_WILLNEED)
+  const int posix_advice =
+      advice == FileAdvice::kSequential ? POSIX_FADV_SEQUENTIAL : POSIX_FADV_DONTNEED;
+  int ret = posix_fadvise(fd, offset, length, posix_advice);
+  if (ret) {
+    return ReportAdviseError(ret, "posix_fadvise failed");
+  }
+#else
+  ARROW_UNUSED(fd);
+  ARROW_UNUSED(offset);
+  ARROW_UNUSED(length);
+  ARROW_UNUSED(advice);
+#endif
+  return Status::OK();
+}
+
+// Try to make reads and writes on `fd` bypass the page cache, returning
+// whether that is supported
+bool EnableDirectIO(int fd) {
+#if defined(O_DIRECT)
+  const int flags = fcntl(fd, F_GETFL);
+  return flags != -1 && fcntl(fd, F_SETFL, flags | O_DIRECT) == 0;
+#elif defined(F_NOCACHE)  // macOS
+  return fcntl(fd, F_NOCACHE, 1) != -1;
+#else
+  ARROW_UNUSED(fd);
+  return false;
+#endif
+}
+
+Status DisableDirectIO(int fd) {
+#if defined(O_DIRECT)
+  const int flags = fcntl(fd, F_GETFL);
+  if (flags == -1 || fcntl(fd, F_SETFL, flags & ~O_DIRECT) == -1) {
+    return IOErrorFromErrno(errno, "Failed to disable direct I/O");
+  }
+#else
+  ARROW_UNUSED(fd);
+#endif
+  return Status::OK();
+}
+
+// Wait for written data to reach the device
+Status SyncFileData(int fd) {
+#if defined(_WIN32)
+  ARROW_UNUSED(fd);
+  return Status::OK();
+#else
+#  if defined(__linux__)
+  int ret = fdatasync(fd);
+#  else
+  int ret = fsync(fd);
+#  endif
+  if (ret == -1) {
+    return IOErrorFromErrno(errno, "Failed to sync file data");
+  }
+  return Status::OK();
+#endif
+}
+
+// Positional read for direct I/O: `out`, `position` and `nbytes` must be aligned.
+// Unlike FileReadAt(), this stops at the first short read, as reading on from an
+// unaligned position isn't allowed.
+Result<int64_t> DirectReadAt(int fd, uint8_t* out, int64_t position, int64_t nbytes) {
+#if defined(_WIN32)
+  return Status::NotImplemented("Direct I/O is not supported on Windows");
+#else
+  int64_t bytes_read = 0;
+  while (bytes_read < nbytes) {
+    const int64_t chunk_size = std::min(kMaxDirectReadSize, nbytes - bytes_read);
+    const int64_t ret = pread(fd, out + bytes_read, static_cast<size_t>(chunk_size),
+                              static_cast<off_t>(position + bytes_read));
+    if (ret == -1) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return IOErrorFromErrno(errno, "Error reading bytes from file");
+    }
+    bytes_read += ret;
+    if (ret < chunk_size && ret % kDirectIOAlignment != 0) {
+      // EOF
+      break;
+    }
+    if (ret == 0) {
+      break;
+    }
+  }
+  return bytes_read;
+#endif
+}
+
+}  // namespace
+
 class OSFile {
  public:
   // Note: only one of the Open* methods below may be called on a given instance
@@ -127,6 +258,26 @@ class OSFile {
 
   Status Close() { return fd_.Close(); }
 
+  // Apply page cache options to the open file
+  Status SetPageCacheOptions(const PageCacheOptions& options) {
+    page_cache_options_ = options;
+    if (options.sequential_access) {
+      RETURN_NOT_OK(AdviseFile(fd_.fd(), 0, 0, FileAdvice::kSequential));
+    }
+    if (options.direct_io) {
+      direct_io_ = EnableDirectIO(fd_.fd());
+    }
+    return Status::OK();
+  }
+
+  // Drop a consumed region of the file from the page cache, if requested
+  Status MaybeDropFromCache(int64_t position, int64_t nbytes) {
+    if (page_cache_options_.drop_after_access && !direct_io_ && nbytes > 0) {
+      return AdviseFile(fd_.fd(), position, nbytes, FileAdvice::kDontNeed);
+    }
+    return Status::OK();
+  }
+
   Result<int64_t> Read(int64_t nbytes, void* out) {
     RETURN_NOT_OK(CheckClosed());
     RETURN_NOT_OK(CheckPositioned());
@@ -180,6 +331,8 @@ class OSFile {
 
   FileMode::type mode() const { return mode_; }
 
+  bool direct_io() const { return direct_io_; }
+
   std::mutex& lock() { return lock_; }
 
  protected:
@@ -210,6 +363,9 @@ class OSFile {
   int64_t size_{-1};
   // Whether ReadAt made the file position non-deterministic.
   std::atomic<bool> need_seeking_{false};
+  PageCacheOptions page_cache_options_;
+  // Whether reads and writes bypass the page cache
+  bool direct_io_ = false;
 };
 
 // ----------------------------------------------------------------------
@@ -222,6 +378,33 @@ class ReadableFile::ReadableFileImpl : public OSFile {
   Status Open(const std::string& path) { return OpenReadable(path); }
   Status Open(int fd) { return OpenReadable(fd); }
 
+  Status Open(const std::string& path, const PageCacheOptions& options) {
+    RETURN_NOT_OK(OpenReadable(path));
+    return SetPageCacheOptions(options);
+  }
+
+  Result<int64_t> Read(int64_t nbytes, void* out) {
+    if (!direct_io_ && !page_cache_options_.drop_after_access) {
+      return OSFile::Read(nbytes, out);
+    }
+    RETURN_NOT_OK(CheckClosed());
+    RETURN_NOT_OK(CheckPositioned());
+    ARROW_ASSIGN_OR_RAISE(int64_t position, Tell());
+    ARROW_ASSIGN_OR_RAISE(int64_t bytes_read,
+                          ReadAtUnchecked(position, nbytes, static_cast<uint8_t*>(out)));
+    RETURN_NOT_OK(::arrow::internal::FileSeek(fd_.fd(), position + bytes_read));
+    return bytes_read;
+  }
+
+  Result<int64_t> ReadAt(int64_t position, int64_t nbytes, void* out) {
+    RETURN_NOT_OK(CheckClosed());
+    RETURN_NOT_OK(internal::ValidateRange(position, nbytes));
+    // ReadAt() leaves the file position undefined, so require that we seek
+    // before calling Read() or Write().
+    need_seeking_.store(true);
+    return ReadAtUnchecked(position, nbytes, static_cast<uint8_t*>(out));
+  }
+
   Result<std::shared_ptr<Buffer>> ReadBuffer(int64_t nbytes) {
     ARROW_ASSIGN_OR_RAISE(auto buffer, AllocateResizableBuffer(nbytes, pool_));
 
@@ -235,6 +418,12 @@ class ReadableFile::ReadableFileImpl : public OSFile {
   }
 
   Result<std::shared_ptr<Buffer>> ReadBufferAt(int64_t position, int64_t nbytes) {
+    if (direct_io_) {
+      RETURN_NOT_OK(CheckClosed());
+      RETURN_NOT_OK(internal::ValidateRange(position, nbytes));
+      need_seeking_.store(true);
+      return DirectReadBufferAt(position, nbytes);
+    }
     ARROW_ASSIGN_OR_RAISE(auto buffer, AllocateResizableBuffer(nbytes, pool_));
 
     ARROW_ASSIGN_OR_RAISE(int64_t bytes_read,
@@ -248,22 +437,7 @@ class ReadableFile::ReadableFileImpl : public OSFile {
   }
 
   Status WillNeed(const std::vector<ReadRange>& ranges) {
-    auto report_error = [](int errnum, const char* msg) -> Status {
-      if (errnum == EBADF || errnum == EINVAL) {
-        // These are logic errors, so raise them
-        return IOErrorFromErrno(errnum, msg);
-      }
-#ifndef NDEBUG
-      // Other errors may be encountered if the target device or filesystem
-      // does not support fadvise advisory (for example, macOS can return
-      // ENOTTY on macOS: ARROW-13983).  Log the error for diagnosis
-      // on debug builds, but avoid bothering the user otherwise.
-      ARROW_LOG(WARNING) << IOErrorFromErrno(errnum, msg).ToString();
-#else
-      ARROW_UNUSED(msg);
-#endif
-      return Status::OK();
-    };
+    auto report_error = ReportAdviseError;
     RETURN_NOT_OK(CheckClosed());
     for (const auto& range : ranges) {
       RETURN_NOT_OK(internal::ValidateRange(range.offset, range.length));
@@ -287,7 +461,36 @@ class ReadableFile::ReadableFileImpl : public OSFile {
     return Status::OK();
   }
 
+  MemoryPool* pool() const { return pool_; }
+
  private:
+  Result<int64_t> ReadAtUnchecked(int64_t position, int64_t nbytes, uint8_t* out) {
+    if (direct_io_) {
+      ARROW_ASSIGN_OR_RAISE(auto buffer, DirectReadBufferAt(position, nbytes));
+      std::memcpy(out, buffer->data(), static_cast<size_t>(buffer->size()));
+      return buffer->size();
+    }
+    ARROW_ASSIGN_OR_RAISE(int64_t bytes_read, ::arrow::internal::FileReadAt(
+                                                  fd_.fd(), out, position, nbytes));
+    RETURN_NOT_OK(MaybeDropFromCache(position, bytes_read));
+    return bytes_read;
+  }
+
+  // Read the aligned region enclosing [position, position + nbytes) into an
+  // aligned buffer, and return the requested part of it
+  Result<std::shared_ptr<Buffer>> DirectReadBufferAt(int64_t position, int64_t nbytes) {
+    const int64_t start = AlignDown(position);
+    const int64_t end = AlignUp(position + nbytes);
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> buffer,
+                          AllocateBuffer(end - start, kDirectIOAlignment, pool_));
+    ARROW_ASSIGN_OR_RAISE(
+        int64_t bytes_read,
+        DirectReadAt(fd_.fd(), buffer->mutable_data(), start, end - start));
+    const int64_t offset = position - start;
+    const int64_t length = std::max<int64_t>(0, std::min(nbytes, bytes_read - offset));
+    return SliceBuffer(std::move(buffer), offset, length);
+  }
+
   MemoryPool* pool_;
 };
 
@@ -308,6 +511,13 @@ Result<std::shared_ptr<ReadableFile>> ReadableFile::Open(int fd, MemoryPool* poo
   return file;
 }
 
+Result<std::shared_ptr<ReadableFile>> ReadableFile::Open(
+    const std::string& path, MemoryPool* pool, const PageCacheOptions& options) {
+  auto file = std::shared_ptr<ReadableFile>(new ReadableFile(pool));
+  RETURN_NOT_OK(file->impl_->Open(path, options));
+  return file;
+}
+
 Status ReadableFile::DoClose() { return impl_->Close(); }
 
 bool ReadableFile::closed() const { return !impl_->is_open(); }
@@ -340,6 +550,175 @@ Status ReadableFile::DoSeek(int64_t pos) { return impl_->Seek(pos); }
 
 int ReadableFile::file_descriptor() const { return impl_->fd(); }
 
+// ----------------------------------------------------------------------
+// UringReadableFile implementation
+
+namespace {
+
+// Maximum number of reads in flight for a single file
+constexpr uint32_t kUringEntries = 64;
+
+}  // namespace
+
+class UringReadableFile::UringReader {
+ public:
+  UringReader(std::unique_ptr<internal::IoUring> ring, ReadableFileImpl* file)
+      : ring_(std::move(ring)), file_(file) {}
+
+  // Whether the ring failed, in which case reads go through pread() instead
+  bool failed() const { return failed_.load(); }
+
+  // Read the ranges into the buffers and finish the corresponding futures
+  Status ReadMany(const std::vector<ReadRange>& ranges,
+                  const std::vector<std::shared_ptr<ResizableBuffer>>& buffers,
+                  std::vector<Future<std::shared_ptr<Buffer>>> futures) {
+    std::vector<uint8_t*> out(buffers.size());
+    for (size_t i = 0; i < buffers.size(); ++i) {
+      out[i] = buffers[i]->mutable_data();
+    }
+    std::vector<Result<int64_t>> results(ranges.size());
+    auto on_done = [&](size_t i, Result<int64_t> bytes_read) {
+      results[i] = std::move(bytes_read);
+    };
+    Status ring_status = Status::IOError("io_uring instance failed earlier");
+    if (!failed()) {
+      // The ring isn't thread-safe, so concurrent batches are serialized
+      std::lock_guard<std::mutex> guard(lock_);
+      ring_status = ring_->ReadMany(ranges, out, on_done);
+      if (!ring_status.ok()) {
+        failed_.store(true);
+      }
+    }
+    // Once the ring failed, read the ranges it didn't with pread()
+    if (!ring_status.ok()) {
+      for (size_t i = 0; i < ranges.size(); ++i) {
+        if (!results[i].ok()) {
+          results[i] = file_->ReadAt(ranges[i].offset, ranges[i].length, out[i]);
+        }
+      }
+    }
+    // Finish the futures outside of the lock, as their callbacks run inline
+    for (size_t i = 0; i < ranges.size(); ++i) {
+      futures[i].MarkFinished(FinishBuffer(buffers[i], std::move(results[i])));
+    }
+    return Status::OK();
+  }
+
+ private:
+  static Result<std::shared_ptr<Buffer>> FinishBuffer(
+      std::shared_ptr<ResizableBuffer> buffer, Result<int64_t> maybe_bytes_read) {
+    ARROW_ASSIGN_OR_RAISE(int64_t bytes_read, maybe_bytes_read);
+    if (bytes_read < buffer->size()) {
+      RETURN_NOT_OK(buffer->Resize(bytes_read));
+      buffer->ZeroPadding();
+    }
+    return std::shared_ptr<Buffer>(std::move(buffer));
+  }
+
+  std::mutex lock_;
+  std::unique_ptr<internal::IoUring> ring_;
+  ReadableFileImpl* file_;
+  std::atomic<bool> failed_{false};
+};
+
+UringReadableFile::UringReadableFile(MemoryPool* pool) : ReadableFile(pool) {}
+
+UringReadableFile::~UringReadableFile() = default;
+
+Result<std::shared_ptr<UringReadableFile>> UringReadableFile::Open(
+    const std::string& path, MemoryPool* pool) {
+  auto file = std::shared_ptr<UringReadableFile>(new UringReadableFile(pool));
+  RETURN_NOT_OK(file->impl_->Open(path));
+  RETURN_NOT_OK(file->InitRing());
+  return file;
+}
+
+Result<std::shared_ptr<UringReadableFile>> UringReadableFile::Open(int fd,
+                                                                   MemoryPool* pool) {
+  auto file = std::shared_ptr<UringReadableFile>(new UringReadableFile(pool));
+  RETURN_NOT_OK(file->impl_->Open(fd));
+  RETURN_NOT_OK(file->InitRing());
+  return file;
+}
+
+Status UringReadableFile::InitRing() {
+  // Without io_uring, fall back on ReadableFile's asynchronous reads
+  if (internal::IoUring::IsSupported()) {
+    auto maybe_ring = internal::IoUring::Make(impl_->fd(), kUringEntries);
+    if (maybe_ring.ok()) {
+      reader_ = std::make_shared<UringReader>(maybe_ring.MoveValueUnsafe(), impl_.get());
+    }
+  }
+  return Status::OK();
+}
+
+bool UringReadableFile::io_uring_enabled() const {
+  return reader_ != nullptr && !reader_->failed();
+}
+
+Future<std::shared_ptr<Buffer>> UringReadableFile::ReadAsync(const IOContext& ctx,
+                                                             int64_t position,
+                                                             int64_t nbytes) {
+  return ReadManyAsync(ctx, {{position, nbytes}})[0];
+}
+
+std::vector<Future<std::shared_ptr<Buffer>>> UringReadableFile::ReadManyAsync(
+    const IOContext& ctx, const std::vector<ReadRange>& ranges) {
+  if (!io_uring_enabled()) {
+    std::vector<Future<std::shared_ptr<Buffer>>> futures;
+    futures.reserve(ranges.size());
+    for (const auto& range : ranges) {
+      futures.push_back(ReadableFile::ReadAsync(ctx, range.offset, range.length));
+    }
+    return futures;
+  }
+
+  auto fail_all = [&](const Status& st) {
+    return std::vector<Future<std::shared_ptr<Buffer>>>(
+        ranges.size(), Future<std::shared_ptr<Buffer>>::MakeFinished(st));
+  };
+  auto st = impl_->CheckClosed();
+  std::vector<std::shared_ptr<ResizableBuffer>> buffers;
+  buffers.reserve(ranges.size());
+  for (const auto& range : ranges) {
+    if (!st.ok()) break;
+    st = internal::ValidateRange(range.offset, range.length);
+    if (!st.ok()) break;
+    auto maybe_buffer = AllocateResizableBuffer(range.length, impl_->pool());
+    st = maybe_buffer.status();
+    if (!st.ok()) break;
+    buffers.push_back(maybe_buffer.MoveValueUnsafe());
+  }
+  if (!st.ok()) {
+    return fail_all(st);
+  }
+
+  std::vector<Future<std::shared_ptr<Buffer>>> futures(ranges.size());
+  for (auto& future : futures) {
+    future = Future<std::shared_ptr<Buffer>>::Make();
+  }
+  // Keep the file open while the reads are in flight
+  auto self = std::dynamic_pointer_cast<UringReadableFile>(shared_from_this());
+  auto maybe_done = internal::SubmitIO(
+      ctx, [self, ranges, buffers = std::move(buffers), futures]() {
+        return self->reader_->ReadMany(ranges, buffers, futures);
+      });
+  if (!maybe_done.ok()) {
+    return fail_all(maybe_done.status());
+  }
+  // If the reads were cancelled before they started, fail them
+  maybe_done->AddCallback([futures](const Status& st) mutable {
+    if (!st.ok()) {
+      for (auto& future : futures) {
+        if (!future.is_finished()) {
+          future.MarkFinished(st);
+        }
+      }
+    }
+  });
+  return futures;
+}
+
 // ----------------------------------------------------------------------
 // FileOutputStream
 
@@ -350,6 +729,109 @@ class FileOutputStream::FileOutputStreamImpl : public OSFile {
     return OpenWritable(path, truncate, append, true /* write_only */);
   }
   Status Open(int fd) { return OpenWritable(fd); }
+
+  Status Open(const std::string& path, bool append, const PageCacheOptions& options,
+              MemoryPool* pool) {
+    RETURN_NOT_OK(Open(path, append));
+    return SetWriteOptions(options, pool);
+  }
+
+  Status Open(int fd, const PageCacheOptions& options, MemoryPool* pool) {
+    RETURN_NOT_OK(Open(fd));
+    Status st = SetWriteOptions(options, pool);
+    if (!st.ok()) {
+      // Leave the file descriptor to the caller, as when opening it fails
+      fd_.Detach();
+    }
+    return st;
+  }
+
+  Status Close() {
+    if (!is_open()) {
+      return Status::OK();
+    }
+    Status st = FinishWrites();
+    return st & OSFile::Close();
+  }
+
+  Result<int64_t> Tell() const {
+    ARROW_ASSIGN_OR_RAISE(int64_t position, OSFile::Tell());
+    return position + buffered_;
+  }
+
+  Status Write(const void* data, int64_t length) {
+    if (!direct_io_) {
+      return OSFile::Write(data, length);
+    }
+    RETURN_NOT_OK(CheckClosed());
+    if (length < 0) {
+      return Status::IOError("Length must be non-negative");
+    }
+    std::lock_guard<std::mutex> guard(lock_);
+    // Stage the data in the aligned buffer, writing it out whenever it is full
+    auto bytes = static_cast<const uint8_t*>(data);
+    while (length > 0) {
+      const int64_t chunk_size = std::min(length, direct_buffer_->size() - buffered_);
+      std::memcpy(direct_buffer_->mutable_data() + buffered_, bytes,
+                  static_cast<size_t>(chunk_size));
+      buffered_ += chunk_size;
+      bytes += chunk_size;
+      length -= chunk_size;
+      if (buffered_ == direct_buffer_->size()) {
+        RETURN_NOT_OK(
+            ::arrow::internal::FileWrite(fd_.fd(), direct_buffer_->data(), buffered_));
+        buffered_ = 0;
+      }
+    }
+    return Status::OK();
+  }
+
+ private:
+  Status SetWriteOptions(PageCacheOptions options, MemoryPool* pool) {
+    if (options.direct_io) {
+      // Direct writes must start at an aligned offset
+      bool aligned = size_ >= 0 && size_ % kDirectIOAlignment == 0;
+      if (aligned) {
+        ARROW_ASSIGN_OR_RAISE(int64_t position, OSFile::Tell());
+        aligned = position % kDirectIOAlignment == 0;
+      }
+      options.direct_io = aligned;
+    }
+    RETURN_NOT_OK(SetPageCacheOptions(options));
+    if (direct_io_) {
+      ARROW_ASSIGN_OR_RAISE(direct_buffer_, AllocateBuffer(kDirectWriteBufferSize,
+                                                           kDirectIOAlignment, pool));
+    }
+    return Status::OK();
+  }
+
+  // Write out staged data and apply page cache options before closing
+  Status FinishWrites() {
+    std::lock_guard<std::mutex> guard(lock_);
+    if (buffered_ > 0) {
+      const int64_t aligned_size = AlignDown(buffered_);
+      RETURN_NOT_OK(
+          ::arrow::internal::FileWrite(fd_.fd(), direct_buffer_->data(), aligned_size));
+      if (aligned_size < buffered_) {
+        // The unaligned tail of the file can't be written directly
+        RETURN_NOT_OK(DisableDirectIO(fd_.fd()));
+        direct_io_ = false;
+        RETURN_NOT_OK(::arrow::internal::FileWrite(
+            fd_.fd(), direct_buffer_->data() + aligned_size, buffered_ - aligned_size));
+      }
+      buffered_ = 0;
+    }
+    if (page_cache_options_.drop_after_access && !direct_io_) {
+      // Only clean pages can be dropped
+      RETURN_NOT_OK(SyncFileData(fd_.fd()));
+      RETURN_NOT_OK(AdviseFile(fd_.fd(), 0, 0, FileAdvice::kDontNeed));
+    }
+    return Status::OK();
+  }
+
+  // Staging buffer for direct writes
+  std::unique_ptr<Buffer> direct_buffer_;
+  int64_t buffered_ = 0;
 };
 
 FileOutputStream::FileOutputStream() { impl_.reset(new FileOutputStreamImpl()); }
@@ -369,6 +851,21 @@ Result<std::shared_ptr<FileOutputStream>> FileOutputStream::Open(int fd) {
   return stream;
 }
 
+Result<std::shared_ptr<FileOutputStream>> FileOutputStream::Open(
+    const std::string& path, bool append, const PageCacheOptions& options,
+    MemoryPool* pool) {
+  auto stream = std::shared_ptr<FileOutputStream>(new FileOutputStream());
+  RETURN_NOT_OK(stream->impl_->Open(path, append, options, pool));
+  return stream;
+}
+
+Result<std::shared_ptr<FileOutputStream>> FileOutputStream::Open(
+    int fd, const PageCacheOptions& options, MemoryPool* pool) {
+  auto stream = std::shared_ptr<FileOutputStream>(new FileOutputStream());
+  RETURN_NOT_OK(stream->impl_->Open(fd, options, pool));
+  return stream;
+}
+
 Status FileOutputStream::Close() { return impl_->Close(); }
 
 bool FileOutputStream::closed() const { return !impl_->is_open(); }
@@ -384,6 +881,74 @@ int FileOutputStream::file_descriptor() const { return impl_->fd(); }
 // ----------------------------------------------------------------------
 // Implement MemoryMappedFile
 
+namespace {
+
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+#  define ARROW_HAVE_MMAP_HUGE_PAGES
+
+// Size of transparent huge pages on common architectures
+constexpr int64_t kHugePageSize = 2 * 1024 * 1024;
+
+// Map a file region at an address aligned on a huge page boundary, so that it
+// can be backed by huge pages.  This reserves a larger address range and maps
+// the file over an aligned part of it.
+void* MapHugePageAligned(size_t length, int prot, int flags, int fd, off_t offset) {
+  const auto page_size = static_cast<size_t>(::arrow::internal::GetPageSize());
+  const size_t reserved_length = length + kHugePageSize;
+  void* reserved = mmap(nullptr, reserved_length, PROT_NONE,
+                        MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+  if (reserved == MAP_FAILED) {
+    return MAP_FAILED;
+  }
+  const auto start = reinterpret_cast<uintptr_t>(reserved);
+  const auto aligned = (start + kHugePageSize - 1) & ~uintptr_t(kHugePageSize - 1);
+  void* result =
+      mmap(reinterpret_cast<void*>(aligned), length, prot, flags | MAP_FIXED, fd, offset);
+  if (result == MAP_FAILED) {
+    const int errnum = errno;
+    munmap(reserved, reserved_length);
+    errno = errnum;
+    return MAP_FAILED;
+  }
+  // Release the unused parts of the reservation
+  const uintptr_t end = aligned + (length + page_size - 1) / page_size * page_size;
+  if (aligned > start) {
+    munmap(reserved, aligned - start);
+  }
+  if (start + reserved_length > end) {
+    munmap(reinterpret_cast<void*>(end), start + reserved_length - end);
+  }
+  madvise(result, length, MADV_HUGEPAGE);
+  return result;
+}
+#endif
+
+// Map the pages of a memory region into the page tables
+void PrefaultMemory(const uint8_t* data, int64_t size) {
+  if (size <= 0) {
+    return;
+  }
+  const int64_t page_size = ::arrow::internal::GetPageSize();
+#if defined(MADV_POPULATE_READ)
+  const auto addr = reinterpret_cast<uintptr_t>(data);
+  const auto aligned_addr = addr & ~static_cast<uintptr_t>(page_size - 1);
+  if (madvise(reinterpret_cast<void*>(aligned_addr),
+              static_cast<size_t>(size) + (addr - aligned_addr),
+              MADV_POPULATE_READ) == 0) {
+    return;
+  }
+  // Not supported by the running kernel, touch each page instead
+#endif
+  volatile uint8_t sink = 0;
+  for (int64_t offset = 0; offset < size; offset += page_size) {
+    sink = sink ^ data[offset];
+  }
+  sink = sink ^ data[size - 1];
+  ARROW_UNUSED(sink);
+}
+
+}  // namespace
+
 class MemoryMappedFile::MemoryMap
     : public std::enable_shared_from_this<MemoryMappedFile::MemoryMap> {
  public:
@@ -419,6 +984,9 @@ class MemoryMappedFile::MemoryMap
 
   MemoryMap() : file_size_(0), map_len_(0) {}
 
+  explicit MemoryMap(const MemoryMapOptions& options)
+      : options_(options), file_size_(0), map_len_(0) {}
+
   ~MemoryMap() { ARROW_CHECK_OK(Close()); }
 
   Status Close() {
@@ -559,6 +1127,8 @@ class MemoryMappedFile::MemoryMap
 
   std::mutex& resize_lock() { return resize_lock_; }
 
+  const MemoryMapOptions& options() const { return options_; }
+
  private:
   // Initialize the mmap and set size, capacity and the data pointers
   Status InitMMap(int64_t initial_size, bool resize_file = false,
@@ -583,8 +1153,23 @@ class MemoryMappedFile::MemoryMap
                                    "(are you using a 32-bit build of Arrow?)");
     }
 
-    void* result = mmap(nullptr, static_cast<size_t>(mmap_length), prot_flags_, map_mode_,
-                        file_->fd(), static_cast<off_t>(offset));
+    int map_flags = map_mode_;
+#ifdef MAP_POPULATE
+    if (options_.populate) {
+      map_flags |= MAP_POPULATE;
+    }
+#endif
+    void* result;
+#ifdef ARROW_HAVE_MMAP_HUGE_PAGES
+    if (options_.huge_pages && mmap_length >= kHugePageSize) {
+      result = MapHugePageAligned(static_cast<size_t>(mmap_length), prot_flags_,
+                                  map_flags, file_->fd(), static_cast<off_t>(offset));
+    } else
+#endif
+    {
+      result = mmap(nullptr, static_cast<size_t>(mmap_length), prot_flags_, map_flags,
+                    file_->fd(), static_cast<off_t>(offset));
+    }
     if (result == MAP_FAILED) {
       return Status::IOError("Memory mapping file failed: ",
                              ::arrow::internal::ErrnoMessage(errno));
@@ -598,6 +1183,7 @@ class MemoryMappedFile::MemoryMap
     return Status::OK();
   }
 
+  MemoryMapOptions options_;
   std::unique_ptr<OSFile> file_;
   int prot_flags_;
   int map_mode_;
@@ -642,6 +1228,15 @@ Result<std::shared_ptr<MemoryMappedFile>> MemoryMappedFile::Open(const std::stri
   return result;
 }
 
+Result<std::shared_ptr<MemoryMappedFile>> MemoryMappedFile::Open(
+    const std::string& path, FileMode::type mode, const MemoryMapOptions& options) {
+  std::shared_ptr<MemoryMappedFile> result(new MemoryMappedFile());
+
+  result->memory_map_.reset(new MemoryMap(options));
+  RETURN_NOT_OK(result->memory_map_->Open(path, mode));
+  return result;
+}
+
 Result<int64_t> MemoryMappedFile::GetSize() {
   RETURN_NOT_OK(memory_map_->CheckClosed());
   return memory_map_->size();
@@ -731,7 +1326,27 @@ Status MemoryMappedFile::WillNeed(const std::vector<ReadRange>& ranges) {
     regions[i] = {const_cast<uint8_t*>(memory_map_->data() + range.offset),
                   static_cast<size_t>(size)};
   }
-  return ::arrow::internal::MemoryAdviseWillNeed(regions);
+  RETURN_NOT_OK(::arrow::internal::MemoryAdviseWillNeed(regions));
+
+  if (memory_map_->options().prefault_async) {
+    // The slices keep the mapping alive until the task has run
+    std::vector<std::shared_ptr<Buffer>> slices;
+    slices.reserve(regions.size());
+    for (size_t i = 0; i < regions.size(); ++i) {
+      ARROW_ASSIGN_OR_RAISE(auto slice, memory_map_->Slice(ranges[i].offset,
+                                                           regions[i].size));
+      slices.push_back(std::move(slice));
+    }
+    // Fire and forget: prefaulting is only an optimization
+    ARROW_ASSIGN_OR_RAISE(auto prefaulted,
+                          internal::SubmitIO(io_context(), [slices = std::move(slices)] {
+                            for (const auto& slice : slices) {
+                              PrefaultMemory(slice->data(), slice->size());
+                            }
+                          }));
+    ARROW_UNUSED(prefaulted);
+  }
+  return Status::OK();
 }
 
 bool MemoryMappedFile::supports_zero_copy() const { return true; }
@@ -36,6 +36,44 @@ class Status;
 
 namespace io {
 
+/// \brief How reads and writes of a local file interact with the OS page cache
+struct ARROW_EXPORT PageCacheOptions {
+  /// \brief Bypass the page cache (O_DIRECT)
+  ///
+  /// Reads and writes are then issued with offsets, lengths and buffer addresses
+  /// aligned to kDirectIOAlignment, using buffers allocated from the file's
+  /// MemoryPool.  Unaligned reads are widened to the enclosing aligned region;
+  /// writes are staged in an aligned buffer, and the unaligned tail of the file
+  /// is written through the page cache on Close().
+  ///
+  /// Only has an effect on platforms and filesystems supporting it.  It is also
+  /// ignored when appending to a file whose size isn't a multiple of
+  /// kDirectIOAlignment.
+  bool direct_io = false;
+
+  /// \brief Advise the kernel that the file will be accessed sequentially
+  ///
+  /// This typically makes the kernel read ahead more aggressively.
+  bool sequential_access = false;
+
+  /// \brief Advise the kernel to drop file data from the page cache once
+  /// it has been consumed
+  ///
+  /// Data is dropped after each read, and when a written file is closed (which
+  /// then waits for the written data to reach the device).  This is a no-op
+  /// for direct I/O.
+  bool drop_after_access = false;
+
+  /// Alignment of direct I/O offsets, lengths and memory addresses, suitable
+  /// for the logical block size of common devices
+  static constexpr int64_t kDirectIOAlignment = 4096;
+
+  bool Equals(const PageCacheOptions& other) const {
+    return direct_io == other.direct_io && sequential_access == other.sequential_access &&
+           drop_after_access == other.drop_after_access;
+  }
+};
+
 /// \brief An operating system file open in write-only mode.
 class ARROW_EXPORT FileOutputStream : public OutputStream {
  public:
@@ -60,6 +98,28 @@ class ARROW_EXPORT FileOutputStream : public OutputStream {
   /// on Close() or destruction.
   static Result<std::shared_ptr<FileOutputStream>> Open(int fd);
 
+  /// \brief Open a local file for writing, with the given page cache behaviour
+  /// \param[in] path with UTF8 encoding
+  /// \param[in] append append to existing file, otherwise truncate to 0 bytes
+  /// \param[in] options page cache options
+  /// \param[in] pool a MemoryPool for direct I/O buffers
+  /// \return an open FileOutputStream
+  static Result<std::shared_ptr<FileOutputStream>> Open(
+      const std::string& path, bool append, const PageCacheOptions& options,
+      MemoryPool* pool = default_memory_pool());
+
+  /// \brief Open a file descriptor for writing, with the given page cache
+  /// behaviour.  The underlying file isn't truncated.
+  /// \param[in] fd file descriptor
+  /// \param[in] options page cache options
+  /// \param[in] pool a MemoryPool for direct I/O buffers
+  /// \return an open FileOutputStream
+  ///
+  /// The file descriptor becomes owned by the OutputStream, and will be closed
+  /// on Close() or destruction.
+  static Result<std::shared_ptr<FileOutputStream>> Open(
+      int fd, const PageCacheOptions& options, MemoryPool* pool = default_memory_pool());
+
   // OutputStream interface
   Status Close() override;
   bool closed() const override;
@@ -107,6 +167,15 @@ class ARROW_EXPORT ReadableFile
   static Result<std::shared_ptr<ReadableFile>> Open(
       int fd, MemoryPool* pool = default_memory_pool());
 
+  /// \brief Open a local file for reading, with the given page cache behaviour
+  /// \param[in] path with UTF8 encoding
+  /// \param[in] pool a MemoryPool for memory allocations
+  /// \param[in] options page cache options
+  /// \return ReadableFile instance
+  static Result<std::shared_ptr<ReadableFile>> Open(const std::string& path,
+                                                    MemoryPool* pool,
+                                                    const PageCacheOptions& options);
+
   bool closed() const override;
 
   int file_descriptor() const;
@@ -115,6 +184,7 @@ class ARROW_EXPORT ReadableFile
 
  private:
   friend RandomAccessFileConcurrencyWrapper<ReadableFile>;
+  friend class UringReadableFile;
 
   explicit ReadableFile(MemoryPool* pool);
 
@@ -136,6 +206,95 @@ class ARROW_EXPORT ReadableFile
   std::unique_ptr<ReadableFileImpl> impl_;
 };
 
+/// \brief An operating system file open in read-only mode, whose asynchronous
+/// reads are submitted to the kernel through io_uring.
+///
+/// ReadManyAsync() queues one read per range and submits them all with a single
+/// system call, then waits for their completions on one IO thread, instead of
+/// issuing a blocking pread() per range on the IO thread pool.  Synchronous reads
+/// behave as with ReadableFile.
+///
+/// io_uring is only available on Linux.  On other platforms, or if the running
+/// kernel does not allow it, asynchronous reads fall back to those of ReadableFile
+/// (see io_uring_enabled()).  They also do if submitting reads to the kernel
+/// fails, in which case the reads that were not done are read with pread().
+class ARROW_EXPORT UringReadableFile : public ReadableFile {
+ public:
+  ~UringReadableFile() override;
+
+  /// \brief Open a local file for reading
+  /// \param[in] path with UTF8 encoding
+  /// \param[in] pool a MemoryPool for memory allocations
+  /// \return UringReadableFile instance
+  static Result<std::shared_ptr<UringReadableFile>> Open(
+      const std::string& path, MemoryPool* pool = default_memory_pool());
+
+  /// \brief Open a local file for reading
+  /// \param[in] fd file descriptor
+  /// \param[in] pool a MemoryPool for memory allocations
+  /// \return UringReadableFile instance
+  ///
+  /// The file descriptor becomes owned by the UringReadableFile, and will be closed
+  /// on Close() or destruction.
+  static Result<std::shared_ptr<UringReadableFile>> Open(
+      int fd, MemoryPool* pool = default_memory_pool());
+
+  /// \cond FALSE
+  using RandomAccessFile::ReadAsync;
+  using RandomAccessFile::ReadManyAsync;
+  /// \endcond
+
+  Future<std::shared_ptr<Buffer>> ReadAsync(const IOContext&, int64_t position,
+                                            int64_t nbytes) override;
+
+  std::vector<Future<std::shared_ptr<Buffer>>> ReadManyAsync(
+      const IOContext&, const std::vector<ReadRange>& ranges) override;
+
+  /// \brief Whether asynchronous reads go through io_uring
+  ///
+  /// This becomes false if submitting reads to the kernel failed.
+  bool io_uring_enabled() const;
+
+ private:
+  explicit UringReadableFile(MemoryPool* pool);
+
+  Status InitRing();
+
+  class ARROW_NO_EXPORT UringReader;
+  std::shared_ptr<UringReader> reader_;
+};
+
+/// \brief How a MemoryMappedFile maps and pages in the file data
+struct ARROW_EXPORT MemoryMapOptions {
+  /// \brief Fault in the whole mapping when it is created (MAP_POPULATE)
+  ///
+  /// Opening the file then reads all of it, but subsequent reads don't incur
+  /// page faults.  Linux only.
+  bool populate = false;
+
+  /// \brief Back the mapping with transparent huge pages where possible
+  ///
+  /// The mapping is aligned on a huge page boundary and advised with
+  /// MADV_HUGEPAGE, reducing TLB misses when scanning large files.  Whether file
+  /// mappings actually get huge pages depends on the kernel and filesystem.
+  /// Linux only.
+  bool huge_pages = false;
+
+  /// \brief Fault in the ranges passed to WillNeed() in the background
+  ///
+  /// By default, WillNeed() only advises the kernel to read the ranges ahead,
+  /// and each page still faults when first accessed.  With this option, a task
+  /// on the file's IOContext also maps the ranges into the page tables, so that
+  /// readers don't stall on page faults.  A writable file cannot be resized
+  /// while such a task is pending.
+  bool prefault_async = false;
+
+  bool Equals(const MemoryMapOptions& other) const {
+    return populate == other.populate && huge_pages == other.huge_pages &&
+           prefault_async == other.prefault_async;
+  }
+};
+
 /// \brief A file interface that uses memory-mapped files for memory interactions
 ///
 /// This implementation supports zero-copy reads. The same class is used
@@ -161,6 +320,11 @@ class ARROW_EXPORT MemoryMappedFile : public ReadWriteFileInterface {
                                                         const int64_t offset,
                                                         const int64_t length);
 
+  // mmap() with whole file, with the given mapping options
+  static Result<std::shared_ptr<MemoryMappedFile>> Open(const std::string& path,
+                                                        FileMode::type mode,
+                                                        const MemoryMapOptions& options);
+
   Status Close() override;
 
   bool closed() const override;
@@ -15,9 +15,11 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include "arrow/buffer.h"
 #include "arrow/io/buffered.h"
 #include "arrow/io/file.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/util/future.h"
 #include "arrow/util/io_util.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/windows_compatibility.h"
@@ -28,6 +30,7 @@
 #include <atomic>
 #include <cstdlib>
 #include <iostream>
+#include <random>
 #include <thread>
 #include <valarray>
 
@@ -39,6 +42,7 @@
 
 #  include <fcntl.h>
 #  include <poll.h>
+#  include <sys/mman.h>
 #  include <unistd.h>
 
 #endif
@@ -47,6 +51,7 @@ namespace arrow {
 
 using internal::FileDescriptor;
 using internal::Pipe;
+using internal::TemporaryDir;
 
 std::string GetNullFile() {
 #ifdef _WIN32
@@ -295,4 +300,167 @@ BENCHMARK(BufferedOutputStreamSmallWritesToNull)->UseRealTime();
 BENCHMARK(BufferedOutputStreamSmallWritesToPipe)->UseRealTime();
 BENCHMARK(BufferedOutputStreamLargeWritesToPipe)->UseRealTime();
 
+// Benchmark random reads from a local file
+//
+// This compares the default asynchronous reads (a blocking pread() per range
+// on the IO thread pool) with io_uring submissions.  The file is small enough
+// to stay in the page cache, so this measures the per-read overhead rather
+// than the device.
+
+constexpr int64_t kBenchmarkFileSize = 64 * 1024 * 1024;
+constexpr int64_t kRandomReadSize = 4096;
+
+// A temporary file of kBenchmarkFileSize bytes
+class BenchmarkFile {
+ public:
+  BenchmarkFile() {
+    temp_dir_ = *TemporaryDir::Make("file-benchmark-");
+    path_ = temp_dir_->path().ToString() + "data.bin";
+    auto stream = *io::FileOutputStream::Open(path_);
+    const std::string chunk(1024 * 1024, 'x');
+    for (int64_t i = 0; i < kBenchmarkFileSize; i += chunk.size()) {
+      ABORT_NOT_OK(stream->Write(chunk));
+    }
+    ABORT_NOT_OK(stream->Close());
+  }
+
+  const std::string& path() const { return path_; }
+
+  // Random, read-size-aligned ranges
+  std::vector<io::ReadRange> MakeRanges(int64_t num_ranges) {
+    std::uniform_int_distribution<int64_t> dist(
+        0, kBenchmarkFileSize / kRandomReadSize - 1);
+    std::vector<io::ReadRange> ranges(num_ranges);
+    for (auto& range : ranges) {
+      range = {dist(rng_) * kRandomReadSize, kRandomReadSize};
+    }
+    return ranges;
+  }
+
+ private:
+  std::unique_ptr<TemporaryDir> temp_dir_;
+  std::string path_;
+  std::default_random_engine rng_{42};
+};
+
+// Throughput of batches of reads issued through ReadManyAsync (reads per second)
+template <typename FileType>
+static void RandomReadMany(benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t batch_size = state.range(0);
+  BenchmarkFile fixture;
+  auto file = *FileType::Open(fixture.path());
+  const auto ranges = fixture.MakeRanges(batch_size);
+
+  for (auto _ : state) {
+    for (auto& future : file->ReadManyAsync(ranges)) {
+      ABORT_NOT_OK(future.status());
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * batch_size);
+  state.SetBytesProcessed(state.iterations() * batch_size * kRandomReadSize);
+}
+
+// Latency of single reads issued through ReadAsync
+template <typename FileType>
+static void RandomReadAsync(benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkFile fixture;
+  auto file = *FileType::Open(fixture.path());
+  const auto ranges = fixture.MakeRanges(1024);
+
+  size_t i = 0;
+  for (auto _ : state) {
+    const auto& range = ranges[i++ % ranges.size()];
+    ABORT_NOT_OK(file->ReadAsync(range.offset, range.length).status());
+  }
+  state.SetItemsProcessed(state.iterations());
+  state.SetBytesProcessed(state.iterations() * kRandomReadSize);
+}
+
+BENCHMARK_TEMPLATE(RandomReadMany, io::ReadableFile)
+    ->RangeMultiplier(8)
+    ->Range(1, 512)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(RandomReadMany, io::UringReadableFile)
+    ->RangeMultiplier(8)
+    ->Range(1, 512)
+    ->UseRealTime();
+
+BENCHMARK_TEMPLATE(RandomReadAsync, io::ReadableFile)->UseRealTime();
+BENCHMARK_TEMPLATE(RandomReadAsync, io::UringReadableFile)->UseRealTime();
+
+// Benchmark sequential scans of a local file with different page cache options
+//
+// Each scan starts with the file evicted from the page cache.  Besides the
+// throughput, the "resident" counter reports the fraction of the file left in
+// the page cache by the scan, i.e. the cache pressure it puts on other processes
+// (Linux only).
+
+#ifndef _WIN32
+
+static void EvictFromPageCache(const std::string& path) {
+  auto fd = *internal::FileOpenReadable(*internal::PlatformFilename::FromString(path));
+#  ifdef POSIX_FADV_DONTNEED
+  ARROW_CHECK_EQ(posix_fadvise(fd.fd(), 0, 0, POSIX_FADV_DONTNEED), 0);
+#  endif
+}
+
+#  ifdef __linux__
+static double PageCacheResidency(const std::string& path) {
+  auto fd = *internal::FileOpenReadable(*internal::PlatformFilename::FromString(path));
+  const int64_t size = *internal::FileGetSize(fd.fd());
+  const int64_t page_size = sysconf(_SC_PAGESIZE);
+  // Mapping the file doesn't fault it in
+  void* addr = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd.fd(), 0);
+  ARROW_CHECK_NE(addr, MAP_FAILED);
+  std::vector<unsigned char> pages((size + page_size - 1) / page_size);
+  ARROW_CHECK_EQ(mincore(addr, size, pages.data()), 0);
+  ARROW_CHECK_EQ(munmap(addr, size), 0);
+  const auto resident = std::count_if(pages.begin(), pages.end(),
+                                      [](unsigned char page) { return page & 1; });
+  return static_cast<double>(resident) / static_cast<double>(pages.size());
+}
+#  endif
+
+static void SequentialScan(benchmark::State& state,  // NOLINT non-const reference
+                           io::PageCacheOptions options) {
+  constexpr int64_t kChunkSize = 1 << 20;
+  BenchmarkFile fixture;
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    EvictFromPageCache(fixture.path());
+    state.ResumeTiming();
+
+    auto file = *io::ReadableFile::Open(fixture.path(), default_memory_pool(), options);
+    while ((*file->Read(kChunkSize))->size() > 0) {
+    }
+    ABORT_NOT_OK(file->Close());
+  }
+  state.SetBytesProcessed(state.iterations() * kBenchmarkFileSize);
+#  ifdef __linux__
+  state.counters["resident"] = PageCacheResidency(fixture.path());
+#  endif
+}
+
+static io::PageCacheOptions BufferedScan() { return {}; }
+
+static io::PageCacheOptions DropAfterScan() {
+  io::PageCacheOptions options;
+  options.sequential_access = true;
+  options.drop_after_access = true;
+  return options;
+}
+
+static io::PageCacheOptions DirectScan() {
+  io::PageCacheOptions options;
+  options.direct_io = true;
+  return options;
+}
+
+BENCHMARK_CAPTURE(SequentialScan, buffered, BufferedScan())->UseRealTime();
+BENCHMARK_CAPTURE(SequentialScan, drop_after_access, DropAfterScan())->UseRealTime();
+BENCHMARK_CAPTURE(SequentialScan, direct_io, DirectScan())->UseRealTime();
+
+#endif
+
 }  // namespace arrow
@@ -20,7 +20,9 @@
 #  include <unistd.h>
 #endif
 
+#include <algorithm>
 #include <atomic>
+#include <cerrno>
 #include <cstdint>
 #include <cstdio>
 #include <cstdlib>
@@ -38,16 +40,19 @@
 #include "arrow/io/interfaces.h"
 #include "arrow/io/stdio.h"
 #include "arrow/io/test_common.h"
+#include "arrow/io/uring_internal.h"
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
+#include "arrow/util/checked_cast.h"
 #include "arrow/util/config.h"
 #include "arrow/util/future.h"
 #include "arrow/util/io_util.h"
 
 namespace arrow {
 
+using internal::checked_cast;
 using internal::CreatePipe;
 using internal::FileClose;
 using internal::FileDescriptor;
@@ -56,6 +61,7 @@ using internal::FileOpenReadable;
 using internal::FileOpenWritable;
 using internal::FileRead;
 using internal::FileSeek;
+using internal::FileWrite;
 using internal::PlatformFilename;
 using internal::TemporaryDir;
 
@@ -523,6 +529,350 @@ TEST_F(TestReadableFile, ThreadSafety) {
   ASSERT_EQ(niter * 2, correct_count);
 }
 
+// ----------------------------------------------------------------------
+// Page cache options tests
+
+PageCacheOptions MakePageCacheOptions(bool direct_io, bool sequential_access,
+                                      bool drop_after_access) {
+  PageCacheOptions options;
+  options.direct_io = direct_io;
+  options.sequential_access = sequential_access;
+  options.drop_after_access = drop_after_access;
+  return options;
+}
+
+class TestPageCacheOptions : public FileTestFixture,
+                             public ::testing::WithParamInterface<PageCacheOptions> {
+ public:
+  std::string MakeData(int64_t size) {
+    std::string data(size, '\0');
+    for (int64_t i = 0; i < size; ++i) {
+      data[i] = static_cast<char>((i * 31) % 251);
+    }
+    return data;
+  }
+};
+
+TEST_P(TestPageCacheOptions, WriteRead) {
+  // Not a multiple of the direct I/O alignment nor of the staging buffer size
+  const std::string data = MakeData((3 << 20) + 12345);
+  {
+    ASSERT_OK_AND_ASSIGN(auto stream, FileOutputStream::Open(path_, /*append=*/false,
+                                                             GetParam()));
+    int64_t position = 0;
+    for (int64_t chunk_size : {1, 4095, 4096, 100000, 1 << 20}) {
+      ASSERT_OK(stream->Write(data.data() + position, chunk_size));
+      position += chunk_size;
+      ASSERT_OK_AND_EQ(position, stream->Tell());
+    }
+    ASSERT_OK(stream->Write(data.data() + position, data.size() - position));
+    ASSERT_OK(stream->Close());
+  }
+
+  ASSERT_OK_AND_ASSIGN(auto file,
+                       ReadableFile::Open(path_, default_memory_pool(), GetParam()));
+  ASSERT_OK_AND_EQ(static_cast<int64_t>(data.size()), file->GetSize());
+
+  // Sequential reads
+  std::string contents;
+  while (true) {
+    ASSERT_OK_AND_ASSIGN(auto buffer, file->Read(7777));
+    if (buffer->size() == 0) break;
+    contents += buffer->ToString();
+  }
+  ASSERT_EQ(contents, data);
+  ASSERT_OK(file->Seek(5000));
+  uint8_t out[100];
+  ASSERT_OK_AND_EQ(100, file->Read(100, out));
+  ASSERT_EQ(0, std::memcmp(out, data.data() + 5000, 100));
+  ASSERT_OK_AND_EQ(5100, file->Tell());
+
+  // Positional reads, aligned or not, including past the end of the file
+  const int64_t size = static_cast<int64_t>(data.size());
+  for (int64_t position : {int64_t(0), int64_t(1), int64_t(4096), int64_t(12345),
+                           size - 10, size, size + 5000}) {
+    for (int64_t length : {0, 1, 4096, 10000}) {
+      ARROW_SCOPED_TRACE("position = ", position, ", length = ", length);
+      const std::string expected = position < size ? data.substr(position, length) : "";
+      ASSERT_OK_AND_ASSIGN(auto buffer, file->ReadAt(position, length));
+      AssertBufferEqual(*buffer, expected);
+      const auto expected_prefix = expected.substr(0, 100);
+      ASSERT_OK_AND_EQ(static_cast<int64_t>(expected_prefix.size()),
+                       file->ReadAt(position, std::min<int64_t>(length, 100), out));
+      ASSERT_EQ(0, std::memcmp(out, expected_prefix.data(), expected_prefix.size()));
+    }
+  }
+
+  auto fut = file->ReadAsync({}, 3, 5000);
+  ASSERT_OK_AND_ASSIGN(auto buffer, fut.result());
+  AssertBufferEqual(*buffer, data.substr(3, 5000));
+}
+
+TEST_P(TestPageCacheOptions, Append) {
+  {
+    ASSERT_OK_AND_ASSIGN(auto stream, FileOutputStream::Open(path_));
+    ASSERT_OK(stream->Write("abc"));
+    ASSERT_OK(stream->Close());
+  }
+  {
+    ASSERT_OK_AND_ASSIGN(auto stream,
+                         FileOutputStream::Open(path_, /*append=*/true, GetParam()));
+    ASSERT_OK(stream->Write("defg"));
+    ASSERT_OK(stream->Close());
+  }
+  ASSERT_OK_AND_ASSIGN(auto file,
+                       ReadableFile::Open(path_, default_memory_pool(), GetParam()));
+  ASSERT_OK_AND_ASSIGN(auto buffer, file->ReadAt(0, 100));
+  AssertBufferEqual(*buffer, "abcdefg");
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    PageCacheOptions, TestPageCacheOptions,
+    ::testing::Values(MakePageCacheOptions(false, false, false),
+                      MakePageCacheOptions(true, false, false),
+                      MakePageCacheOptions(false, true, true),
+                      MakePageCacheOptions(true, true, true)));
+
+// ----------------------------------------------------------------------
+// io_uring file input tests
+
+class TestUringReadableFile : public TestReadableFile {
+ public:
+  void TearDown() override {
+    internal::IoUring::InjectEnterFailureForTesting(0);
+    TestReadableFile::TearDown();
+  }
+
+  void OpenUringFile() { ASSERT_OK_AND_ASSIGN(file_, UringReadableFile::Open(path_)); }
+
+  bool io_uring_enabled() const {
+    return checked_cast<const UringReadableFile&>(*file_).io_uring_enabled();
+  }
+
+  // Write a file larger than what a ring reads at once, returning its contents
+  std::string MakeLargeTestFile() {
+    std::string data;
+    for (int i = 0; i < 1000; ++i) {
+      data += std::to_string(i % 10);
+    }
+    std::ofstream stream;
+    stream.open(path_.c_str());
+    stream << data;
+    return data;
+  }
+};
+
+TEST_F(TestUringReadableFile, ReadAsync) {
+  MakeTestFile();
+  OpenUringFile();
+
+  auto fut1 = file_->ReadAsync({}, 1, 10);
+  auto fut2 = file_->ReadAsync({}, 0, 4);
+  ASSERT_OK_AND_ASSIGN(auto buf1, fut1.result());
+  ASSERT_OK_AND_ASSIGN(auto buf2, fut2.result());
+  AssertBufferEqual(*buf1, "estdata");
+  AssertBufferEqual(*buf2, "test");
+}
+
+TEST_F(TestUringReadableFile, ReadManyAsync) {
+  MakeTestFile();
+  OpenUringFile();
+
+  std::vector<ReadRange> ranges = {{1, 3}, {2, 5}, {4, 2}, {6, 0}, {6, 10}, {20, 4}};
+  auto futs = file_->ReadManyAsync(std::move(ranges));
+
+  ASSERT_EQ(futs.size(), 6);
+  ASSERT_OK_AND_ASSIGN(auto buf1, futs[0].result());
+  ASSERT_OK_AND_ASSIGN(auto buf2, futs[1].result());
+  ASSERT_OK_AND_ASSIGN(auto buf3, futs[2].result());
+  ASSERT_OK_AND_ASSIGN(auto buf4, futs[3].result());
+  ASSERT_OK_AND_ASSIGN(auto buf5, futs[4].result());
+  ASSERT_OK_AND_ASSIGN(auto buf6, futs[5].result());
+  AssertBufferEqual(*buf1, "est");
+  AssertBufferEqual(*buf2, "stdat");
+  AssertBufferEqual(*buf3, "da");
+  AssertBufferEqual(*buf4, "");
+  AssertBufferEqual(*buf5, "ta");
+  AssertBufferEqual(*buf6, "");
+}
+
+TEST_F(TestUringReadableFile, ManyReads) {
+  // More reads than can be in flight at once
+  const auto data = MakeLargeTestFile();
+  OpenUringFile();
+
+  std::vector<ReadRange> ranges;
+  for (int64_t i = 0; i < 500; ++i) {
+    ranges.push_back({i * 2, 3});
+  }
+  auto futs = file_->ReadManyAsync(ranges);
+  ASSERT_EQ(futs.size(), ranges.size());
+  for (size_t i = 0; i < futs.size(); ++i) {
+    ASSERT_OK_AND_ASSIGN(auto buf, futs[i].result());
+    const auto expected_length = std::min<int64_t>(3, 1000 - ranges[i].offset);
+    AssertBufferEqual(*buf, data.substr(ranges[i].offset, expected_length));
+  }
+}
+
+TEST_F(TestUringReadableFile, RingEnterFailure) {
+  const auto data = MakeLargeTestFile();
+  OpenFile();
+  auto maybe_ring = internal::IoUring::Make(file_->file_descriptor(), /*entries=*/8);
+  if (!maybe_ring.ok()) {
+    GTEST_SKIP() << "io_uring not available: " << maybe_ring.status().ToString();
+  }
+  auto ring = maybe_ring.MoveValueUnsafe();
+
+  std::vector<ReadRange> ranges;
+  for (int64_t i = 0; i < 100; ++i) {
+    ranges.push_back({i * 10, 10});
+  }
+  std::vector<std::string> buffers(ranges.size(), std::string(10, '\0'));
+  std::vector<uint8_t*> out;
+  for (auto& buffer : buffers) {
+    out.push_back(reinterpret_cast<uint8_t*>(&buffer[0]));
+  }
+  std::vector<int> num_done(ranges.size(), 0);
+  int num_failed = 0;
+  auto on_done = [&](size_t i, Result<int64_t> bytes_read) {
+    ++num_done[i];
+    if (bytes_read.ok()) {
+      ASSERT_EQ(*bytes_read, 10);
+      ASSERT_EQ(buffers[i], data.substr(i * 10, 10));
+    } else {
+      ++num_failed;
+    }
+  };
+
+  // Fail after reads were submitted; the remaining ones fail with the ring,
+  // and each range is reported once
+  internal::IoUring::InjectEnterFailureForTesting(EIO, /*num_calls=*/2);
+  ASSERT_RAISES(IOError, ring->ReadMany(ranges, out, on_done));
+  ASSERT_TRUE(ring->failed());
+  ASSERT_GT(num_failed, 0);
+  ASSERT_LT(num_failed, static_cast<int>(ranges.size()));
+  for (int n : num_done) {
+    ASSERT_EQ(n, 1);
+  }
+
+  // A failed ring is not used anymore
+  num_failed = 0;
+  std::fill(num_done.begin(), num_done.end(), 0);
+  ASSERT_RAISES(IOError, ring->ReadMany(ranges, out, on_done));
+  ASSERT_EQ(num_failed, static_cast<int>(ranges.size()));
+  for (int n : num_done) {
+    ASSERT_EQ(n, 1);
+  }
+}
+
+TEST_F(TestUringReadableFile, RingEnterFailureWithReadsInFlight) {
+  // Reads from an empty pipe stay in flight until they are cancelled
+  ASSERT_OK_AND_ASSIGN(auto pipe, CreatePipe());
+  auto maybe_ring = internal::IoUring::Make(pipe.rfd.fd(), /*entries=*/8);
+  if (!maybe_ring.ok()) {
+    GTEST_SKIP() << "io_uring not available: " << maybe_ring.status().ToString();
+  }
+  auto ring = maybe_ring.MoveValueUnsafe();
+  ASSERT_OK(FileWrite(pipe.wfd.fd(), reinterpret_cast<const uint8_t*>("data"), 4));
+
+  std::vector<ReadRange> ranges(20, {0, 4});
+  std::vector<std::string> buffers(ranges.size(), std::string(4, '\0'));
+  std::vector<uint8_t*> out;
+  for (auto& buffer : buffers) {
+    out.push_back(reinterpret_cast<uint8_t*>(&buffer[0]));
+  }
+  std::vector<int> num_done(ranges.size(), 0);
+  int num_read = 0;
+  auto on_done = [&](size_t i, Result<int64_t> bytes_read) {
+    ++num_done[i];
+    if (bytes_read.ok()) {
+      ++num_read;
+      ASSERT_EQ(buffers[i], "data");
+    }
+  };
+
+  // The first call submits a batch of reads, one of which completes; the others
+  // are cancelled when the second call fails
+  internal::IoUring::InjectEnterFailureForTesting(EIO, /*num_calls=*/1);
+  ASSERT_RAISES(IOError, ring->ReadMany(ranges, out, on_done));
+  ASSERT_TRUE(ring->failed());
+  ASSERT_EQ(num_read, 1);
+  for (int n : num_done) {
+    ASSERT_EQ(n, 1);
+  }
+  ASSERT_OK(pipe.Close());
+}
+
+TEST_F(TestUringReadableFile, FallbackOnRingFailure) {
+  const auto data = MakeLargeTestFile();
+  OpenUringFile();
+  if (!io_uring_enabled()) {
+    GTEST_SKIP() << "io_uring not available";
+  }
+
+  std::vector<ReadRange> ranges;
+  for (int64_t i = 0; i < 500; ++i) {
+    ranges.push_back({i * 2, 3});
+  }
+  auto check_reads = [&]() {
+    auto futs = file_->ReadManyAsync(ranges);
+    ASSERT_EQ(futs.size(), ranges.size());
+    for (size_t i = 0; i < futs.size(); ++i) {
+      ASSERT_OK_AND_ASSIGN(auto buf, futs[i].result());
+      const auto expected_length = std::min<int64_t>(3, 1000 - ranges[i].offset);
+      AssertBufferEqual(*buf, data.substr(ranges[i].offset, expected_length));
+    }
+  };
+
+  // The reads the ring didn't do are done with pread()
+  internal::IoUring::InjectEnterFailureForTesting(EIO, /*num_calls=*/2);
+  check_reads();
+  ASSERT_FALSE(io_uring_enabled());
+
+  // Later reads don't go through the ring anymore
+  check_reads();
+  ASSERT_FALSE(io_uring_enabled());
+}
+
+TEST_F(TestUringReadableFile, InvalidReads) {
+  MakeTestFile();
+  OpenUringFile();
+
+  ASSERT_RAISES(Invalid, file_->ReadAsync({}, -1, 1).result());
+  auto futs = file_->ReadManyAsync({{0, 1}, {1, -1}});
+  ASSERT_RAISES(Invalid, futs[0].result());
+  ASSERT_RAISES(Invalid, futs[1].result());
+
+  ASSERT_OK(file_->Close());
+  ASSERT_RAISES(Invalid, file_->ReadAsync({}, 0, 1).result());
+}
+
+TEST_F(TestUringReadableFile, SynchronousReads) {
+  MakeTestFile();
+  OpenUringFile();
+
+  ASSERT_OK_AND_ASSIGN(auto buffer, file_->ReadAt(1, 3));
+  AssertBufferEqual(*buffer, "est");
+  ASSERT_OK(file_->Seek(4));
+  ASSERT_OK_AND_ASSIGN(buffer, file_->Read(10));
+  AssertBufferEqual(*buffer, "data");
+}
+
+TEST_F(TestUringReadableFile, CustomMemoryPool) {
+  MakeTestFile();
+
+  MyMemoryPool pool;
+  ASSERT_OK_AND_ASSIGN(file_, UringReadableFile::Open(path_, &pool));
+
+  auto futs = file_->ReadManyAsync({{0, 4}, {4, 8}});
+  ASSERT_OK_AND_ASSIGN(auto buf1, futs[0].result());
+  ASSERT_OK_AND_ASSIGN(auto buf2, futs[1].result());
+  AssertBufferEqual(*buf1, "test");
+  AssertBufferEqual(*buf2, "data");
+
+  ASSERT_EQ(2, pool.num_allocations());
+}
+
 // ----------------------------------------------------------------------
 // Pipe I/O tests using FileOutputStream
 // (cannot test using ReadableFile as it currently requires seeking)
@@ -716,6 +1066,41 @@ TEST_F(TestMemoryMappedFile, WillNeed) {
   ASSERT_RAISES(IOError, mmap->WillNeed({{1025, 1}}));  // Out of bounds
 }
 
+TEST_F(TestMemoryMappedFile, MemoryMapOptions) {
+  // Large enough for a huge page-aligned mapping
+  const int64_t buffer_size = 3 * 1024 * 1024 + 100;
+  std::vector<uint8_t> buffer(buffer_size);
+  random_bytes(buffer_size, 0, buffer.data());
+
+  std::string path = TempFile("io-memory-map-options-test");
+  {
+    ASSERT_OK_AND_ASSIGN(auto mmap, InitMemoryMap(buffer_size, path));
+    ASSERT_OK(mmap->Write(buffer.data(), buffer_size));
+    ASSERT_OK(mmap->Close());
+  }
+
+  for (int flags = 0; flags < 8; ++flags) {
+    MemoryMapOptions options;
+    options.populate = flags & 1;
+    options.huge_pages = flags & 2;
+    options.prefault_async = flags & 4;
+    ARROW_SCOPED_TRACE("flags = ", flags);
+
+    for (auto mode : {FileMode::READ, FileMode::READWRITE}) {
+      ASSERT_OK_AND_ASSIGN(auto mmap, MemoryMappedFile::Open(path, mode, options));
+      ASSERT_OK_AND_EQ(buffer_size, mmap->GetSize());
+      ASSERT_OK(mmap->WillNeed({{0, 4}, {100, 2 * 1024 * 1024}, {buffer_size, 0}}));
+      ASSERT_RAISES(IOError, mmap->WillNeed({{buffer_size + 1, 1}}));
+
+      ASSERT_OK_AND_ASSIGN(auto out, mmap->ReadAt(0, buffer_size));
+      ASSERT_EQ(0, std::memcmp(out->data(), buffer.data(), buffer_size));
+      ASSERT_OK_AND_ASSIGN(out, mmap->ReadAt(buffer_size - 10, 20));
+      ASSERT_EQ(0, std::memcmp(out->data(), buffer.data() + buffer_size - 10, 10));
+      ASSERT_OK(mmap->Close());
+    }
+  }
+}
+
 TEST_F(TestMemoryMappedFile, InvalidReads) {
   std::string path = TempFile("io-memory-map-invalid-reads-test");
   ASSERT_OK_AND_ASSIGN(auto result, InitMemoryMap(4096, path));
@@ -17,10 +17,18 @@
 
 #include <iostream>
 
+#ifndef _WIN32
+#  include <fcntl.h>
+#endif
+
+#include "arrow/buffer.h"
+#include "arrow/io/file.h"
 #include "arrow/io/memory.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
 #include "arrow/util/cpu_info.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/logging.h"
 #include "arrow/util/simd.h"
 
 #include "benchmark/benchmark.h"
@@ -358,4 +366,100 @@ BENCHMARK(BufferOutputStreamTinyWrites)->UseRealTime();
 BENCHMARK(BufferOutputStreamSmallWrites)->UseRealTime();
 BENCHMARK(BufferOutputStreamLargeWrites)->UseRealTime();
 
+// Benchmark first (cold) and repeated (warm) scans of a memory-mapped file
+//
+// A cold scan starts with the file evicted from the page cache, so that it
+// measures the cost of page faults and disk reads; a warm scan only pays for
+// mapping the pages.  Each scan opens the file, so that MAP_POPULATE is
+// accounted for.
+
+#ifndef _WIN32
+
+constexpr int64_t kMemoryMapFileSize = 256 * 1024 * 1024;
+constexpr int64_t kMemoryMapChunkSize = 4 * 1024 * 1024;
+
+static std::string MakeMemoryMapFile(internal::TemporaryDir* temp_dir) {
+  const std::string path = temp_dir->path().ToString() + "mmap.bin";
+  auto stream = *io::FileOutputStream::Open(path);
+  const std::string chunk(kMemoryMapChunkSize, 'x');
+  for (int64_t i = 0; i < kMemoryMapFileSize; i += kMemoryMapChunkSize) {
+    ABORT_NOT_OK(stream->Write(chunk));
+  }
+  ABORT_NOT_OK(stream->Close());
+  return path;
+}
+
+static void MemoryMappedFileScan(benchmark::State& state,  // NOLINT non-const reference
+                                 io::MemoryMapOptions options, bool cold) {
+  auto temp_dir = *internal::TemporaryDir::Make("memory-benchmark-");
+  const std::string path = MakeMemoryMapFile(temp_dir.get());
+
+  uint64_t total = 0;
+  for (auto _ : state) {
+    if (cold) {
+      state.PauseTiming();
+      auto fd =
+          *internal::FileOpenReadable(*internal::PlatformFilename::FromString(path));
+#  ifdef POSIX_FADV_DONTNEED
+      ARROW_CHECK_EQ(posix_fadvise(fd.fd(), 0, 0, POSIX_FADV_DONTNEED), 0);
+#  endif
+      state.ResumeTiming();
+    }
+
+    auto file = *io::MemoryMappedFile::Open(path, io::FileMode::READ, options);
+    for (int64_t offset = 0; offset < kMemoryMapFileSize;
+         offset += kMemoryMapChunkSize) {
+      // Let the file prepare the next chunk while this one is scanned
+      ABORT_NOT_OK(file->WillNeed({{offset + kMemoryMapChunkSize, kMemoryMapChunkSize}}));
+      auto chunk = *file->ReadAt(offset, kMemoryMapChunkSize);
+      const auto* words = chunk->data_as<uint64_t>();
+      for (int64_t i = 0; i < chunk->size() / 8; ++i) {
+        total += words[i];
+      }
+    }
+    ABORT_NOT_OK(file->Close());
+  }
+  benchmark::DoNotOptimize(total);
+  state.SetBytesProcessed(int64_t(state.iterations()) * kMemoryMapFileSize);
+}
+
+static io::MemoryMapOptions DefaultMapping() { return {}; }
+
+static io::MemoryMapOptions PopulatedMapping() {
+  io::MemoryMapOptions options;
+  options.populate = true;
+  return options;
+}
+
+static io::MemoryMapOptions HugePageMapping() {
+  io::MemoryMapOptions options;
+  options.huge_pages = true;
+  return options;
+}
+
+static io::MemoryMapOptions PrefaultedMapping() {
+  io::MemoryMapOptions options;
+  options.prefault_async = true;
+  return options;
+}
+
+BENCHMARK_CAPTURE(MemoryMappedFileScan, cold_default, DefaultMapping(), true)
+    ->UseRealTime();
+BENCHMARK_CAPTURE(MemoryMappedFileScan, cold_populate, PopulatedMapping(), true)
+    ->UseRealTime();
+BENCHMARK_CAPTURE(MemoryMappedFileScan, cold_huge_pages, HugePageMapping(), true)
+    ->UseRealTime();
+BENCHMARK_CAPTURE(MemoryMappedFileScan, cold_prefault_async, PrefaultedMapping(), true)
+    ->UseRealTime();
+BENCHMARK_CAPTURE(MemoryMappedFileScan, warm_default, DefaultMapping(), false)
+    ->UseRealTime();
+BENCHMARK_CAPTURE(MemoryMappedFileScan, warm_populate, PopulatedMapping(), false)
+    ->UseRealTime();
+BENCHMARK_CAPTURE(MemoryMappedFileScan, warm_huge_pages, HugePageMapping(), false)
+    ->UseRealTime();
+BENCHMARK_CAPTURE(MemoryMappedFileScan, warm_prefault_async, PrefaultedMapping(), false)
+    ->UseRealTime();
+
+#endif
+
 }  // namespace arrow
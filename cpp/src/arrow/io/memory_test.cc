@@ -943,6 +943,110 @@ TEST(CacheOptions, Basics) {
   check(CacheOptions::MakeFromNetworkMetrics(5, 500, .75, 5), 2.5, 5);
 }
 
+// Record reads following `duration = ttfb + size / bandwidth`
+void RecordReads(ReadMetricsEstimator* metrics, double ttfb_millis,
+                 double bandwidth_mib_per_sec, int num_reads) {
+  for (int i = 0; i < num_reads; ++i) {
+    const int64_t nbytes = (i % 8 + 1) * 1024 * 1024;
+    metrics->Record(nbytes,
+                    ttfb_millis / 1000 + nbytes / (bandwidth_mib_per_sec * 1024 * 1024));
+  }
+}
+
+TEST(ReadMetricsEstimator, Basics) {
+  ReadMetricsEstimator metrics;
+  ASSERT_FALSE(metrics.ready());
+  ASSERT_EQ(metrics.bandwidth(), 0);
+  // Not tuned yet
+  auto options = CacheOptions::LazyDefaults();
+  ASSERT_EQ(metrics.Tune(options), options);
+
+  // TTFB = 5 ms, BW = 500 MiB/s
+  RecordReads(&metrics, 5, 500, 16);
+  ASSERT_EQ(metrics.num_samples(), 16);
+  ASSERT_TRUE(metrics.ready());
+  ASSERT_NEAR(metrics.time_to_first_byte(), 0.005, 1e-6);
+  ASSERT_NEAR(metrics.bandwidth(), 500 * 1024 * 1024, 1e3);
+
+  // Same limits as CacheOptions::MakeFromNetworkMetrics, other options are kept
+  const auto expected = CacheOptions::MakeFromNetworkMetrics(5, 500);
+  const auto tuned = metrics.Tune(options);
+  ASSERT_NEAR(tuned.hole_size_limit, expected.hole_size_limit, 10);
+  ASSERT_NEAR(tuned.range_size_limit, expected.range_size_limit, 100);
+  ASSERT_TRUE(tuned.lazy);
+}
+
+TEST(ReadMetricsEstimator, NotReady) {
+  // Too few reads
+  ReadMetricsEstimator metrics;
+  RecordReads(&metrics, 5, 500, 4);
+  ASSERT_FALSE(metrics.ready());
+
+  // Reads of the same size can't tell latency from bandwidth
+  ReadMetricsEstimator same_size_metrics;
+  for (int i = 0; i < 16; ++i) {
+    same_size_metrics.Record(1024 * 1024, 0.01);
+  }
+  ASSERT_FALSE(same_size_metrics.ready());
+  ASSERT_EQ(same_size_metrics.Tune(CacheOptions::Defaults()), CacheOptions::Defaults());
+}
+
+TEST(ReadMetricsEstimator, Adapts) {
+  ReadMetricsEstimator metrics;
+  RecordReads(&metrics, 5, 500, 16);
+  const auto before = metrics.Tune(CacheOptions::Defaults());
+
+  // Latency increases tenfold: older reads are gradually forgotten
+  RecordReads(&metrics, 50, 500, 200);
+  ASSERT_NEAR(metrics.time_to_first_byte(), 0.05, 1e-3);
+  const auto after = metrics.Tune(CacheOptions::Defaults());
+  ASSERT_GT(after.hole_size_limit, before.hole_size_limit);
+  ASSERT_GE(after.range_size_limit, before.range_size_limit);
+  ASSERT_LT(after.hole_size_limit, after.range_size_limit);
+
+  // Tiny request sizes are avoided
+  ReadMetricsEstimator fast_metrics;
+  RecordReads(&fast_metrics, 0.0001, 10000, 16);
+  ASSERT_EQ(fast_metrics.Tune(CacheOptions::Defaults()).range_size_limit,
+            ReadMetricsEstimator::kMinRangeSizeLimit);
+}
+
+TEST(RangeReadCache, AdaptiveCoalescing) {
+  const int64_t file_size = 8 * 1024 * 1024;
+  std::string data(file_size, '\0');
+  random_bytes(file_size, /*seed=*/42, reinterpret_cast<uint8_t*>(&data[0]));
+  auto file = std::make_shared<BufferReader>(std::make_shared<Buffer>(data));
+
+  for (auto lazy : std::vector<bool>{false, true}) {
+    SCOPED_TRACE(lazy);
+    // TTFB = 1 ms, BW = 100 MiB/s: hole_size_limit = 100 KiB,
+    // range_size_limit = 900 KiB
+    auto metrics = std::make_shared<ReadMetricsEstimator>();
+    RecordReads(metrics.get(), 1, 100, 16);
+    CacheOptions options = lazy ? CacheOptions::LazyDefaults() : CacheOptions::Defaults();
+    // Not coalesced without metrics
+    options.hole_size_limit = 1;
+    options.range_size_limit = 2;
+    options.metrics = metrics;
+    internal::ReadRangeCache cache(file, {}, options);
+
+    const ReadRange small1{0, 1000}, small2{50000, 1000}, large{1 << 20, 3 << 20};
+    ASSERT_OK(cache.Cache({small1, small2, large}));
+    for (const auto& range : {small1, small2, large}) {
+      ASSERT_OK_AND_ASSIGN(auto buf, cache.Read(range));
+      AssertBufferEqual(*buf, std::string_view(data).substr(range.offset, range.length));
+    }
+    ASSERT_FINISHES_OK(cache.Wait());
+    // The small ranges were read at once, the large one in up to one part
+    // per I/O thread
+    const int64_t num_reads = metrics->num_samples() - 16;
+    if (GetIOThreadPoolCapacity() > 1) {
+      ASSERT_GE(num_reads, 3);
+    }
+    ASSERT_LE(num_reads, 1 + GetIOThreadPoolCapacity());
+  }
+}
+
 TEST(IOThreadPool, Capacity) {
 #ifndef ARROW_ENABLE_THREADING
   GTEST_SKIP() << "Test requires threading enabled";
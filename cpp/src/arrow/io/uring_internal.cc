@@ -0,0 +1,463 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/io/uring_internal.h"
+
+#if defined(__linux__) && defined(__has_include)
+#  if __has_include(<linux/io_uring.h>)
+#    define ARROW_HAVE_IO_URING
+#  endif
+#endif
+
+#ifdef ARROW_HAVE_IO_URING
+#  include <linux/io_uring.h>
+#  include <sys/mman.h>
+#  include <sys/syscall.h>
+#  include <sys/uio.h>
+#  include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <deque>
+#include <thread>
+
+#include "arrow/util/io_util.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+
+using ::arrow::internal::IOErrorFromErrno;
+
+namespace io {
+namespace internal {
+
+#ifdef ARROW_HAVE_IO_URING
+
+namespace {
+
+// Larger reads are split, as the kernel caps the size of a single read anyway
+constexpr int64_t kMaxReadSize = int64_t(1) << 30;
+
+// user_data of cancellation requests, which can't be a read index
+constexpr uint64_t kCancelUserData = ~uint64_t(0);
+
+int SysSetup(uint32_t entries, io_uring_params* params) {
+  return static_cast<int>(syscall(__NR_io_uring_setup, entries, params));
+}
+
+int SysEnter(int ring_fd, uint32_t to_submit, uint32_t min_complete, uint32_t flags) {
+  return static_cast<int>(syscall(__NR_io_uring_enter, ring_fd, to_submit,
+                                  min_complete, flags, nullptr, 0));
+}
+
+// The io_uring_enter call, replaced by tests to inject failures
+// (see IoUring::InjectEnterFailureForTesting)
+using EnterFunction = int (*)(int, uint32_t, uint32_t, uint32_t);
+std::atomic<EnterFunction> enter_function{&SysEnter};
+
+std::atomic<int> injected_enter_error{0};
+std::atomic<int> calls_before_injected_error{0};
+
+int FailingSysEnter(int ring_fd, uint32_t to_submit, uint32_t min_complete,
+                    uint32_t flags) {
+  if (calls_before_injected_error.fetch_sub(1) == 0) {
+    enter_function.store(&SysEnter);
+    errno = injected_enter_error.load();
+    return -1;
+  }
+  return SysEnter(ring_fd, to_submit, min_complete, flags);
+}
+
+int SysRegister(int ring_fd, uint32_t opcode, const void* arg, uint32_t nr_args) {
+  return static_cast<int>(syscall(__NR_io_uring_register, ring_fd, opcode, arg, nr_args));
+}
+
+// The ring indices are shared with the kernel
+uint32_t LoadAcquire(const uint32_t* p) { return __atomic_load_n(p, __ATOMIC_ACQUIRE); }
+
+void StoreRelease(uint32_t* p, uint32_t v) { __atomic_store_n(p, v, __ATOMIC_RELEASE); }
+
+}  // namespace
+
+struct IoUring::Impl {
+  ~Impl() {
+    if (sqes != nullptr) {
+      munmap(sqes, sqes_size);
+    }
+    if (cq_ring != nullptr && cq_ring != sq_ring) {
+      munmap(cq_ring, cq_ring_size);
+    }
+    if (sq_ring != nullptr) {
+      munmap(sq_ring, sq_ring_size);
+    }
+    if (ring_fd >= 0) {
+      close(ring_fd);
+    }
+  }
+
+  Status Init(int fd, uint32_t num_entries) {
+    io_uring_params params;
+    std::memset(&params, 0, sizeof(params));
+    ring_fd = SysSetup(num_entries, &params);
+    if (ring_fd < 0) {
+      return IOErrorFromErrno(errno, "io_uring_setup failed");
+    }
+    entries = params.sq_entries;
+
+    sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+    cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    const bool single_mmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (single_mmap) {
+      sq_ring_size = cq_ring_size = std::max(sq_ring_size, cq_ring_size);
+    }
+    sq_ring = Map(sq_ring_size, IORING_OFF_SQ_RING);
+    if (sq_ring == nullptr) {
+      return IOErrorFromErrno(errno, "Failed to map io_uring submission queue");
+    }
+    if (single_mmap) {
+      cq_ring = sq_ring;
+    } else {
+      cq_ring = Map(cq_ring_size, IORING_OFF_CQ_RING);
+      if (cq_ring == nullptr) {
+        return IOErrorFromErrno(errno, "Failed to map io_uring completion queue");
+      }
+    }
+    sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+    sqes = static_cast<io_uring_sqe*>(Map(sqes_size, IORING_OFF_SQES));
+    if (sqes == nullptr) {
+      return IOErrorFromErrno(errno, "Failed to map io_uring submission entries");
+    }
+
+    auto sq_base = static_cast<uint8_t*>(sq_ring);
+    sq_head = reinterpret_cast<uint32_t*>(sq_base + params.sq_off.head);
+    sq_tail = reinterpret_cast<uint32_t*>(sq_base + params.sq_off.tail);
+    sq_mask = *reinterpret_cast<uint32_t*>(sq_base + params.sq_off.ring_mask);
+    sq_array = reinterpret_cast<uint32_t*>(sq_base + params.sq_off.array);
+    auto cq_base = static_cast<uint8_t*>(cq_ring);
+    cq_head = reinterpret_cast<uint32_t*>(cq_base + params.cq_off.head);
+    cq_tail = reinterpret_cast<uint32_t*>(cq_base + params.cq_off.tail);
+    cq_mask = *reinterpret_cast<uint32_t*>(cq_base + params.cq_off.ring_mask);
+    cqes = reinterpret_cast<io_uring_cqe*>(cq_base + params.cq_off.cqes);
+
+    // Registering the file saves the kernel a file table lookup per read;
+    // it is only an optimization, so ignore failures.
+    if (SysRegister(ring_fd, IORING_REGISTER_FILES, &fd, 1) == 0) {
+      sqe_fd = 0;
+      sqe_flags = IOSQE_FIXED_FILE;
+    } else {
+      sqe_fd = fd;
+      sqe_flags = 0;
+    }
+    return Status::OK();
+  }
+
+  void* Map(size_t size, off_t offset) {
+    void* p = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                   ring_fd, offset);
+    return p == MAP_FAILED ? nullptr : p;
+  }
+
+  // Queue an entry into the submission queue (which must not be full)
+  io_uring_sqe* PrepareEntry(uint8_t opcode, uint64_t user_data) {
+    // Only we write the tail, so it doesn't need an acquire load
+    const uint32_t tail = *sq_tail;
+    const uint32_t index = tail & sq_mask;
+    io_uring_sqe* sqe = &sqes[index];
+    std::memset(sqe, 0, sizeof(*sqe));
+    sqe->opcode = opcode;
+    sqe->user_data = user_data;
+    sq_array[index] = index;
+    StoreRelease(sq_tail, tail + 1);
+    return sqe;
+  }
+
+  void PrepareRead(const iovec* iov, int64_t offset, uint64_t user_data) {
+    io_uring_sqe* sqe = PrepareEntry(IORING_OP_READV, user_data);
+    sqe->flags = sqe_flags;
+    sqe->fd = sqe_fd;
+    sqe->off = static_cast<uint64_t>(offset);
+    sqe->addr = reinterpret_cast<uint64_t>(iov);
+    sqe->len = 1;
+  }
+
+  void PrepareCancel(uint64_t user_data) {
+    io_uring_sqe* sqe = PrepareEntry(IORING_OP_ASYNC_CANCEL, kCancelUserData);
+    sqe->fd = -1;
+    sqe->addr = user_data;
+  }
+
+  // Submit the `unsubmitted` queued entries and wait for at least one completion,
+  // setting `consumed` to the number of entries the kernel consumed.  Returns false
+  // if io_uring_enter failed with a non-transient error (left in errno), in which
+  // case the entries it didn't consume are withdrawn.
+  bool Enter(uint32_t unsubmitted, uint32_t* consumed) {
+    const int ret = enter_function.load()(ring_fd, unsubmitted, /*min_complete=*/1,
+                                          IORING_ENTER_GETEVENTS);
+    const int error = errno;
+    // Count the consumed entries from the submission queue head rather than the
+    // return value, which doesn't tell when the call fails
+    const uint32_t head = LoadAcquire(sq_head);
+    *consumed = unsubmitted - (*sq_tail - head);
+    if (ret < 0 && error != EINTR && error != EAGAIN && error != EBUSY) {
+      WithdrawUnsubmitted();
+      errno = error;
+      return false;
+    }
+    return true;
+  }
+
+  // Remove the entries the kernel didn't consume from the submission queue.  The
+  // kernel only reads the tail during io_uring_enter, which nobody else calls.
+  void WithdrawUnsubmitted() { StoreRelease(sq_tail, LoadAcquire(sq_head)); }
+
+  Status ReadMany(const std::vector<ReadRange>& ranges, const std::vector<uint8_t*>& out,
+                  const ReadCallback& on_done) {
+    DCHECK_EQ(ranges.size(), out.size());
+    if (failed) {
+      const auto st = Status::IOError("io_uring instance failed earlier");
+      for (size_t i = 0; i < ranges.size(); ++i) {
+        on_done(i, st);
+      }
+      return st;
+    }
+    struct PendingRead {
+      iovec iov;
+      int64_t bytes_read = 0;
+      bool in_flight = false;
+    };
+    std::vector<PendingRead> reads(ranges.size());
+    // Reads waiting to be (re)submitted
+    std::deque<size_t> queue;
+    for (size_t i = 0; i < ranges.size(); ++i) {
+      if (ranges[i].length == 0) {
+        on_done(i, int64_t(0));
+      } else {
+        queue.push_back(i);
+      }
+    }
+
+    // Reads queued in the submission queue but not yet consumed by the kernel
+    std::deque<size_t> unsubmitted;
+    // Number of reads consumed by the kernel but not yet completed
+    uint32_t in_flight = 0;
+    // Number of cancellation requests consumed by the kernel but not yet completed
+    uint32_t cancels_in_flight = 0;
+
+    auto prepare = [&](size_t i) {
+      auto& read = reads[i];
+      const int64_t remaining = ranges[i].length - read.bytes_read;
+      read.iov.iov_base = out[i] + read.bytes_read;
+      read.iov.iov_len = static_cast<size_t>(std::min(remaining, kMaxReadSize));
+      PrepareRead(&read.iov, ranges[i].offset + read.bytes_read, i);
+      unsubmitted.push_back(i);
+    };
+
+    auto mark_submitted = [&](uint32_t consumed) {
+      for (uint32_t k = 0; k < consumed; ++k) {
+        reads[unsubmitted.front()].in_flight = true;
+        unsubmitted.pop_front();
+        ++in_flight;
+      }
+    };
+
+    auto reap = [&]() {
+      uint32_t head = *cq_head;
+      const uint32_t tail = LoadAcquire(cq_tail);
+      for (; head != tail; ++head) {
+        const io_uring_cqe& cqe = cqes[head & cq_mask];
+        if (cqe.user_data == kCancelUserData) {
+          --cancels_in_flight;
+          continue;
+        }
+        const auto i = static_cast<size_t>(cqe.user_data);
+        const int res = cqe.res;
+        auto& read = reads[i];
+        DCHECK(read.in_flight);
+        read.in_flight = false;
+        --in_flight;
+        if (res < 0) {
+          if (res == -EINTR || res == -EAGAIN || res == -ECANCELED) {
+            queue.push_back(i);
+          } else {
+            on_done(i, IOErrorFromErrno(-res, "Error reading bytes from file"));
+          }
+          continue;
+        }
+        read.bytes_read += res;
+        if (res == 0 || read.bytes_read == ranges[i].length) {
+          on_done(i, read.bytes_read);
+        } else {
+          // Short read before the end of the file, resume it
+          queue.push_back(i);
+        }
+      }
+      StoreRelease(cq_head, head);
+    };
+
+    while (!queue.empty() || !unsubmitted.empty() || in_flight > 0) {
+      while (!queue.empty() && unsubmitted.size() + in_flight < entries) {
+        prepare(queue.front());
+        queue.pop_front();
+      }
+      uint32_t consumed = 0;
+      const bool entered = Enter(static_cast<uint32_t>(unsubmitted.size()), &consumed);
+      const int error = errno;
+      mark_submitted(consumed);
+      if (!entered) {
+        failed = true;
+        const auto st = IOErrorFromErrno(error, "io_uring_enter failed");
+        // Enter() withdrew the reads the kernel didn't consume
+        queue.insert(queue.end(), unsubmitted.begin(), unsubmitted.end());
+        unsubmitted.clear();
+
+        // The reads in flight still write into `out`, which the caller may release
+        // once we return: cancel them and wait for them to complete.
+        uint32_t cancels = 0;
+        for (size_t i = 0; i < reads.size(); ++i) {
+          if (reads[i].in_flight) {
+            PrepareCancel(i);
+            ++cancels;
+          }
+        }
+        bool can_enter = true;
+        while (in_flight > 0 || cancels_in_flight > 0) {
+          if (can_enter) {
+            can_enter = Enter(cancels, &consumed);
+            cancels -= consumed;
+            cancels_in_flight += consumed;
+          } else {
+            // Reads complete without our entering the kernel, but their completions
+            // may only be posted on our next system call
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+          }
+          reap();
+        }
+        if (can_enter && cancels > 0) {
+          WithdrawUnsubmitted();
+        }
+        // Reads that didn't complete fail with the ring
+        for (size_t i : queue) {
+          on_done(i, st);
+        }
+        return st;
+      }
+      reap();
+    }
+    return Status::OK();
+  }
+
+  int ring_fd = -1;
+  uint32_t entries = 0;
+  // Whether io_uring_enter failed; the ring isn't used anymore then
+  bool failed = false;
+  int sqe_fd = -1;
+  uint8_t sqe_flags = 0;
+
+  void* sq_ring = nullptr;
+  size_t sq_ring_size = 0;
+  void* cq_ring = nullptr;
+  size_t cq_ring_size = 0;
+  io_uring_sqe* sqes = nullptr;
+  size_t sqes_size = 0;
+
+  uint32_t* sq_head = nullptr;
+  uint32_t* sq_tail = nullptr;
+  uint32_t sq_mask = 0;
+  uint32_t* sq_array = nullptr;
+  uint32_t* cq_head = nullptr;
+  uint32_t* cq_tail = nullptr;
+  uint32_t cq_mask = 0;
+  io_uring_cqe* cqes = nullptr;
+};
+
+IoUring::IoUring() : impl_(new Impl()) {}
+
+IoUring::~IoUring() = default;
+
+Result<std::unique_ptr<IoUring>> IoUring::Make(int fd, uint32_t entries) {
+  std::unique_ptr<IoUring> ring(new IoUring());
+  RETURN_NOT_OK(ring->impl_->Init(fd, entries));
+  return ring;
+}
+
+bool IoUring::IsSupported() {
+  static const bool supported = [] {
+    io_uring_params params;
+    std::memset(&params, 0, sizeof(params));
+    const int ring_fd = SysSetup(1, &params);
+    if (ring_fd < 0) {
+      return false;
+    }
+    close(ring_fd);
+    return true;
+  }();
+  return supported;
+}
+
+uint32_t IoUring::entries() const { return impl_->entries; }
+
+bool IoUring::failed() const { return impl_->failed; }
+
+void IoUring::InjectEnterFailureForTesting(int error, int num_calls) {
+  if (error == 0) {
+    enter_function.store(&SysEnter);
+    return;
+  }
+  calls_before_injected_error.store(num_calls);
+  injected_enter_error.store(error);
+  enter_function.store(&FailingSysEnter);
+}
+
+Status IoUring::ReadMany(const std::vector<ReadRange>& ranges,
+                         const std::vector<uint8_t*>& out, const ReadCallback& on_done) {
+  return impl_->ReadMany(ranges, out, on_done);
+}
+
+#else  // !ARROW_HAVE_IO_URING
+
+struct IoUring::Impl {};
+
+IoUring::IoUring() = default;
+
+IoUring::~IoUring() = default;
+
+Result<std::unique_ptr<IoUring>> IoUring::Make(int fd, uint32_t entries) {
+  return Status::NotImplemented("io_uring is not available on this platform");
+}
+
+bool IoUring::IsSupported() { return false; }
+
+uint32_t IoUring::entries() const { return 0; }
+
+bool IoUring::failed() const { return false; }
+
+void IoUring::InjectEnterFailureForTesting(int error, int num_calls) {}
+
+Status IoUring::ReadMany(const std::vector<ReadRange>& ranges,
+                         const std::vector<uint8_t*>& out, const ReadCallback& on_done) {
+  return Status::NotImplemented("io_uring is not available on this platform");
+}
+
+#endif  // ARROW_HAVE_IO_URING
+
+}  // namespace internal
+}  // namespace io
+}  // namespace arrow
@@ -0,0 +1,90 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "arrow/io/interfaces.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace io {
+namespace internal {
+
+// A minimal io_uring instance bound to a single file descriptor, used to submit
+// batches of positional reads to the kernel with as few system calls as possible.
+//
+// This talks to the kernel through the raw io_uring system calls, so that no
+// additional library is required.  io_uring is only available on Linux;
+// elsewhere, Make() returns NotImplemented.
+//
+// An IoUring is not thread-safe: callers must serialize calls to ReadMany().
+class ARROW_EXPORT IoUring {
+ public:
+  // Called once for each range given to ReadMany(), with the number of bytes
+  // read into the range's output (less than the range length only at end of file)
+  // or the error that occurred reading the range.
+  using ReadCallback = std::function<void(size_t index, Result<int64_t> bytes_read)>;
+
+  ~IoUring();
+
+  // Create an io_uring instance with (at least) `entries` submission queue entries
+  // for reading from `fd`.  `fd` must outlive the IoUring.
+  static Result<std::unique_ptr<IoUring>> Make(int fd, uint32_t entries);
+
+  // Whether io_uring is supported by this build and the running kernel
+  static bool IsSupported();
+
+  // Number of reads that can be in flight at once
+  uint32_t entries() const;
+
+  // Whether the ring failed (see ReadMany()), after which it can't be used anymore
+  bool failed() const;
+
+  // Read each of `ranges` into the corresponding `out` pointer, which must have
+  // room for the range's length.  Up to entries() reads are submitted at once,
+  // then more are submitted as earlier ones complete.  Short reads are resumed
+  // until they reach the end of the file.
+  //
+  // `on_done` is called exactly once for each range (in completion order, on the
+  // calling thread).  If the ring itself fails, the reads in flight are cancelled
+  // and waited for, so that nothing is written into `out` after this returns; the
+  // ranges not read yet are then failed with the returned error and the ring is
+  // marked as failed.
+  Status ReadMany(const std::vector<ReadRange>& ranges, const std::vector<uint8_t*>& out,
+                  const ReadCallback& on_done);
+
+  // Make the io_uring_enter call that follows the next `num_calls` ones (in any
+  // ring) fail with `error`.  An error of 0 removes the injected failure.  For testing.
+  static void InjectEnterFailureForTesting(int error, int num_calls = 0);
+
+ private:
+  IoUring();
+
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace internal
+}  // namespace io
+}  // namespace arrow
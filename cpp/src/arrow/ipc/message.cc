@@ -17,10 +17,17 @@
 
 #include "arrow/ipc/message.h"
 
+#ifndef _WIN32
+#  include <sys/uio.h>
+#endif
+
 #include <algorithm>
+#include <cerrno>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -36,6 +43,7 @@
 #include "arrow/status.h"
 #include "arrow/util/endian.h"
 #include "arrow/util/future.h"
+#include "arrow/util/io_util.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/ubsan.h"
 
@@ -1021,6 +1029,216 @@ class InputStreamMessageReader : public MessageReader, public MessageDecoderList
   MessageDecoder decoder_;
 };
 
+namespace {
+
+// Hands out buffers for message bodies, and takes them back for reuse once
+// released by their consumer.
+class BodyBufferPool : public std::enable_shared_from_this<BodyBufferPool> {
+ public:
+  // Consecutive messages of a stream usually have bodies of similar sizes,
+  // so a few buffers are enough
+  static constexpr size_t kMaxFreeBuffers = 4;
+
+  explicit BodyBufferPool(MemoryPool* pool) : pool_(pool) {}
+
+  // Return a mutable buffer of `size` bytes
+  Result<std::shared_ptr<Buffer>> Allocate(int64_t size) {
+    std::unique_ptr<ResizableBuffer> buffer;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      // Take the smallest free buffer that is large enough
+      auto best = free_buffers_.end();
+      for (auto it = free_buffers_.begin(); it != free_buffers_.end(); ++it) {
+        if ((*it)->capacity() >= size &&
+            (best == free_buffers_.end() || (*it)->capacity() < (*best)->capacity())) {
+          best = it;
+        }
+      }
+      if (best != free_buffers_.end()) {
+        buffer = std::move(*best);
+        free_buffers_.erase(best);
+      }
+    }
+    if (buffer) {
+      RETURN_NOT_OK(buffer->Resize(size, /*shrink_to_fit=*/false));
+    } else {
+      ARROW_ASSIGN_OR_RAISE(buffer, AllocateResizableBuffer(size, pool_));
+    }
+    return std::make_shared<RecycledBuffer>(std::move(buffer), weak_from_this());
+  }
+
+ private:
+  class RecycledBuffer : public MutableBuffer {
+   public:
+    RecycledBuffer(std::unique_ptr<ResizableBuffer> buffer,
+                   std::weak_ptr<BodyBufferPool> owner)
+        : MutableBuffer(buffer->mutable_data(), buffer->size()),
+          buffer_(std::move(buffer)),
+          owner_(std::move(owner)) {}
+
+    ~RecycledBuffer() override {
+      if (auto owner = owner_.lock()) {
+        owner->Release(std::move(buffer_));
+      }
+    }
+
+   private:
+    std::unique_ptr<ResizableBuffer> buffer_;
+    std::weak_ptr<BodyBufferPool> owner_;
+  };
+
+  void Release(std::unique_ptr<ResizableBuffer> buffer) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (free_buffers_.size() < kMaxFreeBuffers) {
+      free_buffers_.push_back(std::move(buffer));
+    }
+  }
+
+  MemoryPool* pool_;
+  std::mutex mutex_;
+  std::vector<std::unique_ptr<ResizableBuffer>> free_buffers_;
+};
+
+// Read messages from a file descriptor, such as a socket or a pipe.
+//
+// The decoder is only ever given complete metadata and bodies, so that it
+// doesn't copy them.  Each body is read straight into a recycled buffer,
+// along with the start of the next message where available.
+class FileDescriptorMessageReader : public MessageReader,
+                                    public MessageDecoderListener {
+ public:
+  FileDescriptorMessageReader(int fd, MemoryPool* pool)
+      : fd_(fd),
+        pool_(pool),
+        body_pool_(std::make_shared<BodyBufferPool>(pool)),
+        decoder_(std::shared_ptr<FileDescriptorMessageReader>(this, [](void*) {}),
+                 pool) {}
+
+  Status OnMessageDecoded(std::unique_ptr<Message> message) override {
+    message_ = std::move(message);
+    return Status::OK();
+  }
+
+  Result<std::unique_ptr<Message>> ReadNextMessage() override {
+    while (!message_ && decoder_.state() != MessageDecoder::State::EOS) {
+      const int64_t next_size = decoder_.next_required_size();
+      switch (decoder_.state()) {
+        case MessageDecoder::State::INITIAL:
+        case MessageDecoder::State::METADATA_LENGTH: {
+          // Length prefix, or continuation token
+          const bool at_message_start =
+              decoder_.state() == MessageDecoder::State::INITIAL && pending_size_ == 0;
+          ARROW_ASSIGN_OR_RAISE(
+              int64_t bytes_read,
+              ReadAtLeast(pending_ + pending_size_,
+                          std::max<int64_t>(0, next_size - pending_size_)));
+          pending_size_ += bytes_read;
+          if (pending_size_ == 0 && at_message_start) {
+            // EOS without indication
+            return nullptr;
+          }
+          if (pending_size_ < next_size) {
+            return Status::Invalid("Corrupted message, only ", pending_size_,
+                                   " bytes available");
+          }
+          RETURN_NOT_OK(decoder_.Consume(pending_, next_size));
+          ConsumePending(next_size);
+          break;
+        }
+        case MessageDecoder::State::METADATA: {
+          ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> metadata,
+                                AllocateBuffer(next_size, pool_));
+          RETURN_NOT_OK(ReadFully(metadata->mutable_data(), next_size, "metadata"));
+          RETURN_NOT_OK(decoder_.Consume(std::move(metadata)));
+          break;
+        }
+        case MessageDecoder::State::BODY: {
+          ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> body,
+                                body_pool_->Allocate(next_size));
+          RETURN_NOT_OK(ReadFully(body->mutable_data(), next_size, "message body"));
+          RETURN_NOT_OK(decoder_.Consume(std::move(body)));
+          break;
+        }
+        case MessageDecoder::State::EOS:
+          break;
+      }
+    }
+    return std::move(message_);
+  }
+
+ private:
+  // Enough for the continuation token and the metadata length
+  static constexpr int64_t kMaxPendingSize = 8;
+
+  void ConsumePending(int64_t nbytes) {
+    std::memmove(pending_, pending_ + nbytes, pending_size_ - nbytes);
+    pending_size_ -= nbytes;
+  }
+
+  // Read `nbytes` bytes into `out`, starting with the pending bytes.  The
+  // start of the next message is also read into the pending bytes if already
+  // available.
+  Status ReadFully(uint8_t* out, int64_t nbytes, const char* what) {
+    const int64_t from_pending = std::min(nbytes, pending_size_);
+    std::memcpy(out, pending_, from_pending);
+    ConsumePending(from_pending);
+    ARROW_ASSIGN_OR_RAISE(int64_t bytes_read,
+                          ReadAtLeast(out + from_pending, nbytes - from_pending,
+                                      pending_ + pending_size_,
+                                      kMaxPendingSize - pending_size_));
+    if (from_pending + bytes_read < nbytes) {
+      return Status::IOError("Expected to be able to read ", nbytes, " bytes for ",
+                             what, ", got ", from_pending + bytes_read);
+    }
+    pending_size_ += from_pending + bytes_read - nbytes;
+    return Status::OK();
+  }
+
+  // Read at least `nbytes` bytes into `out`, and up to `extra_size` more
+  // bytes into `extra` if they are available without blocking further.
+  // Less than `nbytes` bytes are returned only at end of file.
+  Result<int64_t> ReadAtLeast(uint8_t* out, int64_t nbytes, uint8_t* extra = nullptr,
+                              int64_t extra_size = 0) {
+#ifdef _WIN32
+    ARROW_UNUSED(extra);
+    ARROW_UNUSED(extra_size);
+    return ::arrow::internal::FileRead(fd_, out, nbytes);
+#else
+    int64_t total_read = 0;
+    while (total_read < nbytes) {
+      iovec iov[2];
+      iov[0].iov_base = out + total_read;
+      iov[0].iov_len = static_cast<size_t>(nbytes - total_read);
+      iov[1].iov_base = extra;
+      iov[1].iov_len = static_cast<size_t>(extra_size);
+      const ssize_t ret = readv(fd_, iov, extra_size > 0 ? 2 : 1);
+      if (ret == -1) {
+        if (errno == EINTR) {
+          continue;
+        }
+        return ::arrow::internal::IOErrorFromErrno(errno, "Error reading IPC message");
+      }
+      if (ret == 0) {
+        break;
+      }
+      total_read += ret;
+    }
+    return total_read;
+#endif
+  }
+
+  int fd_;
+  MemoryPool* pool_;
+  std::shared_ptr<BodyBufferPool> body_pool_;
+  std::unique_ptr<Message> message_;
+  MessageDecoder decoder_;
+  // Bytes read ahead of what the decoder needs
+  uint8_t pending_[kMaxPendingSize];
+  int64_t pending_size_ = 0;
+};
+
+}  // namespace
+
 std::unique_ptr<MessageReader> MessageReader::Open(io::InputStream* stream) {
   return std::make_unique<InputStreamMessageReader>(stream);
 }
@@ -1030,5 +1248,10 @@ std::unique_ptr<MessageReader> MessageReader::Open(
   return std::make_unique<InputStreamMessageReader>(owned_stream);
 }
 
+std::unique_ptr<MessageReader> MessageReader::OpenFileDescriptor(int fd,
+                                                                 MemoryPool* pool) {
+  return std::make_unique<FileDescriptorMessageReader>(fd, pool);
+}
+
 }  // namespace ipc
 }  // namespace arrow
@@ -439,6 +439,20 @@ class ARROW_EXPORT MessageReader {
   static std::unique_ptr<MessageReader> Open(
       const std::shared_ptr<io::InputStream>& owned_stream);
 
+  /// \brief Create MessageReader that reads from a file descriptor, such as a
+  /// socket or a pipe
+  ///
+  /// Message bodies are read directly into buffers allocated from `pool`, with
+  /// scatter reads fetching the start of the next message at the same time.
+  /// Once released by the consumer (for example when the record batch read
+  /// from a message is destroyed), body buffers are reused for the next
+  /// messages.
+  ///
+  /// The file descriptor must stay open as long as the reader is used, and is
+  /// not closed by the reader.
+  static std::unique_ptr<MessageReader> OpenFileDescriptor(
+      int fd, MemoryPool* pool = default_memory_pool());
+
   /// \brief Read next Message from the interface
   ///
   /// \return an arrow::ipc::Message instance
@@ -22,6 +22,7 @@
 #include <vector>
 
 #include "arrow/io/caching.h"
+#include "arrow/io/interfaces.h"
 #include "arrow/ipc/type_fwd.h"
 #include "arrow/status.h"
 #include "arrow/type_fwd.h"
@@ -149,6 +150,18 @@ struct ARROW_EXPORT IpcReadOptions {
   /// like decompression
   bool use_threads = true;
 
+  /// \brief Whether RecordBatchStreamReader reads the next message in the background
+  ///
+  /// If enabled, along with use_threads, the next message of a compressed stream is
+  /// read on io_context while the current one is decompressed.  The reader then
+  /// waits for that read, so this must not be enabled if the input stream itself
+  /// waits on tasks of io_context's executor.  Nothing is read in the background
+  /// when the reader is called from a thread of that executor.
+  bool prefetch_stream_messages = false;
+
+  /// \brief The IO context to read messages in the background on
+  io::IOContext io_context;
+
   /// \brief Whether to convert incoming data to platform-native endianness
   ///
   /// If the endianness of the received schema is not equal to platform-native
@@ -20,6 +20,7 @@
 #include <cstdint>
 #include <sstream>
 #include <string>
+#include <thread>
 
 #include "arrow/buffer.h"
 #include "arrow/io/file.h"
@@ -184,6 +185,94 @@ static void DecodeStream(benchmark::State& state) {  // NOLINT non-const referen
   state.SetBytesProcessed(int64_t(state.iterations()) * kTotalSize);
 }
 
+// A minimal InputStream over a file descriptor that doesn't support seeking
+class PipeInputStream : public io::InputStream {
+ public:
+  explicit PipeInputStream(int fd) : fd_(fd) {}
+
+  Status Close() override {
+    closed_ = true;
+    return Status::OK();
+  }
+  bool closed() const override { return closed_; }
+  Result<int64_t> Tell() const override { return position_; }
+
+  Result<int64_t> Read(int64_t nbytes, void* out) override {
+    ARROW_ASSIGN_OR_RAISE(auto bytes_read, internal::FileRead(
+                                               fd_, static_cast<uint8_t*>(out), nbytes));
+    position_ += bytes_read;
+    return bytes_read;
+  }
+
+  Result<std::shared_ptr<Buffer>> Read(int64_t nbytes) override {
+    ARROW_ASSIGN_OR_RAISE(auto buffer, AllocateResizableBuffer(nbytes));
+    ARROW_ASSIGN_OR_RAISE(auto bytes_read, Read(nbytes, buffer->mutable_data()));
+    RETURN_NOT_OK(buffer->Resize(bytes_read, /*shrink_to_fit=*/false));
+    return std::move(buffer);
+  }
+
+ private:
+  int fd_;
+  int64_t position_ = 0;
+  bool closed_ = false;
+};
+
+// Read a stream of 16 batches of 1MB each from a pipe, fed by another thread
+template <bool kFileDescriptorReader>
+static void ReadPipeStream(benchmark::State& state) {  // NOLINT non-const reference
+  constexpr int64_t kBatchSize = 1 << 20;
+  constexpr int64_t kBatches = 16;
+  auto record_batch = MakeRecordBatch(kBatchSize, state.range(0));
+
+  std::shared_ptr<ResizableBuffer> buffer = *AllocateResizableBuffer(1024);
+  {
+    io::BufferOutputStream stream(buffer);
+    auto writer = *ipc::MakeStreamWriter(&stream, record_batch->schema());
+    for (int i = 0; i < kBatches; i++) {
+      ABORT_NOT_OK(writer->WriteRecordBatch(*record_batch));
+    }
+    ABORT_NOT_OK(writer->Close());
+    ABORT_NOT_OK(stream.Close());
+  }
+
+  for (auto _ : state) {
+    auto pipe = *internal::CreatePipe();
+    std::thread feeder([&]() {
+      ABORT_NOT_OK(internal::FileWrite(pipe.wfd.fd(), buffer->data(), buffer->size()));
+      ABORT_NOT_OK(pipe.wfd.Close());
+    });
+    std::shared_ptr<RecordBatchReader> reader;
+    if (kFileDescriptorReader) {
+      reader = *ipc::RecordBatchStreamReader::Open(
+          ipc::MessageReader::OpenFileDescriptor(pipe.rfd.fd()));
+    } else {
+      // Regular stream reading, through an InputStream
+      reader = *ipc::RecordBatchStreamReader::Open(
+          std::make_shared<PipeInputStream>(pipe.rfd.fd()));
+    }
+    while (true) {
+      std::shared_ptr<RecordBatch> batch;
+      ABORT_NOT_OK(reader->ReadNext(&batch));
+      if (batch.get() == nullptr) {
+        break;
+      }
+    }
+    feeder.join();
+    ABORT_NOT_OK(pipe.rfd.Close());
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * kBatchSize * kBatches);
+}
+
+static void ReadPipeStreamInputStream(
+    benchmark::State& state) {  // NOLINT non-const reference
+  ReadPipeStream</*kFileDescriptorReader=*/false>(state);
+}
+
+static void ReadPipeStreamFileDescriptor(
+    benchmark::State& state) {  // NOLINT non-const reference
+  ReadPipeStream</*kFileDescriptorReader=*/true>(state);
+}
+
 #ifdef ARROW_WITH_ZSTD
 #  define GENERATE_COMPRESSED_DATA_IN_MEMORY()                                      \
     constexpr int64_t kBatchSize = 1 << 20; /* 1 MB */                              \
@@ -371,5 +460,13 @@ BENCHMARK(WriteRecordBatch)->RangeMultiplier(4)->Range(1, 1 << 13)->UseRealTime(
 BENCHMARK(ReadRecordBatch)->RangeMultiplier(4)->Range(1, 1 << 13)->UseRealTime();
 BENCHMARK(ReadStream)->RangeMultiplier(4)->Range(1, 1 << 13)->UseRealTime();
 BENCHMARK(DecodeStream)->RangeMultiplier(4)->Range(1, 1 << 13)->UseRealTime();
+BENCHMARK(ReadPipeStreamInputStream)
+    ->RangeMultiplier(8)
+    ->Range(1, 1 << 12)
+    ->UseRealTime();
+BENCHMARK(ReadPipeStreamFileDescriptor)
+    ->RangeMultiplier(8)
+    ->Range(1, 1 << 12)
+    ->UseRealTime();
 
 }  // namespace arrow
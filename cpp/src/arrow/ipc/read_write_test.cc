@@ -22,6 +22,7 @@
 #include <numeric>
 #include <ostream>
 #include <string>
+#include <thread>
 #include <unordered_set>
 
 #include <flatbuffers/flatbuffers.h>
@@ -53,6 +54,7 @@
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/io_util.h"
 #include "arrow/util/key_value_metadata.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/util/ubsan.h"
 
 #include "generated/Message_generated.h"  // IWYU pragma: keep
@@ -1337,6 +1339,71 @@ struct StreamWriterHelper {
   std::shared_ptr<RecordBatchWriter> writer_;
 };
 
+// Read the stream from a pipe, fed by another thread
+struct FileDescriptorStreamWriterHelper : public StreamWriterHelper {
+  using StreamWriterHelper::ReadSchema;
+
+  Status ReadBatches(const IpcReadOptions& options, RecordBatchVector* out_batches,
+                     ReadStats* out_stats = nullptr,
+                     MetadataVector* out_metadata_list = nullptr) override {
+    return ReadFromPipe([&](int fd) -> Status {
+      ARROW_ASSIGN_OR_RAISE(
+          auto reader,
+          RecordBatchStreamReader::Open(MessageReader::OpenFileDescriptor(fd), options));
+      while (true) {
+        ARROW_ASSIGN_OR_RAISE(auto chunk_with_metadata, reader->ReadNext());
+        if (chunk_with_metadata.batch == nullptr) {
+          break;
+        }
+        out_batches->push_back(chunk_with_metadata.batch);
+        if (out_metadata_list) {
+          out_metadata_list->push_back(chunk_with_metadata.custom_metadata);
+        }
+      }
+      if (out_stats) {
+        *out_stats = reader->stats();
+      }
+      return Status::OK();
+    });
+  }
+
+  Status ReadSchema(const IpcReadOptions& read_options,
+                    std::shared_ptr<Schema>* out) override {
+    return ReadFromPipe([&](int fd) -> Status {
+      ARROW_ASSIGN_OR_RAISE(
+          auto reader, RecordBatchStreamReader::Open(
+                           MessageReader::OpenFileDescriptor(fd), read_options));
+      *out = reader->schema();
+      return Status::OK();
+    });
+  }
+
+  template <typename ReadFunc>
+  Status ReadFromPipe(ReadFunc&& read) {
+    ARROW_ASSIGN_OR_RAISE(auto pipe, ::arrow::internal::CreatePipe());
+    Status write_status;
+    std::thread writer([&]() {
+      write_status =
+          ::arrow::internal::FileWrite(pipe.wfd.fd(), buffer_->data(), buffer_->size());
+      write_status &= pipe.wfd.Close();
+    });
+    Status read_status = read(pipe.rfd.fd());
+    // Drain the pipe so that the writer doesn't block
+    uint8_t scratch[4096];
+    while (true) {
+      auto bytes_read =
+          ::arrow::internal::FileRead(pipe.rfd.fd(), scratch, sizeof(scratch));
+      if (!bytes_read.ok() || *bytes_read == 0) {
+        break;
+      }
+    }
+    writer.join();
+    RETURN_NOT_OK(read_status);
+    RETURN_NOT_OK(write_status);
+    return pipe.rfd.Close();
+  }
+};
+
 class CopyCollectListener : public CollectListener {
  public:
   CopyCollectListener() : CollectListener() {}
@@ -1719,6 +1786,10 @@ class TestFileFormatGeneratorCoalesced
 class TestStreamFormat : public ReaderWriterMixin<StreamWriterHelper>,
                          public ::testing::TestWithParam<MakeRecordBatch*> {};
 
+class TestStreamFileDescriptor
+    : public ReaderWriterMixin<FileDescriptorStreamWriterHelper>,
+      public ::testing::TestWithParam<MakeRecordBatch*> {};
+
 class TestStreamDecoderData : public ReaderWriterMixin<StreamDecoderDataWriterHelper>,
                               public ::testing::TestWithParam<MakeRecordBatch*> {};
 class TestStreamDecoderBuffer : public ReaderWriterMixin<StreamDecoderBufferWriterHelper>,
@@ -1891,6 +1962,8 @@ TEST_P(TestFileFormatGeneratorCoalesced, RoundTrip) {
 
 TEST_P(TestStreamFormat, RoundTrip) { TestRoundTripWithOptions(*GetParam()); }
 
+TEST_P(TestStreamFileDescriptor, RoundTrip) { TestRoundTripWithOptions(*GetParam()); }
+
 TEST_P(TestStreamDecoderData, RoundTrip) { TestRoundTripWithOptions(*GetParam()); }
 
 TEST_P(TestStreamDecoderBuffer, RoundTrip) { TestRoundTripWithOptions(*GetParam()); }
@@ -1909,6 +1982,8 @@ INSTANTIATE_TEST_SUITE_P(FileRoundTripTests, TestFileFormatGeneratorCoalesced,
                          ::testing::ValuesIn(kBatchCases));
 INSTANTIATE_TEST_SUITE_P(StreamRoundTripTests, TestStreamFormat,
                          ::testing::ValuesIn(kBatchCases));
+INSTANTIATE_TEST_SUITE_P(StreamFileDescriptorRoundTripTests, TestStreamFileDescriptor,
+                         ::testing::ValuesIn(kBatchCases));
 INSTANTIATE_TEST_SUITE_P(StreamDecoderDataRoundTripTests, TestStreamDecoderData,
                          ::testing::ValuesIn(kBatchCases));
 INSTANTIATE_TEST_SUITE_P(StreamDecoderBufferRoundTripTests, TestStreamDecoderBuffer,
@@ -2072,6 +2147,170 @@ TEST_F(TestFileFormat, ReadFieldSubset) { TestReadSubsetOfFields(); }
 TEST_F(TestFileFormatGenerator, ReadFieldSubset) { TestReadSubsetOfFields(); }
 TEST_F(TestFileFormatGeneratorCoalesced, ReadFieldSubset) { TestReadSubsetOfFields(); }
 
+TEST_F(TestStreamFileDescriptor, DictionaryRoundTrip) { TestDictionaryRoundtrip(); }
+TEST_F(TestStreamFileDescriptor, BatchWithMetadata) { TestWriteBatchWithMetadata(); }
+TEST_F(TestStreamFileDescriptor, DifferentMetadataBatches) {
+  TestWriteDifferentMetadata();
+}
+TEST_F(TestStreamFileDescriptor, NoRecordBatches) { TestWriteNoRecordBatches(); }
+TEST_F(TestStreamFileDescriptor, ReadFieldSubset) { TestReadSubsetOfFields(); }
+
+TEST(TestMessageReaderFileDescriptor, ReusesBodyBuffers) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeIntRecordBatch(&batch));
+
+  StreamWriterHelper helper;
+  ASSERT_OK(helper.Init(batch->schema(), IpcWriteOptions::Defaults()));
+  for (int i = 0; i < 3; ++i) {
+    ASSERT_OK(helper.WriteBatch(batch));
+  }
+  ASSERT_OK(helper.Finish());
+
+  // The stream is small enough to fit in the pipe's buffer
+  ASSERT_OK_AND_ASSIGN(auto pipe, ::arrow::internal::CreatePipe());
+  ASSERT_OK(::arrow::internal::FileWrite(pipe.wfd.fd(), helper.buffer_->data(),
+                                         helper.buffer_->size()));
+  ASSERT_OK(pipe.wfd.Close());
+
+  ASSERT_OK_AND_ASSIGN(
+      auto reader,
+      RecordBatchStreamReader::Open(MessageReader::OpenFileDescriptor(pipe.rfd.fd())));
+  ASSERT_OK_AND_ASSIGN(auto first, reader->Next());
+  ASSERT_OK_AND_ASSIGN(auto second, reader->Next());
+  AssertBatchesEqual(*batch, *first);
+  AssertBatchesEqual(*batch, *second);
+  const uint8_t* first_data = first->column(0)->data()->buffers[1]->data();
+  const uint8_t* second_data = second->column(0)->data()->buffers[1]->data();
+  // Both bodies are alive, so they can't share memory
+  ASSERT_NE(first_data, second_data);
+
+  // Release the first body, whose buffer is then reused for the third one
+  first.reset();
+  ASSERT_OK_AND_ASSIGN(auto third, reader->Next());
+  AssertBatchesEqual(*batch, *third);
+  ASSERT_EQ(first_data, third->column(0)->data()->buffers[1]->data());
+
+  ASSERT_OK_AND_ASSIGN(auto end, reader->Next());
+  ASSERT_EQ(end, nullptr);
+  ASSERT_OK(pipe.rfd.Close());
+}
+
+TEST(TestMessageReaderFileDescriptor, TruncatedStream) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeIntRecordBatch(&batch));
+
+  StreamWriterHelper helper;
+  ASSERT_OK(helper.Init(batch->schema(), IpcWriteOptions::Defaults()));
+  ASSERT_OK(helper.WriteBatch(batch));
+  ASSERT_OK(helper.Finish());
+
+  // Cut the stream in the middle of the record batch's body
+  const int64_t truncated_size = helper.buffer_->size() - 16;
+  ASSERT_OK_AND_ASSIGN(auto pipe, ::arrow::internal::CreatePipe());
+  ASSERT_OK(::arrow::internal::FileWrite(pipe.wfd.fd(), helper.buffer_->data(),
+                                         truncated_size));
+  ASSERT_OK(pipe.wfd.Close());
+
+  ASSERT_OK_AND_ASSIGN(
+      auto reader,
+      RecordBatchStreamReader::Open(MessageReader::OpenFileDescriptor(pipe.rfd.fd())));
+  ASSERT_RAISES(IOError, reader->Next());
+  ASSERT_OK(pipe.rfd.Close());
+}
+
+template <typename WriterHelper>
+void CheckParallelDecompression(Compression::type codec) {
+  // Large enough for decompression to be split across several tasks
+  random::RandomArrayGenerator rg(/*seed=*/0);
+  const int64_t length = 1 << 16;
+  auto schema = ::arrow::schema({field("f0", int64()), field("f1", utf8()),
+                                 field("f2", float64()), field("f3", list(int32()))});
+  RecordBatchVector batches;
+  for (int i = 0; i < 3; ++i) {
+    batches.push_back(rg.BatchOf(schema->fields(), length));
+  }
+
+  IpcWriteOptions write_options = IpcWriteOptions::Defaults();
+  ASSERT_OK_AND_ASSIGN(write_options.codec, util::Codec::Create(codec));
+  WriterHelper helper;
+  ASSERT_OK(helper.Init(schema, write_options));
+  for (const auto& batch : batches) {
+    ASSERT_OK(helper.WriteBatch(batch));
+  }
+  ASSERT_OK(helper.Finish());
+
+  for (bool use_threads : {true, false}) {
+    IpcReadOptions read_options = IpcReadOptions::Defaults();
+    read_options.use_threads = use_threads;
+    read_options.prefetch_stream_messages = use_threads;
+    RecordBatchVector out_batches;
+    ASSERT_OK(helper.ReadBatches(read_options, &out_batches));
+    ASSERT_EQ(out_batches.size(), batches.size());
+    for (size_t i = 0; i < batches.size(); ++i) {
+      ASSERT_OK(out_batches[i]->ValidateFull());
+      AssertBatchesEqual(*batches[i], *out_batches[i], /*check_metadata=*/true);
+    }
+  }
+}
+
+TEST(TestIpcCompression, ParallelDecompression) {
+  for (auto codec : {Compression::LZ4_FRAME, Compression::ZSTD}) {
+    if (!util::Codec::IsAvailable(codec)) {
+      continue;
+    }
+    ARROW_SCOPED_TRACE("codec = ", util::Codec::GetCodecAsString(codec));
+    CheckParallelDecompression<StreamWriterHelper>(codec);
+    CheckParallelDecompression<FileWriterHelper>(codec);
+  }
+}
+
+TEST(TestIpcCompression, PrefetchStreamMessages) {
+  auto codec = Compression::LZ4_FRAME;
+  if (!util::Codec::IsAvailable(codec)) {
+    codec = Compression::ZSTD;
+    if (!util::Codec::IsAvailable(codec)) {
+      GTEST_SKIP() << "No IPC compression codec available";
+    }
+  }
+  random::RandomArrayGenerator rg(/*seed=*/0);
+  auto schema = ::arrow::schema({field("f0", int64()), field("f1", utf8())});
+  RecordBatchVector batches;
+  for (int i = 0; i < 5; ++i) {
+    batches.push_back(rg.BatchOf(schema->fields(), /*length=*/1000));
+  }
+  IpcWriteOptions write_options = IpcWriteOptions::Defaults();
+  ASSERT_OK_AND_ASSIGN(write_options.codec, util::Codec::Create(codec));
+  StreamWriterHelper helper;
+  ASSERT_OK(helper.Init(schema, write_options));
+  for (const auto& batch : batches) {
+    ASSERT_OK(helper.WriteBatch(batch));
+  }
+  ASSERT_OK(helper.Finish());
+
+  // A single IO thread, which a reader running on it must not wait on
+  ASSERT_OK_AND_ASSIGN(auto executor, ::arrow::internal::ThreadPool::Make(1));
+  IpcReadOptions read_options = IpcReadOptions::Defaults();
+  read_options.prefetch_stream_messages = true;
+  read_options.io_context = io::IOContext(default_memory_pool(), executor.get());
+  auto check_read = [&]() -> Status {
+    RecordBatchVector out_batches;
+    RETURN_NOT_OK(helper.ReadBatches(read_options, &out_batches));
+    if (out_batches.size() != batches.size()) {
+      return Status::Invalid("Unexpected number of batches");
+    }
+    for (size_t i = 0; i < batches.size(); ++i) {
+      RETURN_NOT_OK(out_batches[i]->ValidateFull());
+      if (!out_batches[i]->Equals(*batches[i])) {
+        return Status::Invalid("Batch ", i, " differs");
+      }
+    }
+    return Status::OK();
+  };
+  ASSERT_OK(check_read());
+  ASSERT_OK_AND_ASSIGN(auto read_on_io_thread, executor->Submit(check_read));
+  ASSERT_FINISHES_OK(read_on_io_thread);
+}
+
 TEST_F(TestFileFormatGeneratorCoalesced, Errors) {
   std::shared_ptr<RecordBatch> batch;
   ASSERT_OK(MakeIntRecordBatch(&batch));
@@ -3078,18 +3317,23 @@ class PreBufferingTest : public ::testing::TestWithParam<bool> {
     file_buffer_ = MakeBooleanInt32Int64File(kRowsPerBatch, kNumBatches);
   }
 
-  void OpenReader() {
+  void OpenReader(std::vector<int> included_fields = {}) {
     buffer_reader_ = std::make_shared<io::BufferReader>(file_buffer_);
     tracked_ = io::TrackedRandomAccessFile::Make(buffer_reader_.get());
     auto read_options = IpcReadOptions::Defaults();
+    read_options.pre_buffer_cache_options = CacheOptions();
+    read_options.included_fields = std::move(included_fields);
+    ASSERT_OK_AND_ASSIGN(reader_, RecordBatchFileReader::Open(tracked_, read_options));
+  }
+
+  io::CacheOptions CacheOptions() {
+    auto cache_options = io::CacheOptions::LazyDefaults();
     if (ReadsArePlugged()) {
       // This will ensure that all reads get globbed together into one large read
-      read_options.pre_buffer_cache_options.hole_size_limit =
-          std::numeric_limits<int64_t>::max() - 1;
-      read_options.pre_buffer_cache_options.range_size_limit =
-          std::numeric_limits<int64_t>::max();
+      cache_options.hole_size_limit = std::numeric_limits<int64_t>::max() - 1;
+      cache_options.range_size_limit = std::numeric_limits<int64_t>::max();
     }
-    ASSERT_OK_AND_ASSIGN(reader_, RecordBatchFileReader::Open(tracked_, read_options));
+    return cache_options;
   }
 
   bool ReadsArePlugged() { return GetParam(); }
@@ -3173,6 +3417,83 @@ TEST_P(PreBufferingTest, MetadataOnlySomeBatches) {
   CheckFileRead(3);
 }
 
+TEST_P(PreBufferingTest, DataAllBatches) {
+  OpenReader();
+  ASSERT_OK(reader_->PreBufferBatches({}, CacheOptions()));
+  auto expected_batches = LoadExpected();
+  const auto& read_ranges = tracked_->get_read_ranges();
+  // The metadata is read upfront
+  const std::size_t starting_reads = read_ranges.size();
+  for (int i = 0; i < reader_->num_record_batches(); i++) {
+    ASSERT_OK_AND_ASSIGN(auto batch, reader_->ReadRecordBatch(i));
+    AssertBatchesEqual(*expected_batches[i], *batch);
+  }
+  // Batches are only separated by their small metadata, so their data is
+  // read at once
+  ASSERT_EQ(starting_reads + 1, read_ranges.size());
+  ASSERT_GT(read_ranges.back().length, kNumBatches * kMaxMetadataSizeBytes);
+}
+
+TEST_P(PreBufferingTest, DataReadTwice) {
+  OpenReader();
+  ASSERT_OK(reader_->PreBufferBatches({1, 2}, CacheOptions()));
+  auto expected_batches = LoadExpected();
+  for (int i = 1; i <= 2; i++) {
+    // Only the first read reuses the context the batch's reads were planned with
+    for (int attempt = 0; attempt < 2; attempt++) {
+      ASSERT_OK_AND_ASSIGN(auto batch, reader_->ReadRecordBatch(i));
+      AssertBatchesEqual(*expected_batches[i], *batch);
+    }
+  }
+}
+
+TEST_P(PreBufferingTest, DataSomeBatchesSomeFields) {
+  // Read each buffer separately, so that only the selected fields are read
+  auto cache_options = io::CacheOptions::LazyDefaults();
+  cache_options.hole_size_limit = 0;
+
+  auto bytes_read = [&](std::vector<int> included_fields) -> int64_t {
+    OpenReader(included_fields);
+    ARROW_EXPECT_OK(reader_->PreBufferBatches({1, 2, 3}, cache_options));
+    auto expected_batches = LoadExpected();
+    const auto& read_ranges = tracked_->get_read_ranges();
+    const std::size_t starting_reads = read_ranges.size();
+    for (int i = 1; i <= 3; i++) {
+      EXPECT_OK_AND_ASSIGN(auto batch, reader_->ReadRecordBatch(i));
+      auto expected = expected_batches[i];
+      if (!included_fields.empty()) {
+        EXPECT_OK_AND_ASSIGN(expected, expected->SelectColumns(included_fields));
+      }
+      AssertBatchesEqual(*expected, *batch);
+    }
+    int64_t total = 0;
+    for (std::size_t i = starting_reads; i < read_ranges.size(); i++) {
+      total += read_ranges[i].length;
+    }
+    return total;
+  };
+
+  const int64_t all_fields_bytes = bytes_read({});
+  // The int64 field is less than 2/3 of the data
+  const int64_t int64_field_bytes = bytes_read({2});
+  ASSERT_GE(int64_field_bytes, 3 * kRowsPerBatch * static_cast<int64_t>(sizeof(int64_t)));
+  ASSERT_LT(int64_field_bytes * 3, all_fields_bytes * 2);
+}
+
+TEST_P(PreBufferingTest, DataGenerator) {
+  OpenReader({0, 2});
+  ASSERT_OK_AND_ASSIGN(auto generator, reader_->GetRecordBatchGenerator(
+                                           /*coalesce=*/true, io::default_io_context(),
+                                           CacheOptions()));
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto batches, CollectAsyncGenerator(generator));
+  auto expected_batches = LoadExpected();
+  ASSERT_EQ(expected_batches.size(), batches.size());
+  for (std::size_t i = 0; i < batches.size(); i++) {
+    ASSERT_OK_AND_ASSIGN(auto expected, expected_batches[i]->SelectColumns({0, 2}));
+    AssertBatchesEqual(*expected, *batches[i]);
+  }
+}
+
 INSTANTIATE_TEST_SUITE_P(PreBufferingTests, PreBufferingTest,
                          ::testing::Values(false, true),
                          [](const ::testing::TestParamInfo<bool>& info) {
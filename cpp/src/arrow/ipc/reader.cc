@@ -20,8 +20,10 @@
 #include <algorithm>
 #include <cstdint>
 #include <cstring>
+#include <functional>
 #include <memory>
 #include <numeric>
+#include <queue>
 #include <string>
 #include <type_traits>
 #include <unordered_map>
@@ -37,6 +39,7 @@
 #include "arrow/io/caching.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/io/memory.h"
+#include "arrow/io/util_internal.h"
 #include "arrow/ipc/message.h"
 #include "arrow/ipc/metadata_internal.h"
 #include "arrow/ipc/reader_internal.h"
@@ -544,6 +547,10 @@ Result<std::shared_ptr<Buffer>> DecompressBuffer(const std::shared_ptr<Buffer>&
   return std::shared_ptr<Buffer>(std::move(uncompressed));
 }
 
+// Decompressing less than this many bytes isn't worth dispatching to the
+// thread pool
+constexpr int64_t kMinDecompressTaskSize = 256 * 1024;
+
 Status DecompressBuffers(Compression::type compression, const IpcReadOptions& options,
                          ArrayDataVector* fields) {
   struct BufferAccumulator {
@@ -572,12 +579,56 @@ Status DecompressBuffers(Compression::type compression, const IpcReadOptions& op
   std::unique_ptr<util::Codec> codec;
   ARROW_ASSIGN_OR_RAISE(codec, util::Codec::Create(compression));
 
-  return ::arrow::internal::OptionalParallelFor(
-      options.use_threads, static_cast<int>(buffers.size()), [&](int i) {
-        ARROW_ASSIGN_OR_RAISE(*buffers[i],
-                              DecompressBuffer(*buffers[i], options, codec.get()));
-        return Status::OK();
-      });
+  auto decompress = [&](std::shared_ptr<Buffer>* buffer) -> Status {
+    ARROW_ASSIGN_OR_RAISE(*buffer, DecompressBuffer(*buffer, options, codec.get()));
+    return Status::OK();
+  };
+  auto compressed_size = [](const std::shared_ptr<Buffer>* buffer) -> int64_t {
+    return *buffer ? (*buffer)->size() : 0;
+  };
+
+  int64_t total_size = 0;
+  for (const auto* buffer : buffers) {
+    total_size += compressed_size(buffer);
+  }
+  const int num_tasks = static_cast<int>(
+      std::min<int64_t>({static_cast<int64_t>(buffers.size()),
+                         total_size / kMinDecompressTaskSize,
+                         static_cast<int64_t>(GetCpuThreadPoolCapacity())}));
+  if (!options.use_threads || num_tasks <= 1) {
+    for (auto* buffer : buffers) {
+      RETURN_NOT_OK(decompress(buffer));
+    }
+    return Status::OK();
+  }
+
+  // Spread the buffers over the tasks so that they decompress about the same
+  // number of bytes, assigning the largest buffers first, each to the least
+  // loaded task.  Each task then decompresses its largest buffers first.
+  using BufferPtr = std::shared_ptr<Buffer>*;
+  std::stable_sort(buffers.begin(), buffers.end(), [&](BufferPtr a, BufferPtr b) {
+    return compressed_size(a) > compressed_size(b);
+  });
+  using TaskLoad = std::pair<int64_t, int>;
+  std::priority_queue<TaskLoad, std::vector<TaskLoad>, std::greater<TaskLoad>> loads;
+  for (int i = 0; i < num_tasks; ++i) {
+    loads.emplace(0, i);
+  }
+  std::vector<std::vector<BufferPtr>> tasks(num_tasks);
+  for (auto* buffer : buffers) {
+    auto load = loads.top();
+    loads.pop();
+    tasks[load.second].push_back(buffer);
+    load.first += compressed_size(buffer);
+    loads.push(load);
+  }
+
+  return ::arrow::internal::ParallelFor(num_tasks, [&](int i) {
+    for (auto* buffer : tasks[i]) {
+      RETURN_NOT_OK(decompress(buffer));
+    }
+    return Status::OK();
+  });
 }
 
 Result<std::shared_ptr<RecordBatch>> LoadRecordBatchSubset(
@@ -1067,7 +1118,16 @@ class RecordBatchStreamReaderImpl : public RecordBatchStreamReader,
                               const IpcReadOptions& options)
       : RecordBatchStreamReader(),
         StreamDecoderInternal(std::make_shared<CollectListener>(), options),
-        message_reader_(std::move(message_reader)) {}
+        message_reader_(std::move(message_reader)),
+        prefetch_(options.use_threads && options.prefetch_stream_messages),
+        io_context_(options.io_context) {}
+
+  ~RecordBatchStreamReaderImpl() override {
+    // The prefetch task uses the message reader
+    if (next_message_.is_valid()) {
+      next_message_.Wait();
+    }
+  }
 
   Status Init() {
     // Read schema
@@ -1088,7 +1148,7 @@ class RecordBatchStreamReaderImpl : public RecordBatchStreamReader,
     auto collect_listener = checked_cast<CollectListener*>(raw_listener());
     while (collect_listener->num_record_batches() == 0 &&
            state() != StreamDecoderInternal::State::EOS) {
-      ARROW_ASSIGN_OR_RAISE(auto message, message_reader_->ReadNextMessage());
+      ARROW_ASSIGN_OR_RAISE(auto message, ReadNextMessage());
       if (!message) {  // End of stream
         if (state() == StreamDecoderInternal::State::INITIAL_DICTIONARIES) {
           if (num_read_initial_dictionaries() == 0) {
@@ -1111,6 +1171,15 @@ class RecordBatchStreamReaderImpl : public RecordBatchStreamReader,
           return RecordBatchWithMetadata{nullptr, nullptr};
         }
       }
+      // Read the next message while this one is decompressed, unless waiting for
+      // the read could take the last thread of the IO executor
+      if (prefetch_ && !io_context_.executor()->OwnsThisThread() &&
+          IsCompressedBody(*message)) {
+        next_message_ = DeferNotOk(io::internal::SubmitIO(
+            io_context_, [this]() -> Result<std::unique_ptr<Message>> {
+              return message_reader_->ReadNextMessage();
+            }));
+      }
       ARROW_RETURN_NOT_OK(OnMessageDecoded(std::move(message)));
     }
     return collect_listener->PopRecordBatchWithMetadata();
@@ -1123,7 +1192,43 @@ class RecordBatchStreamReaderImpl : public RecordBatchStreamReader,
   ReadStats stats() const override { return StreamDecoderInternal::stats(); }
 
  private:
+  Result<std::unique_ptr<Message>> ReadNextMessage() {
+    if (next_message_.is_valid()) {
+      auto next_message = std::move(next_message_);
+      next_message_ = {};
+      return next_message.MoveResult();
+    }
+    return message_reader_->ReadNextMessage();
+  }
+
+  // Whether the message is a record batch or dictionary batch with compressed
+  // buffers, from the header verified when the message was read
+  static bool IsCompressedBody(const Message& message) {
+    const flatbuf::RecordBatch* batch = nullptr;
+    if (message.type() == MessageType::RECORD_BATCH) {
+      batch = static_cast<const flatbuf::RecordBatch*>(message.header());
+    } else if (message.type() == MessageType::DICTIONARY_BATCH) {
+      auto dictionary_batch =
+          static_cast<const flatbuf::DictionaryBatch*>(message.header());
+      batch = dictionary_batch != nullptr ? dictionary_batch->data() : nullptr;
+    }
+    if (batch == nullptr) {
+      return false;
+    }
+    if (batch->compression() != nullptr) {
+      return true;
+    }
+    // Arrow 0.17 declared compression in the custom metadata
+    const auto& custom_metadata = message.custom_metadata();
+    return custom_metadata != nullptr &&
+           custom_metadata->FindKey("ARROW:experimental_compression") != -1;
+  }
+
   std::unique_ptr<MessageReader> message_reader_;
+  const bool prefetch_;
+  const io::IOContext io_context_;
+  // The next message, being read in the background
+  Future<std::unique_ptr<Message>> next_message_;
 };
 
 // ----------------------------------------------------------------------
@@ -1339,6 +1444,7 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
     }
     ARROW_ASSIGN_OR_RAISE(auto message,
                           ReadMessageFromBlock(GetRecordBatchBlock(i), fields_loader));
+    WillNeedRecordBatch(i + 1);
 
     CHECK_HAS_BODY(*message);
     ARROW_ASSIGN_OR_RAISE(auto reader, Buffer::GetReader(message->body()));
@@ -1450,7 +1556,12 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
     if (!options_.included_fields.empty() &&
         options_.included_fields.size() != schema_->fields().size() &&
         !file_->supports_zero_copy()) {
-      RETURN_NOT_OK(state->PreBufferMetadata({}));
+      if (coalesce) {
+        // Only read the selected fields' buffers, coalesced across batches
+        RETURN_NOT_OK(state->PreBufferBatches({}, cache_options));
+      } else {
+        RETURN_NOT_OK(state->PreBufferMetadata({}));
+      }
       return SelectiveIpcFileRecordBatchGenerator(std::move(state));
     }
 
@@ -1500,6 +1611,49 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
     }
   }
 
+  Status PreBufferBatches(const std::vector<int>& indices,
+                          const io::CacheOptions& cache_options) override {
+    std::vector<int> batch_indices = indices.empty() ? AllIndices() : indices;
+    RETURN_NOT_OK(DoPreBufferMetadata(batch_indices));
+
+    std::vector<Future<std::shared_ptr<Message>>> metadatas;
+    for (int index : batch_indices) {
+      metadatas.push_back(cached_metadata_[index]);
+    }
+    // Once all the metadata is there, compute the ranges of all batches and
+    // cache them at once, so that they can be coalesced together
+    auto data_cache = std::make_shared<io::internal::ReadRangeCache>(
+        file_, file_->io_context(), cache_options);
+    using ReadContexts = std::vector<std::shared_ptr<CachedRecordBatchReadContext>>;
+    auto plan_reads = [this, batch_indices, data_cache](
+                          const std::vector<Result<std::shared_ptr<Message>>>& messages)
+        -> Result<ReadContexts> {
+      ReadContexts read_contexts;
+      std::vector<io::ReadRange> ranges;
+      for (size_t i = 0; i < messages.size(); ++i) {
+        ARROW_ASSIGN_OR_RAISE(auto message, messages[i]);
+        ARROW_ASSIGN_OR_RAISE(auto read_context,
+                              MakeReadContext(batch_indices[i], message, data_cache));
+        const auto& batch_ranges = read_context->loader.read_request().ranges_to_read();
+        ranges.insert(ranges.end(), batch_ranges.begin(), batch_ranges.end());
+        read_contexts.push_back(std::move(read_context));
+      }
+      RETURN_NOT_OK(data_cache->Cache(std::move(ranges)));
+      return read_contexts;
+    };
+    Future<ReadContexts> planned =
+        All(std::move(metadatas)).Then(std::move(plan_reads));
+    Future<> ready = planned.Then([](const ReadContexts&) {});
+    for (size_t i = 0; i < batch_indices.size(); ++i) {
+      auto read_context = planned.Then(
+          [i](const ReadContexts& read_contexts) { return read_contexts[i]; });
+      planned_reads_[batch_indices[i]] =
+          PlannedReads{data_cache, ready, std::move(read_context),
+                       std::make_shared<std::atomic<bool>>(false)};
+    }
+    return Status::OK();
+  }
+
  private:
   friend class WholeIpcFileRecordBatchGenerator;
 
@@ -1524,6 +1678,18 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
     }
   };
 
+  // Let a memory-mapped file page in the given record batch ahead of time
+  // (record batches are typically read in order).  This is only a hint, so
+  // errors (such as an invalid block) are left to the actual read.
+  void WillNeedRecordBatch(int i) {
+    if (i >= num_record_batches() || !file_->supports_zero_copy()) {
+      return;
+    }
+    FileBlock block = GetRecordBatchBlock(i);
+    ARROW_UNUSED(
+        file_->WillNeed({{block.offset, block.metadata_length + block.body_length}}));
+  }
+
   FileBlock GetRecordBatchBlock(int i) const {
     return FileBlockFromFlatbuffer(footer_->recordBatches()->Get(i));
   }
@@ -1656,18 +1822,24 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
   }
 
   struct CachedRecordBatchReadContext {
-    CachedRecordBatchReadContext(std::shared_ptr<Schema> sch,
-                                 const flatbuf::RecordBatch* batch,
-                                 IpcReadContext context, io::RandomAccessFile* file,
-                                 std::shared_ptr<io::RandomAccessFile> owned_file,
-                                 int64_t block_data_offset)
+    // If `planned_cache` is given, the batch's ranges have already been
+    // cached there by PreBufferBatches
+    CachedRecordBatchReadContext(
+        std::shared_ptr<Schema> sch, const flatbuf::RecordBatch* batch,
+        IpcReadContext context, io::RandomAccessFile* file,
+        std::shared_ptr<io::RandomAccessFile> owned_file, int64_t block_data_offset,
+        std::shared_ptr<io::internal::ReadRangeCache> planned_cache = nullptr)
         : schema(std::move(sch)),
           context(std::move(context)),
           file(file),
           owned_file(std::move(owned_file)),
           loader(batch, context.metadata_version, context.options, block_data_offset),
           columns(schema->num_fields()),
-          cache(file, file->io_context(), io::CacheOptions::LazyDefaults()),
+          ranges_cached(planned_cache != nullptr),
+          cache(planned_cache ? std::move(planned_cache)
+                              : std::make_shared<io::internal::ReadRangeCache>(
+                                    file, file->io_context(),
+                                    io::CacheOptions::LazyDefaults())),
           length(batch->length()) {}
 
     Status CalculateLoadRequest() {
@@ -1704,14 +1876,16 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
     }
 
     Future<> ReadAsync() {
-      RETURN_NOT_OK(cache.Cache(loader.read_request().ranges_to_read()));
-      return cache.WaitFor(loader.read_request().ranges_to_read());
+      if (!ranges_cached) {
+        RETURN_NOT_OK(cache->Cache(loader.read_request().ranges_to_read()));
+      }
+      return cache->WaitFor(loader.read_request().ranges_to_read());
     }
 
     Result<std::shared_ptr<RecordBatch>> CreateRecordBatch() {
       std::vector<std::shared_ptr<Buffer>> buffers;
       for (const auto& range_to_read : loader.read_request().ranges_to_read()) {
-        ARROW_ASSIGN_OR_RAISE(auto buffer, cache.Read(range_to_read));
+        ARROW_ASSIGN_OR_RAISE(auto buffer, cache->Read(range_to_read));
         buffers.push_back(std::move(buffer));
       }
       loader.read_request().FulfillRequest(buffers);
@@ -1750,7 +1924,8 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
 
     ArrayLoader loader;
     ArrayDataVector columns;
-    io::internal::ReadRangeCache cache;
+    bool ranges_cached;
+    std::shared_ptr<io::internal::ReadRangeCache> cache;
     int64_t length;
     ArrayDataVector filtered_columns;
     FieldVector filtered_fields;
@@ -1758,23 +1933,50 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
     std::vector<bool> inclusion_mask;
   };
 
+  // Compute the ranges of the buffers to read for a record batch
+  Result<std::shared_ptr<CachedRecordBatchReadContext>> MakeReadContext(
+      int index, const std::shared_ptr<Message>& message_obj,
+      std::shared_ptr<io::internal::ReadRangeCache> planned_cache) {
+    FileBlock block = GetRecordBatchBlock(index);
+    ARROW_ASSIGN_OR_RAISE(auto message, GetFlatbufMessage(message_obj));
+    ARROW_ASSIGN_OR_RAISE(auto batch, GetBatchFromMessage(message));
+    ARROW_ASSIGN_OR_RAISE(auto context, GetIpcReadContext(message, batch));
+
+    auto read_context = std::make_shared<CachedRecordBatchReadContext>(
+        schema_, batch, std::move(context), file_, owned_file_,
+        block.offset + static_cast<int64_t>(block.metadata_length),
+        std::move(planned_cache));
+    RETURN_NOT_OK(read_context->CalculateLoadRequest());
+    return read_context;
+  }
+
   Future<std::shared_ptr<RecordBatch>> ReadCachedRecordBatch(
       int index, Future<std::shared_ptr<Message>> message_fut) {
     stats_.num_record_batches.fetch_add(1, std::memory_order_relaxed);
+    PlannedReads planned;
+    auto it = planned_reads_.find(index);
+    if (it != planned_reads_.end()) {
+      planned = it->second;
+      if (!planned.read_context_used->exchange(true)) {
+        // First read of the batch: reuse the context its ranges were planned with
+        return dictionary_load_finished_
+            .Then([planned] { return planned.read_context; })
+            .Then([](const std::shared_ptr<CachedRecordBatchReadContext>& read_context)
+                      -> Future<std::shared_ptr<RecordBatch>> {
+              return read_context->ReadAsync().Then(
+                  [read_context] { return read_context->CreateRecordBatch(); });
+            });
+      }
+    } else {
+      planned.ready = Future<>::MakeFinished();
+    }
     return dictionary_load_finished_.Then([message_fut] { return message_fut; })
-        .Then([this, index](const std::shared_ptr<Message>& message_obj)
+        .Then([this, index, planned](const std::shared_ptr<Message>& message_obj)
                   -> Future<std::shared_ptr<RecordBatch>> {
-          FileBlock block = GetRecordBatchBlock(index);
-          ARROW_ASSIGN_OR_RAISE(auto message, GetFlatbufMessage(message_obj));
-          ARROW_ASSIGN_OR_RAISE(auto batch, GetBatchFromMessage(message));
-          ARROW_ASSIGN_OR_RAISE(auto context, GetIpcReadContext(message, batch));
-
-          auto read_context = std::make_shared<CachedRecordBatchReadContext>(
-              schema_, batch, std::move(context), file_, owned_file_,
-              block.offset + static_cast<int64_t>(block.metadata_length));
-          RETURN_NOT_OK(read_context->CalculateLoadRequest());
-          return read_context->ReadAsync().Then(
-              [read_context] { return read_context->CreateRecordBatch(); });
+          ARROW_ASSIGN_OR_RAISE(auto read_context,
+                                MakeReadContext(index, message_obj, planned.cache));
+          return planned.ready.Then([read_context] { return read_context->ReadAsync(); })
+              .Then([read_context] { return read_context->CreateRecordBatch(); });
         });
   }
 
@@ -1874,6 +2076,18 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
   std::unordered_map<int, Future<std::shared_ptr<Message>>> cached_metadata_;
   std::unordered_map<int, Future<>> cached_data_requests_;
 
+  // The reads planned by PreBufferBatches
+  struct PlannedReads {
+    std::shared_ptr<io::internal::ReadRangeCache> cache;
+    // Finished once the batch's ranges are in the cache
+    Future<> ready;
+    // The context the batch's ranges were computed with.  A context can only
+    // create one record batch, so further reads of the batch make their own.
+    Future<std::shared_ptr<CachedRecordBatchReadContext>> read_context;
+    std::shared_ptr<std::atomic<bool>> read_context_used;
+  };
+  std::unordered_map<int, PlannedReads> planned_reads_;
+
   bool swap_endian_;
 };
 
@@ -215,6 +215,31 @@ class ARROW_EXPORT RecordBatchFileReader
   ///                If empty then all batches will be prefetched.
   virtual Status PreBufferMetadata(const std::vector<int>& indices) = 0;
 
+  /// \brief Begin loading the data of the desired batches into memory.
+  ///
+  /// This first pre-buffers the batches' metadata, as PreBufferMetadata does.
+  /// From that metadata, it then computes the byte ranges of the buffers
+  /// needed by the selected fields (IpcReadOptions::included_fields), and
+  /// issues them through a single read cache, so that nearby ranges are
+  /// coalesced across batches according to `cache_options`.  With a lazy
+  /// cache, the ranges are fetched as the batches are read, up to
+  /// `cache_options.prefetch_limit` ranges ahead; otherwise they are all
+  /// fetched immediately in the background.
+  ///
+  /// Batches are then read as usual, for example through ReadRecordBatch.
+  /// The pre-buffered data is kept until the reader is destroyed or this
+  /// method is called again.
+  ///
+  /// \param indices Indices of the batches to prefetch
+  ///                If empty then all batches will be prefetched.
+  /// \param cache_options Options for coalescing the reads
+  /// \return NotImplemented unless overridden by the implementation
+  virtual Status PreBufferBatches(
+      const std::vector<int>& indices,
+      const io::CacheOptions& cache_options = io::CacheOptions::LazyDefaults()) {
+    return Status::NotImplemented("PreBufferBatches is not supported by this reader");
+  }
+
   /// \brief Get a reentrant generator of record batches.
   ///
   /// \param[in] coalesce If true, enable I/O coalescing.
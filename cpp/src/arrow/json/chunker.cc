@@ -27,6 +27,8 @@
 
 #include "arrow/buffer.h"
 #include "arrow/json/options.h"
+#include "arrow/json/structural_index_internal.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/logging.h"
 
 namespace arrow {
@@ -167,11 +169,102 @@ class ParsingBoundaryFinder : public BoundaryFinder {
   }
 };
 
+// Finds the ends of top-level objects (or arrays) by tracking the nesting depth
+// across the brackets located by a StructuralScanner.
+class ValueEndScanner {
+ public:
+  // Scan `data` (which continues any data scanned before), calling `visit` with
+  // the offset just past each top-level value completed until it returns false.
+  // Returns false if a closing bracket without matching opening one is found.
+  template <typename Visitor>
+  bool Scan(string_view data, Visitor&& visit) {
+    const auto bytes = reinterpret_cast<const uint8_t*>(data.data());
+    const auto size = static_cast<int64_t>(data.size());
+    constexpr int64_t kBlockSize = internal::StructuralScanner::kBlockSize;
+    for (int64_t offset = 0; offset < size; offset += kBlockSize) {
+      const int64_t length = std::min(kBlockSize, size - offset);
+      uint64_t brackets = length == kBlockSize
+                              ? scanner_.Next(bytes + offset).brackets
+                              : scanner_.NextPartial(bytes + offset, length).brackets;
+      while (brackets != 0) {
+        const int64_t pos = offset + bit_util::CountTrailingZeros(brackets);
+        brackets &= brackets - 1;
+        const char c = data[pos];
+        if (c == '{' || c == '[') {
+          ++depth_;
+        } else if (--depth_ == 0) {
+          if (!visit(pos + 1)) {
+            return true;
+          }
+        } else if (ARROW_PREDICT_FALSE(depth_ < 0)) {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+
+ private:
+  internal::StructuralScanner scanner_;
+  int64_t depth_ = 0;
+};
+
+// A BoundaryFinder implementation that assumes JSON objects can contain raw newlines,
+// and delimits them using the structural scan of ParseOptions::use_structural_index.
+class StructuralBoundaryFinder : public BoundaryFinder {
+ public:
+  Status FindFirst(string_view partial, string_view block, int64_t* out_pos) override {
+    int64_t num_found;
+    return FindNth(partial, block, 1, out_pos, &num_found);
+  }
+
+  Status FindLast(string_view block, int64_t* out_pos) override {
+    int64_t last_end = kNoDelimiterFound;
+    ValueEndScanner scanner;
+    // Unbalanced brackets are left to the parser, as with an incomplete object
+    scanner.Scan(block, [&](int64_t end) {
+      last_end = end;
+      return true;
+    });
+    if (last_end != kNoDelimiterFound) {
+      last_end += ConsumeWhitespace(block.substr(last_end));
+    }
+    *out_pos = last_end;
+    return Status::OK();
+  }
+
+  Status FindNth(string_view partial, string_view block, int64_t count,
+                 int64_t* out_pos, int64_t* num_found) override {
+    ValueEndScanner scanner;
+    bool partial_complete = false;
+    if (!scanner.Scan(partial, [&](int64_t) {
+          partial_complete = true;
+          return false;
+        }) ||
+        partial_complete) {
+      return Status::Invalid("JSON chunk error: invalid data at end of document");
+    }
+    int64_t found = 0;
+    int64_t pos = kNoDelimiterFound;
+    if (!scanner.Scan(block, [&](int64_t end) {
+          pos = end;
+          return ++found < count;
+        })) {
+      return Status::Invalid("JSON chunk error: invalid data at end of document");
+    }
+    *out_pos = pos;
+    *num_found = found;
+    return Status::OK();
+  }
+};
+
 }  // namespace
 
 std::unique_ptr<Chunker> MakeChunker(const ParseOptions& options) {
   std::shared_ptr<BoundaryFinder> delimiter;
-  if (options.newlines_in_values) {
+  if (options.newlines_in_values && options.use_structural_index) {
+    delimiter = std::make_shared<StructuralBoundaryFinder>();
+  } else if (options.newlines_in_values) {
     delimiter = std::make_shared<ParsingBoundaryFinder>();
   } else {
     delimiter = MakeNewlineBoundaryFinder();
@@ -16,6 +16,7 @@
 // under the License.
 
 #include <algorithm>
+#include <iterator>
 #include <memory>
 #include <numeric>
 #include <string>
@@ -175,9 +176,11 @@ void AssertStraddledChunking(Chunker& chunker, const std::shared_ptr<Buffer>& bu
   ASSERT_NE(length, 0);
 }
 
-std::unique_ptr<Chunker> MakeChunker(bool newlines_in_values) {
+std::unique_ptr<Chunker> MakeChunker(bool newlines_in_values,
+                                     bool use_structural_index = false) {
   auto options = ParseOptions::Defaults();
   options.newlines_in_values = newlines_in_values;
+  options.use_structural_index = use_structural_index;
   return MakeChunker(options);
 }
 
@@ -276,6 +279,77 @@ TEST(ChunkerTest, Errors) {
               ::testing::StartsWith("JSON chunk error: invalid data at end of document"));
 }
 
+TEST(StructuralChunkerTest, Basics) {
+  auto chunker = MakeChunker(true, /*use_structural_index=*/true);
+  AssertChunking(*chunker, join(lines(), "\n"), object_count);
+  AssertChunking(*chunker, join(lines(), ""), object_count);
+  for (int64_t block_size = min_block_size; block_size < min_block_size + 30;
+       ++block_size) {
+    AssertChunkingBlockSize(*chunker, join(lines(), "\r\n", false), block_size,
+                            object_count);
+  }
+}
+
+TEST(StructuralChunkerTest, PrettyPrinted) {
+  std::string pretty[object_count];
+  std::transform(std::begin(lines()), std::end(lines()), std::begin(pretty), PrettyPrint);
+  auto chunker = MakeChunker(true, /*use_structural_index=*/true);
+  AssertChunking(*chunker, join(pretty, "\n"), object_count);
+  AssertStraddledChunking(*chunker, join(pretty, "\n"));
+}
+
+TEST(StructuralChunkerTest, BracketsInStrings) {
+  // Strings with brackets and escaped quotes, long enough to span several of the
+  // 64-byte blocks scanned at a time
+  std::vector<std::string> objects;
+  std::string all;
+  std::vector<int64_t> ends;
+  for (int i = 0; i < 8; ++i) {
+    const char* pieces[] = {"}", "]", "\\\"", "{[", "\\\\"};
+    std::string value;
+    for (int j = 0; j < 10 * i; ++j) {
+      value += pieces[j % 5];
+    }
+    all += R"({"a": [{"b": ")" + value + "\"}],\n\"c\": \"\\\\\"}";
+    ends.push_back(static_cast<int64_t>(all.size()));
+    all += "\n";
+  }
+  auto buffer = Buffer::FromString(all);
+  auto chunker = MakeChunker(true, /*use_structural_index=*/true);
+  for (int64_t split = 1; split < buffer->size(); ++split) {
+    ARROW_SCOPED_TRACE("split = ", split);
+    std::shared_ptr<Buffer> whole, partial, completion, rest;
+    ASSERT_OK(chunker->Process(SliceBuffer(buffer, 0, split), &whole, &partial));
+    auto next_end = std::upper_bound(ends.begin(), ends.end(), split);
+    if (next_end == ends.begin()) {
+      ASSERT_EQ(whole->size(), 0);
+    } else {
+      // Whole objects and the newline after them
+      ASSERT_EQ(whole->size(), std::min(split, *std::prev(next_end) + 1));
+    }
+    if (partial->size() == 0 || next_end == ends.end()) {
+      continue;
+    }
+    ASSERT_OK(chunker->ProcessWithPartial(partial, SliceBuffer(buffer, split),
+                                          &completion, &rest));
+    ASSERT_EQ(split + completion->size(), *next_end);
+  }
+}
+
+TEST(StructuralChunkerTest, Errors) {
+  std::string parts[] = {R"({"a":0})", "}", R"({"a":1})"};
+  auto chunker = MakeChunker(true, /*use_structural_index=*/true);
+  std::shared_ptr<Buffer> whole, rest, completion;
+  ASSERT_OK(chunker->Process(Buffer::FromString(parts[0] + parts[1]), &whole, &rest));
+  ASSERT_EQ(std::string_view(*whole), parts[0]);
+  ASSERT_EQ(std::string_view(*rest), parts[1]);
+  auto status =
+      chunker->ProcessWithPartial(rest, Buffer::FromString(parts[2]), &completion, &rest);
+  ASSERT_RAISES(Invalid, status);
+  EXPECT_THAT(status.message(),
+              ::testing::StartsWith("JSON chunk error: invalid data at end of document"));
+}
+
 TEST_P(BaseChunkerTest, StraddlingEmpty) {
   auto all = join(lines(), "\n");
 
@@ -20,7 +20,9 @@
 #include <cstdint>
 #include <memory>
 
+#include "arrow/io/interfaces.h"
 #include "arrow/json/type_fwd.h"
+#include "arrow/status.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -53,6 +55,14 @@ struct ARROW_EXPORT ParseOptions {
   /// How JSON fields outside of explicit_schema (if given) are treated
   UnexpectedFieldBehavior unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
 
+  /// Whether to parse from a structural index rather than with RapidJSON's reader
+  ///
+  /// Each block is first scanned (with SIMD instructions where available) for
+  /// quotes, escapes and structural characters, then values are built from the
+  /// positions found.  When newlines_in_values is true, object boundaries are
+  /// located with the same scan.
+  bool use_structural_index = false;
+
   /// Create parsing options with default values
   static ParseOptions Defaults();
 };
@@ -70,5 +80,33 @@ struct ARROW_EXPORT ReadOptions {
   static ReadOptions Defaults();
 };
 
+struct ARROW_EXPORT WriteOptions {
+  // Writer options
+
+  /// \brief Maximum number of rows processed at a time
+  ///
+  /// The JSON writer converts and writes data in batches of N rows.
+  int32_t batch_size = 1024;
+
+  /// \brief Whether to use the global CPU thread pool
+  ///
+  /// If true, up to one slice of `batch_size` rows per CPU thread is converted to
+  /// JSON lines at a time, and the lines are written in row order.  Writing blocks
+  /// on those conversions, so leave this off when writing from a task running on
+  /// the CPU thread pool.
+  bool use_threads = false;
+
+  /// \brief IO context for writing
+  ///
+  /// The JSON text of each slice is buffered in memory allocated from its pool.
+  io::IOContext io_context;
+
+  /// Create write options with default values
+  static WriteOptions Defaults();
+
+  /// \brief Test that all set options are valid
+  Status Validate() const;
+};
+
 }  // namespace json
 }  // namespace arrow
@@ -34,6 +34,7 @@
 #include "arrow/array.h"
 #include "arrow/array/builder_binary.h"
 #include "arrow/buffer_builder.h"
+#include "arrow/json/structural_index_internal.h"
 #include "arrow/type.h"
 #include "arrow/util/bitset_stack.h"
 #include "arrow/util/checked_cast.h"
@@ -727,11 +728,12 @@ class HandlerBase : public BlockParser,
   }
   /// @}
 
-  /// \brief Set up builders using an expected Schema
-  Status Initialize(const std::shared_ptr<Schema>& s) {
+  /// \brief Set up builders using the expected Schema, if any
+  Status Initialize(const ParseOptions& options) {
+    use_structural_index_ = options.use_structural_index;
     auto type = struct_({});
-    if (s) {
-      type = struct_(s->fields());
+    if (options.explicit_schema) {
+      type = struct_(options.explicit_schema->fields());
     }
     return builder_set_.MakeBuilder(*type, 0, &builder_);
   }
@@ -793,9 +795,36 @@ class HandlerBase : public BlockParser,
     return Status::Invalid("Row count overflowed int32_t");
   }
 
+  template <typename Handler>
+  Status DoParseStructural(Handler& handler, std::string_view json) {
+    RETURN_NOT_OK(structural_index_.Build(json));
+    internal::StructuralParser<Handler> parser(structural_index_, json);
+    using Code = typename internal::StructuralParser<Handler>::Code;
+    // ensure that the loop can exit when the block too large.
+    for (; num_rows_ < std::numeric_limits<int32_t>::max(); ++num_rows_) {
+      switch (parser.Parse(handler)) {
+        case Code::kValue:
+          // parse the next object
+          continue;
+        case Code::kEnd:
+          // parsed all objects, finish
+          return Status::OK();
+        case Code::kHandlerError:
+          // handler emitted an error
+          return handler.Error();
+        case Code::kSyntaxError:
+          return ParseError(parser.error(), " in row ", num_rows_);
+      }
+    }
+    return Status::Invalid("Row count overflowed int32_t");
+  }
+
   template <typename Handler>
   Status DoParse(Handler& handler, const std::shared_ptr<Buffer>& json) {
     RETURN_NOT_OK(ReserveScalarStorage(json->size()));
+    if (use_structural_index_) {
+      return DoParseStructural(handler, std::string_view(*json));
+    }
     rj::MemoryStream ms(reinterpret_cast<const char*>(json->data()), json->size());
     using InputStream = rj::EncodedInputStream<rj::UTF8<>, rj::MemoryStream>;
     return DoParse(handler, InputStream(ms), static_cast<size_t>(json->size()));
@@ -941,6 +970,8 @@ class HandlerBase : public BlockParser,
   // top of this stack == field_index_
   std::vector<int> field_index_stack_;
   StringBuilder scalar_values_builder_;
+  bool use_structural_index_ = false;
+  internal::StructuralIndex structural_index_;
 };
 
 template <UnexpectedFieldBehavior>
@@ -1187,7 +1218,7 @@ Status BlockParser::Make(MemoryPool* pool, const ParseOptions& options,
       *out = std::make_unique<Handler<UnexpectedFieldBehavior::InferType>>(pool);
       break;
   }
-  return static_cast<HandlerBase&>(**out).Initialize(options.explicit_schema);
+  return static_cast<HandlerBase&>(**out).Initialize(options);
 }
 
 Status BlockParser::Make(const ParseOptions& options, std::unique_ptr<BlockParser>* out) {
@@ -97,18 +97,30 @@ static void BenchmarkJSONChunking(benchmark::State& state,  // NOLINT non-const
   state.counters["json_size"] = static_cast<double>(json->size());
 }
 
-static void ChunkJSONPrettyPrinted(
-    benchmark::State& state) {  // NOLINT non-const reference
+static void BenchmarkChunkJSONPrettyPrinted(
+    benchmark::State& state,  // NOLINT non-const reference
+    bool use_structural_index) {
   const int32_t num_rows = 5000;
 
   auto options = ParseOptions::Defaults();
   options.newlines_in_values = true;
+  options.use_structural_index = use_structural_index;
   options.explicit_schema = schema(TestFields());
 
   auto json = GenerateTestData(options.explicit_schema, num_rows, /*pretty=*/true);
   BenchmarkJSONChunking(state, std::make_shared<Buffer>(json), options);
 }
 
+static void ChunkJSONPrettyPrinted(
+    benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkChunkJSONPrettyPrinted(state, false);
+}
+
+static void ChunkJSONPrettyPrintedStructuralIndex(
+    benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkChunkJSONPrettyPrinted(state, true);
+}
+
 static void ChunkJSONLineDelimited(
     benchmark::State& state) {  // NOLINT non-const reference
   const int32_t num_rows = 5000;
@@ -137,17 +149,29 @@ static void BenchmarkJSONParsing(benchmark::State& state,  // NOLINT non-const r
   state.counters["json_size"] = static_cast<double>(json->size());
 }
 
-static void ParseJSONBlockWithSchema(
-    benchmark::State& state) {  // NOLINT non-const reference
+static void BenchmarkParseJSONBlockWithSchema(
+    benchmark::State& state,  // NOLINT non-const reference
+    bool use_structural_index) {
   const int32_t num_rows = 5000;
   auto options = ParseOptions::Defaults();
   options.unexpected_field_behavior = UnexpectedFieldBehavior::Error;
+  options.use_structural_index = use_structural_index;
   options.explicit_schema = schema(TestFields());
 
   auto json = GenerateTestData(options.explicit_schema, num_rows);
   BenchmarkJSONParsing(state, std::make_shared<Buffer>(json), options);
 }
 
+static void ParseJSONBlockWithSchema(
+    benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkParseJSONBlockWithSchema(state, false);
+}
+
+static void ParseJSONBlockWithSchemaStructuralIndex(
+    benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkParseJSONBlockWithSchema(state, true);
+}
+
 static void BenchmarkJSONReading(benchmark::State& state,  // NOLINT non-const reference
                                  const std::string& json, ReadOptions read_options,
                                  ParseOptions parse_options) {
@@ -167,13 +191,14 @@ static void BenchmarkJSONReading(benchmark::State& state,  // NOLINT non-const r
 
 static void BenchmarkReadJSONBlockWithSchema(
     benchmark::State& state,  // NOLINT non-const reference
-    bool use_threads) {
+    bool use_threads, bool use_structural_index = false) {
   const int32_t num_rows = 500000;
   auto read_options = ReadOptions::Defaults();
   read_options.use_threads = use_threads;
 
   auto parse_options = ParseOptions::Defaults();
   parse_options.unexpected_field_behavior = UnexpectedFieldBehavior::Error;
+  parse_options.use_structural_index = use_structural_index;
   parse_options.explicit_schema = schema(TestFields());
 
   auto json = GenerateTestData(parse_options.explicit_schema, num_rows);
@@ -190,7 +215,14 @@ static void ReadJSONBlockWithSchemaMultiThread(
   BenchmarkReadJSONBlockWithSchema(state, true);
 }
 
-static void ParseJSONFields(benchmark::State& state) {  // NOLINT non-const reference
+static void ReadJSONBlockWithSchemaSingleThreadStructuralIndex(
+    benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkReadJSONBlockWithSchema(state, false, /*use_structural_index=*/true);
+}
+
+static void BenchmarkParseJSONFields(
+    benchmark::State& state,  // NOLINT non-const reference
+    bool use_structural_index) {
   const bool ordered = !!state.range(0);
   const bool with_schema = !!state.range(1);
   const double sparsity = state.range(2) / 100.0;
@@ -205,6 +237,7 @@ static void ParseJSONFields(benchmark::State& state) {  // NOLINT non-const refe
   auto fields = GenerateTestFields(num_fields, 10);
 
   auto parse_options = ParseOptions::Defaults();
+  parse_options.use_structural_index = use_structural_index;
   if (with_schema) {
     parse_options.explicit_schema = schema(fields);
     parse_options.unexpected_field_behavior = UnexpectedFieldBehavior::Error;
@@ -218,17 +251,32 @@ static void ParseJSONFields(benchmark::State& state) {  // NOLINT non-const refe
   BenchmarkJSONParsing(state, std::make_shared<Buffer>(json), parse_options);
 }
 
+static void ParseJSONFields(benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkParseJSONFields(state, false);
+}
+
+static void ParseJSONFieldsStructuralIndex(
+    benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkParseJSONFields(state, true);
+}
+
 BENCHMARK(ChunkJSONPrettyPrinted);
+BENCHMARK(ChunkJSONPrettyPrintedStructuralIndex);
 BENCHMARK(ChunkJSONLineDelimited);
 BENCHMARK(ParseJSONBlockWithSchema);
+BENCHMARK(ParseJSONBlockWithSchemaStructuralIndex);
 
 BENCHMARK(ReadJSONBlockWithSchemaSingleThread);
+BENCHMARK(ReadJSONBlockWithSchemaSingleThreadStructuralIndex);
 BENCHMARK(ReadJSONBlockWithSchemaMultiThread)->UseRealTime();
 
 BENCHMARK(ParseJSONFields)
     // NOTE: "sparsity" is the percentage of missing fields
     ->ArgNames({"ordered", "schema", "sparsity", "num_fields"})
     ->ArgsProduct({{1, 0}, {1, 0}, {0, 10, 90}, {10, 100, 1000}});
+BENCHMARK(ParseJSONFieldsStructuralIndex)
+    ->ArgNames({"ordered", "schema", "sparsity", "num_fields"})
+    ->ArgsProduct({{1, 0}, {1, 0}, {0, 10, 90}, {10, 100, 1000}});
 
 }  // namespace json
 }  // namespace arrow
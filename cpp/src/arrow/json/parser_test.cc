@@ -321,5 +321,122 @@ TEST(BlockParser, AdHoc) {
        R"([{"c":true, "d": "1991-02-03"}, {"c":false, "d":"2019-04-01"}])"});
 }
 
+class BlockParserStructuralIndex
+    : public ::testing::TestWithParam<UnexpectedFieldBehavior> {
+ public:
+  ParseOptions Options(std::shared_ptr<Schema> explicit_schema = nullptr) {
+    auto options = ParseOptions::Defaults();
+    options.explicit_schema = std::move(explicit_schema);
+    options.unexpected_field_behavior = GetParam();
+    if (options.explicit_schema == nullptr) {
+      options.unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
+    }
+    return options;
+  }
+
+  // Both parsers append the same values in the same order, so their unconverted
+  // output should be identical
+  void AssertSameAsRapidJSON(ParseOptions options, string_view src_str) {
+    std::shared_ptr<Array> expected, actual;
+    options.use_structural_index = false;
+    ASSERT_OK(ParseFromString(options, src_str, &expected));
+    options.use_structural_index = true;
+    ASSERT_OK(ParseFromString(options, src_str, &actual));
+    AssertArraysEqual(*expected, *actual, /*verbose=*/true);
+  }
+
+  Status ParseWithStructuralIndex(ParseOptions options, string_view src_str) {
+    options.use_structural_index = true;
+    std::shared_ptr<Array> parsed;
+    return ParseFromString(options, src_str, &parsed);
+  }
+};
+
+TEST_P(BlockParserStructuralIndex, Sources) {
+  for (const auto& src : {scalars_only_src(), nested_src(), null_src(),
+                          unquoted_decimal_src(), mixed_decimal_src()}) {
+    ARROW_SCOPED_TRACE(src);
+    AssertSameAsRapidJSON(Options(), src);
+  }
+  FieldVector scalars_fields = {field("hello", float64()), field("world", boolean()),
+                                field("yo", utf8())};
+  AssertSameAsRapidJSON(Options(schema(scalars_fields)), scalars_only_src());
+  auto nested_fields = scalars_fields;
+  nested_fields.push_back(field("arr", list(int32())));
+  nested_fields.push_back(field("nuf", struct_({field("ps", int32())})));
+  AssertSameAsRapidJSON(Options(schema(nested_fields)), nested_src());
+}
+
+TEST_P(BlockParserStructuralIndex, Strings) {
+  // Escapes, and structural characters within strings
+  AssertSameAsRapidJSON(Options(schema({field("a", utf8())})), R"(
+    {"a": "\"{[quoted]}\", \\ \/ \b\f\n\r\t"}
+    {"a": "\u0041\u00e9\u5fcd\ud83d\ude00 \\\" \\\\"}
+    {"a": ":,}"}
+    {"a": ""}
+  )");
+  // Escaped keys
+  AssertSameAsRapidJSON(Options(), R"({"\u0061": 1, "b\"": 2})");
+}
+
+TEST_P(BlockParserStructuralIndex, LongValues) {
+  // Values straddling the 64-byte blocks of the structural scan
+  std::string src, pretty_src;
+  for (int i = 0; i < 200; ++i) {
+    std::string value(i, 'x');
+    for (int j = 0; j < i; j += 3) value[j] = "{}[]:, "[j % 7];
+    for (int j = 5; j + 1 < i; j += 11) value.replace(j, 2, "\\\"");
+    auto row = "{\"a\":\"" + value + "\",\"b\":[" + std::to_string(i) + ",-" +
+               std::to_string(i) + ".5e3],\"c\":" + (i % 2 ? "true" : "null") + "}";
+    src += row + "\n";
+    pretty_src += PrettyPrint(row) + "\n";
+  }
+  auto options = Options(schema(
+      {field("a", utf8()), field("b", list(float64())), field("c", boolean())}));
+  AssertSameAsRapidJSON(options, src);
+  AssertSameAsRapidJSON(options, pretty_src);
+}
+
+TEST_P(BlockParserStructuralIndex, TypeErrors) {
+  auto status = ParseWithStructuralIndex(Options(schema({field("a", int32())})),
+                                         "{\"a\":0}\n{\"a\":true}");
+  ASSERT_RAISES(Invalid, status);
+  EXPECT_THAT(
+      status.message(),
+      testing::StartsWith(
+          "JSON parse error: Column(/a) changed from number to boolean in row 1"));
+
+  status = ParseWithStructuralIndex(Options(schema({field("a", int32())})),
+                                    "{\"a\":0, \"a\":1}\n");
+  ASSERT_RAISES(Invalid, status);
+  EXPECT_THAT(
+      status.message(),
+      testing::StartsWith("JSON parse error: Column(/a) was specified twice in row 0"));
+}
+
+TEST_P(BlockParserStructuralIndex, SyntaxErrors) {
+  auto options = Options(schema({field("a", int32()), field("b", list(int32()))}));
+  auto check = [&](string_view src_str, const std::string& expected_message) {
+    ARROW_SCOPED_TRACE(src_str);
+    auto status = ParseWithStructuralIndex(options, src_str);
+    ASSERT_RAISES(Invalid, status);
+    EXPECT_THAT(status.message(), testing::StartsWith(expected_message));
+  };
+  check("}", "JSON parse error: The document is empty");
+  check("{\"a\":0}\n{\"a\" 0}", "JSON parse error: Missing a colon");
+  check("{\"a\":0,}", "JSON parse error: Missing a name for object member. in row 0");
+  check("{\"a\":0}\n{\"a\":tru}", "JSON parse error: Invalid value. in row 1");
+  check("{\"a\":1.}", "JSON parse error: Miss fraction part in number.");
+  check("{\"a\":\"unterminated}", "JSON parse error: Missing a closing quotation mark");
+  check("{\"a\":\"\\q\"}", "JSON parse error: Invalid escape character in string.");
+  check("{\"a\":\"\t\"}", "JSON parse error: Invalid encoding in string.");
+  check("{\"b\":[1 2]}", "JSON parse error: Missing a comma or ']'");
+}
+
+INSTANTIATE_TEST_SUITE_P(BlockParserStructuralIndex, BlockParserStructuralIndex,
+                         ::testing::Values(UnexpectedFieldBehavior::Ignore,
+                                           UnexpectedFieldBehavior::Error,
+                                           UnexpectedFieldBehavior::InferType));
+
 }  // namespace json
 }  // namespace arrow
@@ -0,0 +1,464 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/json/structural_index_internal.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+#include "arrow/util/bit_util.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/simd.h"
+
+namespace arrow {
+namespace json {
+namespace internal {
+
+namespace {
+
+constexpr int64_t kBlockSize = StructuralScanner::kBlockSize;
+
+// Bitmasks of the characters of interest in a 64-byte block
+struct CharacterMasks {
+  uint64_t quote = 0;
+  uint64_t backslash = 0;
+  // {}[]:,
+  uint64_t op = 0;
+  // {}[]
+  uint64_t brackets = 0;
+  uint64_t whitespace = 0;
+  // 0x00 - 0x1F
+  uint64_t control = 0;
+};
+
+#if defined(ARROW_HAVE_AVX2)
+
+struct Avx2Vector {
+  using type = __m256i;
+  static constexpr int kWidth = 32;
+
+  static type Load(const uint8_t* data) {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+  }
+  static type Set1(uint8_t c) { return _mm256_set1_epi8(static_cast<char>(c)); }
+  static type Table(const uint8_t (&t)[16]) {
+    const auto half = _mm_loadu_si128(reinterpret_cast<const __m128i*>(t));
+    return _mm256_broadcastsi128_si256(half);
+  }
+  static type Lookup(type table, type a) { return _mm256_shuffle_epi8(table, a); }
+  static type Or(type a, type b) { return _mm256_or_si256(a, b); }
+  static type Equal(type a, type b) { return _mm256_cmpeq_epi8(a, b); }
+  static type Max(type a, type b) { return _mm256_max_epu8(a, b); }
+  static uint64_t MoveMask(type a) {
+    return static_cast<uint32_t>(_mm256_movemask_epi8(a));
+  }
+};
+
+using SimdVector = Avx2Vector;
+
+#elif defined(ARROW_HAVE_SSE4_2)
+
+struct Sse42Vector {
+  using type = __m128i;
+  static constexpr int kWidth = 16;
+
+  static type Load(const uint8_t* data) {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+  }
+  static type Set1(uint8_t c) { return _mm_set1_epi8(static_cast<char>(c)); }
+  static type Table(const uint8_t (&t)[16]) {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(t));
+  }
+  static type Lookup(type table, type a) { return _mm_shuffle_epi8(table, a); }
+  static type Or(type a, type b) { return _mm_or_si128(a, b); }
+  static type Equal(type a, type b) { return _mm_cmpeq_epi8(a, b); }
+  static type Max(type a, type b) { return _mm_max_epu8(a, b); }
+  static uint64_t MoveMask(type a) {
+    return static_cast<uint16_t>(_mm_movemask_epi8(a));
+  }
+};
+
+using SimdVector = Sse42Vector;
+
+#endif
+
+#if defined(ARROW_HAVE_AVX2) || defined(ARROW_HAVE_SSE4_2)
+
+// Tables indexed by the low nibble of a byte: a byte is in the class if it is
+// equal to the entry it looks up (bytes >= 0x80 always look up zero).  Filler
+// entries have a low nibble different from their index so they never match.
+// Whitespace: ' ' (0x20), '\t' (0x09), '\n' (0x0A) and '\r' (0x0D)
+alignas(16) constexpr uint8_t kWhitespaceTable[16] = {
+    ' ', 100, 100, 100, 17, 100, 113, 2, 100, '\t', '\n', 112, 100, '\r', 100, 100};
+// Operators, after folding '[' and ']' into '{' and '}' by setting bit 0x20
+alignas(16) constexpr uint8_t kOperatorTable[16] = {0, 0, 0, 0, 0,   0,   0,   0,
+                                                    0, 0, ':', '{', ',', '}', 0, 0};
+
+CharacterMasks Classify(const uint8_t* data) {
+  using V = SimdVector;
+  const auto whitespace_table = V::Table(kWhitespaceTable);
+  const auto operator_table = V::Table(kOperatorTable);
+  const auto case_bit = V::Set1(0x20);
+  const auto open = V::Set1('{');
+  const auto close = V::Set1('}');
+  const auto quote = V::Set1('"');
+  const auto backslash = V::Set1('\\');
+  const auto max_control = V::Set1(0x1F);
+
+  CharacterMasks masks;
+  for (int offset = 0; offset < kBlockSize; offset += V::kWidth) {
+    const auto v = V::Load(data + offset);
+    const auto folded = V::Or(v, case_bit);
+    const auto op = V::Equal(V::Lookup(operator_table, v), folded);
+    const auto brackets = V::Or(V::Equal(folded, open), V::Equal(folded, close));
+    const auto whitespace = V::Equal(V::Lookup(whitespace_table, v), v);
+    masks.quote |= V::MoveMask(V::Equal(v, quote)) << offset;
+    masks.backslash |= V::MoveMask(V::Equal(v, backslash)) << offset;
+    masks.op |= V::MoveMask(op) << offset;
+    masks.brackets |= V::MoveMask(brackets) << offset;
+    masks.whitespace |= V::MoveMask(whitespace) << offset;
+    masks.control |= V::MoveMask(V::Equal(V::Max(v, max_control), max_control))
+                     << offset;
+  }
+  // The operator lookup also matches a few control characters (0x0C is folded
+  // into ',' for instance); those are never valid outside of strings anyway.
+  masks.op &= ~masks.control;
+  return masks;
+}
+
+#else
+
+enum CharacterClass : uint8_t {
+  kQuote = 1,
+  kBackslash = 2,
+  kOp = 4,
+  kBracket = 8,
+  kWhitespace = 16,
+  kControl = 32,
+};
+
+struct CharacterClassTable {
+  CharacterClassTable() {
+    std::memset(classes, 0, sizeof(classes));
+    for (int c = 0; c < 0x20; ++c) {
+      classes[c] = kControl;
+    }
+    classes['"'] = kQuote;
+    classes['\\'] = kBackslash;
+    for (uint8_t c : {'{', '}', '[', ']'}) {
+      classes[c] = kOp | kBracket;
+    }
+    classes[':'] = classes[','] = kOp;
+    for (uint8_t c : {' ', '\t', '\n', '\r'}) {
+      classes[c] |= kWhitespace;
+    }
+  }
+
+  uint8_t classes[256];
+};
+
+CharacterMasks Classify(const uint8_t* data) {
+  static const CharacterClassTable table;
+  CharacterMasks masks;
+  for (int i = 0; i < kBlockSize; ++i) {
+    const uint64_t c = table.classes[data[i]];
+    masks.quote |= (c & 1) << i;
+    masks.backslash |= ((c >> 1) & 1) << i;
+    masks.op |= ((c >> 2) & 1) << i;
+    masks.brackets |= ((c >> 3) & 1) << i;
+    masks.whitespace |= ((c >> 4) & 1) << i;
+    masks.control |= ((c >> 5) & 1) << i;
+  }
+  return masks;
+}
+
+#endif
+
+// Each bit is set to the parity of the bits at or below it
+uint64_t PrefixXor(uint64_t bits) {
+  bits ^= bits << 1;
+  bits ^= bits << 2;
+  bits ^= bits << 4;
+  bits ^= bits << 8;
+  bits ^= bits << 16;
+  bits ^= bits << 32;
+  return bits;
+}
+
+}  // namespace
+
+StructuralBlock StructuralScanner::Next(const uint8_t* data) {
+  return Finish(data, kBlockSize);
+}
+
+StructuralBlock StructuralScanner::NextPartial(const uint8_t* data, int64_t length) {
+  DCHECK_GT(length, 0);
+  DCHECK_LE(length, kBlockSize);
+  // Pad with whitespace, which doesn't affect any of the carried state
+  uint8_t padded[kBlockSize];
+  std::memset(padded, ' ', sizeof(padded));
+  std::memcpy(padded, data, static_cast<size_t>(length));
+  return Finish(padded, length);
+}
+
+StructuralBlock StructuralScanner::Finish(const uint8_t* data, int64_t length) {
+  const CharacterMasks masks = Classify(data);
+
+  // Find escaped characters: those following an odd-length run of backslashes.
+  // Backslashes are rare outside of escape-heavy data, so visit them one by one.
+  uint64_t escaped = prev_escaped_;
+  uint64_t next_escaped = 0;
+  uint64_t backslash = masks.backslash & ~prev_escaped_;
+  while (backslash != 0) {
+    const int i = bit_util::CountTrailingZeros(backslash);
+    if (i == kBlockSize - 1) {
+      next_escaped = 1;
+      break;
+    }
+    escaped |= uint64_t{1} << (i + 1);
+    // An escaped backslash doesn't escape the following character
+    backslash &= ~(uint64_t{3} << i);
+  }
+  if (length < kBlockSize) {
+    // The padding can't be escaped, except right after the last byte
+    next_escaped = (escaped >> length) & 1;
+  }
+  prev_escaped_ = next_escaped;
+
+  // Strings span from an opening quote (included) to a closing quote (excluded)
+  const uint64_t quote = masks.quote & ~escaped;
+  const uint64_t in_string = PrefixXor(quote) ^ prev_in_string_;
+  // String contents and closing quotes
+  const uint64_t string_tail = in_string ^ quote;
+
+  // A scalar begins with a quote, or with a non-operator, non-whitespace byte
+  // which doesn't continue a number or literal
+  const uint64_t scalar = ~(masks.op | masks.whitespace);
+  const uint64_t nonquote_scalar = scalar & ~quote;
+  const uint64_t follows_nonquote_scalar = (nonquote_scalar << 1) | prev_scalar_;
+  const uint64_t scalar_start = (scalar & ~follows_nonquote_scalar) | quote;
+
+  const uint64_t valid = length < kBlockSize ? (uint64_t{1} << length) - 1 : ~uint64_t{0};
+  const int last = static_cast<int>(length - 1);
+  prev_in_string_ = uint64_t{0} - ((in_string >> last) & 1);
+  prev_scalar_ = (nonquote_scalar >> last) & 1;
+
+  StructuralBlock block;
+  block.structurals = (masks.op | scalar_start) & ~string_tail & valid;
+  block.brackets = masks.brackets & ~in_string & valid;
+  block.invalid = masks.control & string_tail & valid;
+  return block;
+}
+
+Status StructuralIndex::Build(std::string_view json) {
+  const auto size = static_cast<int64_t>(json.size());
+  if (ARROW_PREDICT_FALSE(size >= std::numeric_limits<uint32_t>::max())) {
+    return Status::Invalid("JSON block of ", size, " bytes is too large to index");
+  }
+  // Every byte may begin a token, plus the terminating position
+  if (capacity_ < size + 1) {
+    positions_.reset(new uint32_t[size + 1]);
+    capacity_ = size + 1;
+  }
+
+  const auto data = reinterpret_cast<const uint8_t*>(json.data());
+  StructuralScanner scanner;
+  uint32_t* out = positions_.get();
+  first_invalid_ = -1;
+  for (int64_t offset = 0; offset < size; offset += kBlockSize) {
+    const int64_t length = std::min(kBlockSize, size - offset);
+    const StructuralBlock block = length == kBlockSize
+                                      ? scanner.Next(data + offset)
+                                      : scanner.NextPartial(data + offset, length);
+    if (ARROW_PREDICT_FALSE(block.invalid != 0 && first_invalid_ == -1)) {
+      first_invalid_ = offset + bit_util::CountTrailingZeros(block.invalid);
+    }
+    uint64_t structurals = block.structurals;
+    while (structurals != 0) {
+      *out++ = static_cast<uint32_t>(offset + bit_util::CountTrailingZeros(structurals));
+      structurals &= structurals - 1;
+    }
+  }
+  num_positions_ = out - positions_.get();
+  *out = static_cast<uint32_t>(size);
+  ends_in_string_ = scanner.in_string();
+  return Status::OK();
+}
+
+namespace {
+
+bool ParseHex4(const char* data, uint32_t* out) {
+  uint32_t value = 0;
+  for (int i = 0; i < 4; ++i) {
+    const char c = data[i];
+    value <<= 4;
+    if (c >= '0' && c <= '9') {
+      value |= c - '0';
+    } else if (c >= 'a' && c <= 'f') {
+      value |= c - 'a' + 10;
+    } else if (c >= 'A' && c <= 'F') {
+      value |= c - 'A' + 10;
+    } else {
+      return false;
+    }
+  }
+  *out = value;
+  return true;
+}
+
+void AppendUtf8(uint32_t codepoint, std::string* out) {
+  if (codepoint < 0x80) {
+    out->push_back(static_cast<char>(codepoint));
+  } else if (codepoint < 0x800) {
+    out->push_back(static_cast<char>(0xC0 | (codepoint >> 6)));
+    out->push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+  } else if (codepoint < 0x10000) {
+    out->push_back(static_cast<char>(0xE0 | (codepoint >> 12)));
+    out->push_back(static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F)));
+    out->push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+  } else {
+    out->push_back(static_cast<char>(0xF0 | (codepoint >> 18)));
+    out->push_back(static_cast<char>(0x80 | ((codepoint >> 12) & 0x3F)));
+    out->push_back(static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F)));
+    out->push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+  }
+}
+
+}  // namespace
+
+const char* UnescapeString(std::string_view escaped, std::string* out) {
+  out->clear();
+  out->reserve(escaped.size());
+  const char* p = escaped.data();
+  const char* end = p + escaped.size();
+  while (p < end) {
+    const char* backslash =
+        static_cast<const char*>(std::memchr(p, '\\', static_cast<size_t>(end - p)));
+    if (backslash == nullptr) {
+      out->append(p, end);
+      break;
+    }
+    out->append(p, backslash);
+    p = backslash + 1;
+    if (ARROW_PREDICT_FALSE(p == end)) {
+      return "Invalid escape character in string.";
+    }
+    switch (*p++) {
+      case '"':
+        out->push_back('"');
+        break;
+      case '\\':
+        out->push_back('\\');
+        break;
+      case '/':
+        out->push_back('/');
+        break;
+      case 'b':
+        out->push_back('\b');
+        break;
+      case 'f':
+        out->push_back('\f');
+        break;
+      case 'n':
+        out->push_back('\n');
+        break;
+      case 'r':
+        out->push_back('\r');
+        break;
+      case 't':
+        out->push_back('\t');
+        break;
+      case 'u': {
+        uint32_t codepoint;
+        if (ARROW_PREDICT_FALSE(end - p < 4 || !ParseHex4(p, &codepoint))) {
+          return "Incorrect hex digit after \\u escape in string.";
+        }
+        p += 4;
+        if (codepoint >= 0xD800 && codepoint <= 0xDBFF) {
+          // High surrogate, which must be followed by an escaped low surrogate
+          uint32_t low;
+          if (ARROW_PREDICT_FALSE(end - p < 6 || p[0] != '\\' || p[1] != 'u')) {
+            return "The surrogate pair in string is invalid.";
+          }
+          if (ARROW_PREDICT_FALSE(!ParseHex4(p + 2, &low))) {
+            return "Incorrect hex digit after \\u escape in string.";
+          }
+          if (ARROW_PREDICT_FALSE(low < 0xDC00 || low > 0xDFFF)) {
+            return "The surrogate pair in string is invalid.";
+          }
+          p += 6;
+          codepoint = 0x10000 + ((codepoint - 0xD800) << 10) + (low - 0xDC00);
+        } else if (ARROW_PREDICT_FALSE(codepoint >= 0xDC00 && codepoint <= 0xDFFF)) {
+          return "The surrogate pair in string is invalid.";
+        }
+        AppendUtf8(codepoint, out);
+        break;
+      }
+      default:
+        return "Invalid escape character in string.";
+    }
+  }
+  return nullptr;
+}
+
+const char* ValidateNumber(std::string_view token) {
+  const char* p = token.data();
+  const char* end = p + token.size();
+  auto is_digit = [&](const char* q) { return q < end && *q >= '0' && *q <= '9'; };
+  auto rest_is = [&](std::string_view expected) {
+    return std::string_view(p, end - p) == expected;
+  };
+
+  if (p < end && *p == '-') {
+    ++p;
+  }
+  // Accepted by rapidjson's kParseNanAndInfFlag
+  if (rest_is("NaN") || rest_is("Inf") || rest_is("Infinity")) {
+    return nullptr;
+  }
+  if (!is_digit(p)) {
+    return "Invalid value.";
+  }
+  if (*p == '0') {
+    ++p;
+  } else {
+    while (is_digit(p)) ++p;
+  }
+  if (p < end && *p == '.') {
+    ++p;
+    if (!is_digit(p)) {
+      return "Miss fraction part in number.";
+    }
+    while (is_digit(p)) ++p;
+  }
+  if (p < end && (*p == 'e' || *p == 'E')) {
+    ++p;
+    if (p < end && (*p == '+' || *p == '-')) {
+      ++p;
+    }
+    if (!is_digit(p)) {
+      return "Miss exponent in number.";
+    }
+    while (is_digit(p)) ++p;
+  }
+  return p == end ? nullptr : "Invalid value.";
+}
+
+}  // namespace internal
+}  // namespace json
+}  // namespace arrow
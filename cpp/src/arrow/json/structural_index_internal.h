@@ -0,0 +1,414 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace json {
+namespace internal {
+
+//
+// Two-stage JSON parsing in the style of simdjson.
+//
+// Stage one (StructuralScanner, StructuralIndex) classifies the input 64 bytes
+// at a time into bitmasks of quotes, backslashes, operators and whitespace and
+// derives from those which bytes lie inside string literals, without branching
+// on individual characters.  The result is the list of positions at which a
+// token begins.
+//
+// Stage two (StructuralParser) walks those positions, validates the grammar
+// and hands every value to a SAX-style handler.
+//
+
+/// \brief Bitmasks describing one 64-byte block of JSON
+struct StructuralBlock {
+  /// Bytes at which a token begins: the operators `{}[]:,` outside strings
+  /// and the first byte of every string, number or literal
+  uint64_t structurals;
+  /// Subset of `structurals` which open or close an object or array
+  uint64_t brackets;
+  /// Bytes inside string literals which JSON requires to be escaped
+  uint64_t invalid;
+};
+
+/// \brief Stage one of structural-index JSON parsing
+///
+/// Blocks must be fed in order; the scanner carries across block boundaries
+/// whether the input ended inside a string, after an escaping backslash or
+/// inside a scalar.
+class ARROW_EXPORT StructuralScanner {
+ public:
+  static constexpr int64_t kBlockSize = 64;
+
+  /// \brief Classify the kBlockSize bytes starting at `data`
+  StructuralBlock Next(const uint8_t* data);
+
+  /// \brief Classify the `length` (at most kBlockSize) bytes starting at `data`
+  ///
+  /// Bits beyond `length` are cleared.  Scanning may continue afterwards as if
+  /// the bytes had been part of a full block.
+  StructuralBlock NextPartial(const uint8_t* data, int64_t length);
+
+  /// \brief Whether the bytes scanned so far end inside a string literal
+  bool in_string() const { return prev_in_string_ != 0; }
+
+ private:
+  StructuralBlock Finish(const uint8_t* data, int64_t length);
+
+  // All ones if the previous block ended inside a string
+  uint64_t prev_in_string_ = 0;
+  // 1 if the first byte of the next block is escaped
+  uint64_t prev_escaped_ = 0;
+  // 1 if the previous block ended inside a number or literal
+  uint64_t prev_scalar_ = 0;
+};
+
+/// \brief Positions of the tokens of a JSON buffer, produced by stage one
+class ARROW_EXPORT StructuralIndex {
+ public:
+  /// \brief Index `json`, reusing storage from any previous call
+  Status Build(std::string_view json);
+
+  /// \brief Token positions in increasing order
+  ///
+  /// The array is terminated by an extra position equal to the size of the input.
+  const uint32_t* positions() const { return positions_.get(); }
+
+  /// \brief The number of token positions, not counting the terminating one
+  int64_t num_positions() const { return num_positions_; }
+
+  /// \brief Whether the input ended inside a string literal
+  bool ends_in_string() const { return ends_in_string_; }
+
+  /// \brief Position of the first unescaped control character inside a string,
+  /// or -1
+  int64_t first_invalid() const { return first_invalid_; }
+
+ private:
+  std::unique_ptr<uint32_t[]> positions_;
+  int64_t capacity_ = 0;
+  int64_t num_positions_ = 0;
+  bool ends_in_string_ = false;
+  int64_t first_invalid_ = -1;
+};
+
+/// \brief Unescape the contents of a JSON string literal into `out`
+///
+/// Returns nullptr on success, or a description of the malformed escape.
+ARROW_EXPORT
+const char* UnescapeString(std::string_view escaped, std::string* out);
+
+/// \brief Whether `token` is a JSON number (or NaN/Infinity)
+///
+/// Returns nullptr on success, or a description of the malformation.
+ARROW_EXPORT
+const char* ValidateNumber(std::string_view token);
+
+/// \brief Stage two of structural-index JSON parsing
+///
+/// Walks a StructuralIndex, validating the grammar and forwarding each value
+/// to `Handler` through the callbacks rapidjson's reader would invoke (Null,
+/// Bool, RawNumber, String, Key, StartObject, EndObject, StartArray and
+/// EndArray).  Numbers are passed as raw strings.  Strings without escapes are
+/// passed as views of the input.
+template <typename Handler>
+class StructuralParser {
+ public:
+  enum class Code {
+    /// A top-level value was parsed
+    kValue,
+    /// Only whitespace remains
+    kEnd,
+    /// The handler returned false
+    kHandlerError,
+    /// The input is malformed, see error()
+    kSyntaxError,
+  };
+
+  StructuralParser(const StructuralIndex& index, std::string_view json)
+      : index_(index),
+        data_(json.data()),
+        size_(static_cast<uint32_t>(json.size())),
+        position_(index.positions()) {}
+
+  /// \brief Parse the next top-level value
+  Code Parse(Handler& handler);
+
+  /// \brief Description of the last syntax error
+  const char* error() const { return error_; }
+
+ private:
+  struct Scope {
+    bool is_object;
+    uint32_t count;
+  };
+
+  enum class State { kValue, kMemberKey, kAfterValue, kEndObject, kEndArray };
+
+  char At(uint32_t pos) const { return pos < size_ ? data_[pos] : '\0'; }
+
+  // End of the token starting at `pos`: the next token's start, less whitespace
+  uint32_t TokenEnd(uint32_t pos) const {
+    uint32_t end = *position_;
+    while (end > pos && IsWhitespace(data_[end - 1])) {
+      --end;
+    }
+    return end;
+  }
+
+  static bool IsWhitespace(char c) {
+    return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+  }
+
+  Code SyntaxError(const char* message) {
+    error_ = message;
+    return Code::kSyntaxError;
+  }
+
+  // Parse the string starting at `pos` (the opening quote)
+  bool ParseString(uint32_t pos, std::string_view* out);
+
+  Code ParseScalar(Handler& handler, uint32_t pos);
+
+  const StructuralIndex& index_;
+  const char* data_;
+  const uint32_t size_;
+  // next unconsumed token
+  const uint32_t* position_;
+  std::vector<Scope> scopes_;
+  std::string unescaped_;
+  const char* error_ = "";
+};
+
+template <typename Handler>
+bool StructuralParser<Handler>::ParseString(uint32_t pos, std::string_view* out) {
+  if (ARROW_PREDICT_FALSE(*position_ == size_ && index_.ends_in_string())) {
+    error_ = "Missing a closing quotation mark in string.";
+    return false;
+  }
+  // Only whitespace may separate the closing quote from the next token
+  const uint32_t end = TokenEnd(pos);
+  if (ARROW_PREDICT_FALSE(end < pos + 2 || data_[end - 1] != '"')) {
+    error_ = "Missing a closing quotation mark in string.";
+    return false;
+  }
+  if (ARROW_PREDICT_FALSE(index_.first_invalid() > pos &&
+                          index_.first_invalid() < end)) {
+    error_ = "Invalid encoding in string.";
+    return false;
+  }
+  std::string_view contents(data_ + pos + 1, end - pos - 2);
+  if (ARROW_PREDICT_TRUE(std::memchr(contents.data(), '\\', contents.size()) ==
+                         nullptr)) {
+    *out = contents;
+    return true;
+  }
+  error_ = UnescapeString(contents, &unescaped_);
+  if (ARROW_PREDICT_FALSE(error_ != nullptr)) {
+    return false;
+  }
+  *out = unescaped_;
+  return true;
+}
+
+template <typename Handler>
+typename StructuralParser<Handler>::Code StructuralParser<Handler>::ParseScalar(
+    Handler& handler, uint32_t pos) {
+  bool ok;
+  if (data_[pos] == '"') {
+    std::string_view value;
+    if (ARROW_PREDICT_FALSE(!ParseString(pos, &value))) {
+      return Code::kSyntaxError;
+    }
+    ok = handler.String(value.data(), static_cast<uint32_t>(value.size()), false);
+  } else {
+    std::string_view token(data_ + pos, TokenEnd(pos) - pos);
+    switch (token[0]) {
+      case 't':
+        if (ARROW_PREDICT_FALSE(token != "true")) {
+          return SyntaxError("Invalid value.");
+        }
+        ok = handler.Bool(true);
+        break;
+      case 'f':
+        if (ARROW_PREDICT_FALSE(token != "false")) {
+          return SyntaxError("Invalid value.");
+        }
+        ok = handler.Bool(false);
+        break;
+      case 'n':
+        if (ARROW_PREDICT_FALSE(token != "null")) {
+          return SyntaxError("Invalid value.");
+        }
+        ok = handler.Null();
+        break;
+      default: {
+        const char* error = ValidateNumber(token);
+        if (ARROW_PREDICT_FALSE(error != nullptr)) {
+          return SyntaxError(error);
+        }
+        ok = handler.RawNumber(token.data(), static_cast<uint32_t>(token.size()), false);
+        break;
+      }
+    }
+  }
+  return ok ? Code::kValue : Code::kHandlerError;
+}
+
+template <typename Handler>
+typename StructuralParser<Handler>::Code StructuralParser<Handler>::Parse(
+    Handler& handler) {
+  if (*position_ == size_) {
+    return Code::kEnd;
+  }
+  switch (data_[*position_]) {
+    case '}':
+    case ']':
+    case ':':
+    case ',':
+      // rapidjson reports any document not starting with a value as empty
+      return SyntaxError("The document is empty.");
+    default:
+      break;
+  }
+
+  scopes_.clear();
+  uint32_t pos = *position_++;
+  State state = State::kValue;
+  while (true) {
+    switch (state) {
+      case State::kValue:
+        switch (At(pos)) {
+          case '{':
+            if (ARROW_PREDICT_FALSE(!handler.StartObject())) {
+              return Code::kHandlerError;
+            }
+            scopes_.push_back({true, 0});
+            pos = *position_++;
+            state = At(pos) == '}' ? State::kEndObject : State::kMemberKey;
+            break;
+          case '[':
+            if (ARROW_PREDICT_FALSE(!handler.StartArray())) {
+              return Code::kHandlerError;
+            }
+            scopes_.push_back({false, 0});
+            pos = *position_++;
+            state = At(pos) == ']' ? State::kEndArray : State::kValue;
+            break;
+          case '}':
+          case ']':
+          case ':':
+          case ',':
+            return SyntaxError("Invalid value.");
+          default: {
+            if (ARROW_PREDICT_FALSE(pos == size_)) {
+              return SyntaxError("Invalid value.");
+            }
+            auto code = ParseScalar(handler, pos);
+            if (ARROW_PREDICT_FALSE(code != Code::kValue)) {
+              return code;
+            }
+            state = State::kAfterValue;
+            break;
+          }
+        }
+        break;
+
+      case State::kMemberKey: {
+        if (ARROW_PREDICT_FALSE(At(pos) != '"')) {
+          return SyntaxError("Missing a name for object member.");
+        }
+        std::string_view key;
+        if (ARROW_PREDICT_FALSE(!ParseString(pos, &key))) {
+          return Code::kSyntaxError;
+        }
+        if (ARROW_PREDICT_FALSE(
+                !handler.Key(key.data(), static_cast<uint32_t>(key.size()), false))) {
+          return Code::kHandlerError;
+        }
+        pos = *position_++;
+        if (ARROW_PREDICT_FALSE(At(pos) != ':')) {
+          return SyntaxError("Missing a colon after a name of object member.");
+        }
+        pos = *position_++;
+        state = State::kValue;
+        break;
+      }
+
+      case State::kAfterValue: {
+        if (scopes_.empty()) {
+          return Code::kValue;
+        }
+        Scope& scope = scopes_.back();
+        ++scope.count;
+        pos = *position_++;
+        const char c = At(pos);
+        if (scope.is_object) {
+          if (c == ',') {
+            pos = *position_++;
+            state = State::kMemberKey;
+          } else if (ARROW_PREDICT_TRUE(c == '}')) {
+            state = State::kEndObject;
+          } else {
+            return SyntaxError("Missing a comma or '}' after an object member.");
+          }
+        } else {
+          if (c == ',') {
+            pos = *position_++;
+            state = State::kValue;
+          } else if (ARROW_PREDICT_TRUE(c == ']')) {
+            state = State::kEndArray;
+          } else {
+            return SyntaxError("Missing a comma or ']' after an array element.");
+          }
+        }
+        break;
+      }
+
+      case State::kEndObject:
+        if (ARROW_PREDICT_FALSE(!handler.EndObject(scopes_.back().count))) {
+          return Code::kHandlerError;
+        }
+        scopes_.pop_back();
+        state = State::kAfterValue;
+        break;
+
+      case State::kEndArray:
+        if (ARROW_PREDICT_FALSE(!handler.EndArray(scopes_.back().count))) {
+          return Code::kHandlerError;
+        }
+        scopes_.pop_back();
+        state = State::kAfterValue;
+        break;
+    }
+  }
+}
+
+}  // namespace internal
+}  // namespace json
+}  // namespace arrow
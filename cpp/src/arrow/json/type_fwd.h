@@ -21,6 +21,7 @@ namespace json {
 class TableReader;
 struct ReadOptions;
 struct ParseOptions;
+struct WriteOptions;
 
 }  // namespace json
 }  // namespace arrow
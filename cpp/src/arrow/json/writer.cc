@@ -0,0 +1,568 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/json/writer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/record_batch.h"
+#include "arrow/result.h"
+#include "arrow/stl_allocator.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/decimal.h"
+#include "arrow/util/endian.h"
+#include "arrow/util/float16.h"
+#include "arrow/util/formatting.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/simd.h"
+#include "arrow/util/sliced_writer_internal.h"
+#include "arrow/visit_type_inline.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+using internal::SlicedWriter;
+using internal::SliceEncoder;
+
+namespace json {
+
+// Batches are converted one slice of WriteOptions::batch_size rows at a time, like
+// in the CSV writer.  Each column is rendered by a ValueEncoder (nested types have
+// child encoders) bound to the slice's arrays, appending one value at a time into
+// the slice's output string as rows are assembled.  Numbers and temporal values use
+// the StringFormatter of the cast kernels, strings are escaped by copying the runs
+// between special characters, which are located 16 or 8 bytes at a time.
+//
+// When WriteOptions::use_threads is set, several slices are converted concurrently,
+// each with its own encoders and output string, and written in slice order by the
+// SlicedWriter shared with the CSV writer.
+
+namespace {
+
+// Output of the encoders, allocated from WriteOptions::io_context's memory pool.
+using OutputString =
+    std::basic_string<char, std::char_traits<char>, stl::allocator<char>>;
+
+// Whether c must be escaped in a JSON string.
+inline bool NeedsEscape(uint8_t c) { return c < 0x20 || c == '"' || c == '\\'; }
+
+// Returns the first character in [begin, end) that must be escaped, or end.
+const char* FindEscape(const char* begin, const char* end) {
+  const auto* p = reinterpret_cast<const uint8_t*>(begin);
+  const auto* stop = reinterpret_cast<const uint8_t*>(end);
+#if defined(ARROW_HAVE_SSE4_2)
+  const __m128i quote = _mm_set1_epi8('"');
+  const __m128i backslash = _mm_set1_epi8('\\');
+  const __m128i max_control = _mm_set1_epi8(0x1F);
+  while (stop - p >= 16) {
+    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    const __m128i control = _mm_cmpeq_epi8(_mm_max_epu8(v, max_control), max_control);
+    const __m128i special = _mm_or_si128(
+        control, _mm_or_si128(_mm_cmpeq_epi8(v, quote), _mm_cmpeq_epi8(v, backslash)));
+    const auto mask = static_cast<uint32_t>(_mm_movemask_epi8(special));
+    if (mask != 0) {
+      return reinterpret_cast<const char*>(p + bit_util::CountTrailingZeros(mask));
+    }
+    p += 16;
+  }
+#endif
+  // Eight characters at a time: the high bit of a byte is set below if it is a
+  // control character, a quote or a backslash, or (because of borrows) if it follows
+  // such a byte, so the lowest flagged byte is always the first to escape.
+  constexpr uint64_t kOnes = 0x0101010101010101ULL;
+  constexpr uint64_t kHighBits = 0x8080808080808080ULL;
+  while (stop - p >= 8) {
+    uint64_t word;
+    std::memcpy(&word, p, sizeof(word));
+    word = bit_util::FromLittleEndian(word);
+    const uint64_t quotes = word ^ (kOnes * '"');
+    const uint64_t backslashes = word ^ (kOnes * '\\');
+    const uint64_t flagged = (((word - kOnes * 0x20) & ~word) |
+                              ((quotes - kOnes) & ~quotes) |
+                              ((backslashes - kOnes) & ~backslashes)) &
+                             kHighBits;
+    if (flagged != 0) {
+      return reinterpret_cast<const char*>(p + bit_util::CountTrailingZeros(flagged) / 8);
+    }
+    p += 8;
+  }
+  while (p < stop && !NeedsEscape(*p)) {
+    ++p;
+  }
+  return reinterpret_cast<const char*>(p);
+}
+
+// Appends s to out as a JSON string.
+template <typename String>
+void AppendString(std::string_view s, String* out) {
+  static constexpr char kHexDigits[] = "0123456789abcdef";
+  const char* begin = s.data();
+  const char* const end = begin + s.size();
+  out->push_back('"');
+  while (true) {
+    const char* next = FindEscape(begin, end);
+    out->append(begin, next - begin);
+    if (next == end) {
+      break;
+    }
+    switch (*next) {
+      case '"':
+        out->append("\\\"");
+        break;
+      case '\\':
+        out->append("\\\\");
+        break;
+      case '\n':
+        out->append("\\n");
+        break;
+      case '\r':
+        out->append("\\r");
+        break;
+      case '\t':
+        out->append("\\t");
+        break;
+      case '\b':
+        out->append("\\b");
+        break;
+      case '\f':
+        out->append("\\f");
+        break;
+      default: {
+        const auto c = static_cast<uint8_t>(*next);
+        const char escaped[] = {'\\', 'u', '0', '0', kHexDigits[c >> 4],
+                                kHexDigits[c & 0xF]};
+        out->append(escaped, sizeof(escaped));
+      }
+    }
+    begin = next + 1;
+  }
+  out->push_back('"');
+}
+
+// Renders the values of an array as JSON, one value at a time.
+class ValueEncoder {
+ public:
+  virtual ~ValueEncoder() = default;
+
+  // Sets the array whose values are appended.  Encoders for nested types bind their
+  // children to the corresponding child arrays.
+  virtual void Bind(const std::shared_ptr<Array>& array) { array_ = array; }
+
+  // Appends the JSON rendering of the index-th value of the bound array to out.
+  void Append(int64_t index, OutputString* out) const {
+    if (array_->IsNull(index)) {
+      out->append("null");
+    } else {
+      AppendValue(index, out);
+    }
+  }
+
+ protected:
+  virtual void AppendValue(int64_t index, OutputString* out) const = 0;
+
+  std::shared_ptr<Array> array_;
+};
+
+class NullEncoder : public ValueEncoder {
+ protected:
+  void AppendValue(int64_t, OutputString* out) const override { out->append("null"); }
+};
+
+// Booleans, numbers and temporal values, rendered with the same StringFormatter as
+// casts to string.
+template <typename T>
+class FormattedEncoder : public ValueEncoder {
+ public:
+  using ArrayType = typename TypeTraits<T>::ArrayType;
+
+  // quoted: whether to write values as JSON strings rather than as numbers or
+  // booleans
+  FormattedEncoder(const DataType& type, bool quoted)
+      : formatter_(&type), quoted_(quoted) {}
+
+  void Bind(const std::shared_ptr<Array>& array) override {
+    ValueEncoder::Bind(array);
+    values_ = checked_cast<const ArrayType*>(array.get());
+  }
+
+ protected:
+  void AppendValue(int64_t index, OutputString* out) const override {
+    if constexpr (is_decimal_type<T>::value) {
+      Format(typename TypeTraits<T>::CType(values_->GetValue(index)), out);
+    } else {
+      const auto value = values_->Value(index);
+      if constexpr (std::is_same<T, HalfFloatType>::value) {
+        if (!util::Float16::FromBits(value).is_finite()) {
+          out->append("null");
+          return;
+        }
+      } else if constexpr (is_floating_type<T>::value) {
+        // JSON has no representation for NaN and infinities
+        if (!std::isfinite(value)) {
+          out->append("null");
+          return;
+        }
+      }
+      Format(value, out);
+    }
+  }
+
+ private:
+  template <typename Value>
+  void Format(const Value& value, OutputString* out) const {
+    if (quoted_) {
+      out->push_back('"');
+    }
+    formatter_(value, [&](std::string_view formatted) {
+      out->append(formatted.data(), formatted.size());
+    });
+    if (quoted_) {
+      out->push_back('"');
+    }
+  }
+
+  mutable arrow::internal::StringFormatter<T> formatter_;
+  const bool quoted_;
+  const ArrayType* values_ = NULLPTR;
+};
+
+template <typename ArrayType>
+class StringEncoder : public ValueEncoder {
+ public:
+  void Bind(const std::shared_ptr<Array>& array) override {
+    ValueEncoder::Bind(array);
+    values_ = checked_cast<const ArrayType*>(array.get());
+  }
+
+ protected:
+  void AppendValue(int64_t index, OutputString* out) const override {
+    AppendString(values_->GetView(index), out);
+  }
+
+ private:
+  const ArrayType* values_ = NULLPTR;
+};
+
+class DictionaryEncoder : public ValueEncoder {
+ public:
+  explicit DictionaryEncoder(std::unique_ptr<ValueEncoder> values)
+      : values_(std::move(values)) {}
+
+  void Bind(const std::shared_ptr<Array>& array) override {
+    ValueEncoder::Bind(array);
+    dictionary_array_ = checked_cast<const DictionaryArray*>(array.get());
+    values_->Bind(dictionary_array_->dictionary());
+  }
+
+ protected:
+  void AppendValue(int64_t index, OutputString* out) const override {
+    values_->Append(dictionary_array_->GetValueIndex(index), out);
+  }
+
+ private:
+  std::unique_ptr<ValueEncoder> values_;
+  const DictionaryArray* dictionary_array_ = NULLPTR;
+};
+
+class StructEncoder : public ValueEncoder {
+ public:
+  // keys: the escaped field names followed by ':'
+  StructEncoder(std::vector<std::string> keys,
+                std::vector<std::unique_ptr<ValueEncoder>> children)
+      : keys_(std::move(keys)), children_(std::move(children)) {}
+
+  void Bind(const std::shared_ptr<Array>& array) override {
+    ValueEncoder::Bind(array);
+    const auto& struct_array = checked_cast<const StructArray&>(*array);
+    for (int i = 0; i < static_cast<int>(children_.size()); ++i) {
+      children_[i]->Bind(struct_array.field(i));
+    }
+  }
+
+  void AppendValue(int64_t index, OutputString* out) const override {
+    out->push_back('{');
+    for (size_t i = 0; i < children_.size(); ++i) {
+      if (i != 0) {
+        out->push_back(',');
+      }
+      out->append(keys_[i].data(), keys_[i].size());
+      children_[i]->Append(index, out);
+    }
+    out->push_back('}');
+  }
+
+ private:
+  const std::vector<std::string> keys_;
+  std::vector<std::unique_ptr<ValueEncoder>> children_;
+};
+
+template <typename ArrayType>
+class ListEncoder : public ValueEncoder {
+ public:
+  explicit ListEncoder(std::unique_ptr<ValueEncoder> values)
+      : values_(std::move(values)) {}
+
+  void Bind(const std::shared_ptr<Array>& array) override {
+    ValueEncoder::Bind(array);
+    list_array_ = checked_cast<const ArrayType*>(array.get());
+    values_->Bind(list_array_->values());
+  }
+
+ protected:
+  void AppendValue(int64_t index, OutputString* out) const override {
+    const int64_t begin = list_array_->value_offset(index);
+    const int64_t end = begin + list_array_->value_length(index);
+    out->push_back('[');
+    for (int64_t i = begin; i < end; ++i) {
+      if (i != begin) {
+        out->push_back(',');
+      }
+      values_->Append(i, out);
+    }
+    out->push_back(']');
+  }
+
+ private:
+  std::unique_ptr<ValueEncoder> values_;
+  const ArrayType* list_array_ = NULLPTR;
+};
+
+// Maps are written as objects, so their keys must be strings.
+class MapEncoder : public ValueEncoder {
+ public:
+  MapEncoder(std::unique_ptr<ValueEncoder> keys, std::unique_ptr<ValueEncoder> items)
+      : keys_(std::move(keys)), items_(std::move(items)) {}
+
+  void Bind(const std::shared_ptr<Array>& array) override {
+    ValueEncoder::Bind(array);
+    map_array_ = checked_cast<const MapArray*>(array.get());
+    keys_->Bind(map_array_->keys());
+    items_->Bind(map_array_->items());
+  }
+
+ protected:
+  void AppendValue(int64_t index, OutputString* out) const override {
+    const int64_t begin = map_array_->value_offset(index);
+    const int64_t end = begin + map_array_->value_length(index);
+    out->push_back('{');
+    for (int64_t i = begin; i < end; ++i) {
+      if (i != begin) {
+        out->push_back(',');
+      }
+      keys_->Append(i, out);
+      out->push_back(':');
+      items_->Append(i, out);
+    }
+    out->push_back('}');
+  }
+
+ private:
+  std::unique_ptr<ValueEncoder> keys_;
+  std::unique_ptr<ValueEncoder> items_;
+  const MapArray* map_array_ = NULLPTR;
+};
+
+Result<std::unique_ptr<ValueEncoder>> MakeEncoder(const DataType& type);
+
+Result<std::unique_ptr<StructEncoder>> MakeStructEncoder(const FieldVector& fields) {
+  std::vector<std::string> keys(fields.size());
+  std::vector<std::unique_ptr<ValueEncoder>> children(fields.size());
+  for (size_t i = 0; i < fields.size(); ++i) {
+    AppendString(fields[i]->name(), &keys[i]);
+    keys[i].push_back(':');
+    ARROW_ASSIGN_OR_RAISE(children[i], MakeEncoder(*fields[i]->type()));
+  }
+  return std::make_unique<StructEncoder>(std::move(keys), std::move(children));
+}
+
+Result<std::unique_ptr<ValueEncoder>> MakeEncoder(const DataType& type) {
+  auto make_encoder = [&](const auto& type) -> Result<std::unique_ptr<ValueEncoder>> {
+    using Type = std::decay_t<decltype(type)>;
+
+    if constexpr (is_null_type<Type>::value) {
+      return std::make_unique<NullEncoder>();
+    } else if constexpr (is_boolean_type<Type>::value || is_number_type<Type>::value ||
+                         is_decimal_type<Type>::value ||
+                         is_duration_type<Type>::value) {
+      return std::make_unique<FormattedEncoder<Type>>(type, /*quoted=*/false);
+    } else if constexpr (is_date_type<Type>::value || is_time_type<Type>::value ||
+                         std::is_same<Type, TimestampType>::value) {
+      // Time zone aware timestamps are formatted in UTC, with a "Z" suffix
+      return std::make_unique<FormattedEncoder<Type>>(type, /*quoted=*/true);
+    } else if constexpr (is_string_type<Type>::value ||
+                         std::is_same<Type, StringViewType>::value) {
+      return std::make_unique<StringEncoder<typename TypeTraits<Type>::ArrayType>>();
+    } else if constexpr (std::is_same<Type, DictionaryType>::value) {
+      ARROW_ASSIGN_OR_RAISE(auto values, MakeEncoder(*type.value_type()));
+      return std::make_unique<DictionaryEncoder>(std::move(values));
+    } else if constexpr (std::is_same<Type, StructType>::value) {
+      return MakeStructEncoder(type.fields());
+    } else if constexpr (std::is_same<Type, MapType>::value) {
+      if (!is_string(type.key_type()->id())) {
+        return Status::NotImplemented("Writing JSON is only supported for maps with ",
+                                      "string keys, got ", type.ToString());
+      }
+      ARROW_ASSIGN_OR_RAISE(auto keys, MakeEncoder(*type.key_type()));
+      ARROW_ASSIGN_OR_RAISE(auto items, MakeEncoder(*type.item_type()));
+      return std::make_unique<MapEncoder>(std::move(keys), std::move(items));
+    } else if constexpr (is_list_type<Type>::value || is_list_view_type<Type>::value) {
+      ARROW_ASSIGN_OR_RAISE(auto values, MakeEncoder(*type.value_type()));
+      return std::make_unique<ListEncoder<typename TypeTraits<Type>::ArrayType>>(
+          std::move(values));
+    } else {
+      return Status::NotImplemented("Writing JSON is not supported for type ",
+                                    type.ToString());
+    }
+  };
+  return VisitType(type, make_encoder);
+}
+
+// Converts slices of record batches to JSON lines in a reusable buffer.
+class LineEncoder : public SliceEncoder {
+ public:
+  LineEncoder(std::unique_ptr<StructEncoder> row_encoder, MemoryPool* pool)
+      : row_encoder_(std::move(row_encoder)), buffer_(stl::allocator<char>(pool)) {}
+
+  // Renders batch into the buffer, replacing its previous contents.
+  Status Encode(const RecordBatch& batch) override {
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Array> rows, batch.ToStructArray());
+    row_encoder_->Bind(rows);
+    // Avoid regrowing the buffer for slices similar to the previous one
+    const size_t capacity = buffer_.size();
+    buffer_.clear();
+    buffer_.reserve(capacity);
+    for (int64_t row = 0; row < batch.num_rows(); ++row) {
+      row_encoder_->AppendValue(row, &buffer_);
+      buffer_.push_back('\n');
+    }
+    return Status::OK();
+  }
+
+  Status WriteTo(io::OutputStream* sink) override {
+    return sink->Write(buffer_.data(), static_cast<int64_t>(buffer_.size()));
+  }
+
+ private:
+  std::unique_ptr<StructEncoder> row_encoder_;
+  OutputString buffer_;
+};
+
+class JSONWriterImpl : public ipc::RecordBatchWriter {
+ public:
+  static Result<std::shared_ptr<JSONWriterImpl>> Make(
+      io::OutputStream* sink, std::shared_ptr<io::OutputStream> owned_sink,
+      std::shared_ptr<Schema> schema, const WriteOptions& options) {
+    RETURN_NOT_OK(options.Validate());
+    // One encoder per slice converted concurrently.
+    const int num_encoders = SlicedWriter::NumEncoders(options.use_threads);
+    std::vector<std::unique_ptr<SliceEncoder>> encoders;
+    for (int i = 0; i < num_encoders; ++i) {
+      ARROW_ASSIGN_OR_RAISE(auto row_encoder, MakeStructEncoder(schema->fields()));
+      encoders.push_back(std::make_unique<LineEncoder>(std::move(row_encoder),
+                                                       options.io_context.pool()));
+    }
+    return std::make_shared<JSONWriterImpl>(sink, std::move(owned_sink),
+                                            std::move(schema), std::move(encoders),
+                                            options);
+  }
+
+  Status WriteRecordBatch(const RecordBatch& batch) override {
+    RETURN_NOT_OK(sliced_writer_.WriteRecordBatch(batch));
+    stats_.num_record_batches = sliced_writer_.num_slices_written();
+    return Status::OK();
+  }
+
+  Status WriteTable(const Table& table, int64_t max_chunksize) override {
+    RETURN_NOT_OK(sliced_writer_.WriteTable(table, max_chunksize));
+    stats_.num_record_batches = sliced_writer_.num_slices_written();
+    return Status::OK();
+  }
+
+  Status Close() override { return Status::OK(); }
+
+  ipc::WriteStats stats() const override { return stats_; }
+
+  JSONWriterImpl(io::OutputStream* sink, std::shared_ptr<io::OutputStream> owned_sink,
+                 std::shared_ptr<Schema> schema,
+                 std::vector<std::unique_ptr<SliceEncoder>> encoders,
+                 const WriteOptions& options)
+      : owned_sink_(std::move(owned_sink)),
+        sliced_writer_(sink, std::move(encoders), options.batch_size,
+                       options.use_threads),
+        schema_(std::move(schema)) {}
+
+ private:
+  std::shared_ptr<io::OutputStream> owned_sink_;
+  SlicedWriter sliced_writer_;
+  const std::shared_ptr<Schema> schema_;
+  ipc::WriteStats stats_;
+};
+
+}  // namespace
+
+Status WriteNDJSON(const Table& table, const WriteOptions& options,
+                   arrow::io::OutputStream* output) {
+  ARROW_ASSIGN_OR_RAISE(auto writer, MakeNDJSONWriter(output, table.schema(), options));
+  RETURN_NOT_OK(writer->WriteTable(table));
+  return writer->Close();
+}
+
+Status WriteNDJSON(const RecordBatch& batch, const WriteOptions& options,
+                   arrow::io::OutputStream* output) {
+  ARROW_ASSIGN_OR_RAISE(auto writer, MakeNDJSONWriter(output, batch.schema(), options));
+  RETURN_NOT_OK(writer->WriteRecordBatch(batch));
+  return writer->Close();
+}
+
+Status WriteNDJSON(const std::shared_ptr<RecordBatchReader>& reader,
+                   const WriteOptions& options, arrow::io::OutputStream* output) {
+  ARROW_ASSIGN_OR_RAISE(auto writer,
+                        MakeNDJSONWriter(output, reader->schema(), options));
+  std::shared_ptr<RecordBatch> batch;
+  while (true) {
+    ARROW_ASSIGN_OR_RAISE(batch, reader->Next());
+    if (batch == nullptr) break;
+    RETURN_NOT_OK(writer->WriteRecordBatch(*batch));
+  }
+  return writer->Close();
+}
+
+Result<std::shared_ptr<ipc::RecordBatchWriter>> MakeNDJSONWriter(
+    std::shared_ptr<io::OutputStream> sink, const std::shared_ptr<Schema>& schema,
+    const WriteOptions& options) {
+  return JSONWriterImpl::Make(sink.get(), sink, schema, options);
+}
+
+Result<std::shared_ptr<ipc::RecordBatchWriter>> MakeNDJSONWriter(
+    io::OutputStream* sink, const std::shared_ptr<Schema>& schema,
+    const WriteOptions& options) {
+  return JSONWriterImpl::Make(sink, nullptr, schema, options);
+}
+
+}  // namespace json
+}  // namespace arrow
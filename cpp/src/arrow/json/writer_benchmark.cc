@@ -0,0 +1,120 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "benchmark/benchmark.h"
+
+#include <memory>
+#include <string>
+
+#include "arrow/buffer.h"
+#include "arrow/io/memory.h"
+#include "arrow/json/options.h"
+#include "arrow/json/writer.h"
+#include "arrow/record_batch.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/util/key_value_metadata.h"
+
+namespace arrow {
+namespace json {
+
+namespace {
+
+constexpr int kSeed = 0x432432;
+constexpr int kNumRows = 20000;
+
+void BenchmarkWriteNDJSON(benchmark::State& state, const FieldVector& fields,
+                          bool use_threads = false) {
+  auto batch = random::GenerateBatch(fields, kNumRows, kSeed);
+  auto options = WriteOptions::Defaults();
+  options.use_threads = use_threads;
+  int64_t total_size = 0;
+
+  for (auto _ : state) {
+    auto out = io::BufferOutputStream::Create().ValueOrDie();
+    ABORT_NOT_OK(WriteNDJSON(*batch, options, out.get()));
+    auto buffer = out->Finish().ValueOrDie();
+    total_size += buffer->size();
+  }
+
+  // byte size of the generated JSON
+  state.SetBytesProcessed(total_size);
+  state.SetItemsProcessed(state.iterations() * kNumRows);
+}
+
+FieldVector NumericFields() {
+  return {field("i64", int64()), field("i32", int32()), field("f64", float64()),
+          field("b", boolean())};
+}
+
+FieldVector StringFields() {
+  // Random strings are drawn from 'A' to 'z', which includes the backslash
+  auto string_metadata = key_value_metadata({"min_length", "max_length"}, {"5", "50"});
+  return {field("s0", utf8(), /*nullable=*/true, string_metadata),
+          field("s1", utf8(), /*nullable=*/true, string_metadata),
+          field("s2", large_utf8(), /*nullable=*/true, string_metadata)};
+}
+
+FieldVector TemporalFields() {
+  // Keep values in the range of valid dates
+  auto range = [](const std::string& min, const std::string& max) {
+    return key_value_metadata({"min", "max"}, {min, max});
+  };
+  return {field("date", date32(), /*nullable=*/true, range("0", "50000")),
+          field("ts", timestamp(TimeUnit::MICRO), /*nullable=*/true,
+                range("0", "4000000000000000")),
+          field("time", time64(TimeUnit::NANO), /*nullable=*/true,
+                range("0", "86399999999999"))};
+}
+
+FieldVector NestedFields() {
+  return {field("list", list(int32())),
+          field("struct", struct_({field("x", float64()), field("y", utf8())})),
+          field("map", map(utf8(), int64()))};
+}
+
+void WriteNDJSONNumeric(benchmark::State& state) {
+  BenchmarkWriteNDJSON(state, NumericFields());
+}
+
+void WriteNDJSONString(benchmark::State& state) {
+  BenchmarkWriteNDJSON(state, StringFields());
+}
+
+void WriteNDJSONTemporal(benchmark::State& state) {
+  BenchmarkWriteNDJSON(state, TemporalFields());
+}
+
+void WriteNDJSONNested(benchmark::State& state) {
+  BenchmarkWriteNDJSON(state, NestedFields());
+}
+
+// Exercise converting slices on the CPU thread pool
+void WriteNDJSONNumericThreaded(benchmark::State& state) {
+  BenchmarkWriteNDJSON(state, NumericFields(), /*use_threads=*/true);
+}
+
+}  // namespace
+
+BENCHMARK(WriteNDJSONNumeric);
+BENCHMARK(WriteNDJSONString);
+BENCHMARK(WriteNDJSONTemporal);
+BENCHMARK(WriteNDJSONNested);
+BENCHMARK(WriteNDJSONNumericThreaded)->UseRealTime();
+
+}  // namespace json
+}  // namespace arrow
@@ -0,0 +1,245 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/buffer.h"
+#include "arrow/builder.h"
+#include "arrow/compute/cast.h"
+#include "arrow/io/memory.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/json/writer.h"
+#include "arrow/memory_pool.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/matchers.h"
+#include "arrow/testing/random.h"
+
+namespace arrow {
+namespace json {
+
+template <typename Data>
+Result<std::string> ToNDJSON(const Data& data, const WriteOptions& options) {
+  ARROW_ASSIGN_OR_RAISE(auto out, io::BufferOutputStream::Create());
+  RETURN_NOT_OK(WriteNDJSON(data, options, out.get()));
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> buffer, out->Finish());
+  return buffer->ToString();
+}
+
+// Checks the JSON written for batch, whatever the batch size, threading and entry
+// point used.
+void AssertWritten(const std::shared_ptr<RecordBatch>& batch,
+                   const std::string& expected) {
+  auto options = WriteOptions::Defaults();
+  ASSERT_OK_AND_ASSIGN(auto json, ToNDJSON(*batch, options));
+  ASSERT_EQ(json, expected);
+
+  options.batch_size = 2;
+  ASSERT_OK_AND_ASSIGN(json, ToNDJSON(*batch, options));
+  ASSERT_EQ(json, expected);
+
+  options.use_threads = true;
+  ASSERT_OK_AND_ASSIGN(json, ToNDJSON(*batch, options));
+  ASSERT_EQ(json, expected);
+
+  ASSERT_OK_AND_ASSIGN(auto table, Table::FromRecordBatches({batch}));
+  ASSERT_OK_AND_ASSIGN(json, ToNDJSON(*table, options));
+  ASSERT_EQ(json, expected);
+
+  ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchReader::Make({batch}));
+  ASSERT_OK_AND_ASSIGN(json, ToNDJSON(reader, options));
+  ASSERT_EQ(json, expected);
+}
+
+TEST(WriterTest, Empty) {
+  auto batch = RecordBatchFromJSON(schema({field("a", int32())}), "[]");
+  AssertWritten(batch, "");
+
+  batch = RecordBatch::Make(schema({}), /*num_rows=*/2, ArrayVector{});
+  AssertWritten(batch, "{}\n{}\n");
+}
+
+TEST(WriterTest, Primitives) {
+  auto batch = RecordBatchFromJSON(
+      schema({field("i", int32()), field("u", uint64()), field("f", float64()),
+              field("b", boolean()), field("s", utf8()), field("n", null())}),
+      R"([{"i": 1, "u": 18446744073709551615, "f": 1.5, "b": true, "s": "ab"},
+          {"i": -2, "u": 0, "f": 0.0, "b": false, "s": ""},
+          {}])");
+  AssertWritten(batch,
+                R"({"i":1,"u":18446744073709551615,"f":1.5,"b":true,"s":"ab","n":null})"
+                "\n"
+                R"({"i":-2,"u":0,"f":0,"b":false,"s":"","n":null})"
+                "\n"
+                R"({"i":null,"u":null,"f":null,"b":null,"s":null,"n":null})"
+                "\n");
+}
+
+TEST(WriterTest, NonFiniteFloats) {
+  auto batch = RecordBatch::Make(
+      schema({field("f", float32()), field("d", float64())}), 4,
+      {ArrayFromJSON(float32(), "[NaN, Inf, -Inf, 0.25]"),
+       ArrayFromJSON(float64(), "[-Inf, NaN, 1e300, Inf]")});
+  AssertWritten(batch,
+                "{\"f\":null,\"d\":null}\n{\"f\":null,\"d\":null}\n"
+                "{\"f\":null,\"d\":1e+300}\n{\"f\":0.25,\"d\":null}\n");
+}
+
+TEST(WriterTest, EscapeStrings) {
+  StringBuilder builder;
+  ASSERT_OK(builder.Append("quote\" backslash\\ slash/"));
+  ASSERT_OK(
+      builder.Append("tab\t newline\n return\r bs\b ff\f nul" + std::string(1, '\0')));
+  ASSERT_OK(builder.Append("\x01\x1f\x7f h\xc3\xa9h\xc3\xa9"));
+  // Characters to escape around 8- and 16-byte boundaries
+  ASSERT_OK(builder.Append("0123456\"89abcdef\\123456789abcde\n"));
+  ASSERT_OK(builder.Append(std::string(40, 'x')));
+  ASSERT_OK_AND_ASSIGN(auto strings, builder.Finish());
+  auto batch = RecordBatch::Make(schema({field("k\"\n", utf8())}), strings->length(),
+                                 {strings});
+
+  AssertWritten(batch,
+                R"({"k\"\n":"quote\" backslash\\ slash/"})"
+                "\n"
+                R"({"k\"\n":"tab\t newline\n return\r bs\b ff\f nul\u0000"})"
+                "\n"
+                "{\"k\\\"\\n\":\"\\u0001\\u001f\x7f h\xc3\xa9h\xc3\xa9\"}\n"
+                R"({"k\"\n":"0123456\"89abcdef\\123456789abcde\n"})"
+                "\n"
+                R"({"k\"\n":")" +
+                    std::string(40, 'x') + "\"}\n");
+
+  // Same with other string types
+  for (const auto& other_type : {large_utf8(), utf8_view()}) {
+    ASSERT_OK_AND_ASSIGN(auto other_strings, compute::Cast(*strings, other_type));
+    ASSERT_OK_AND_ASSIGN(auto other_schema,
+                         batch->schema()->SetField(0, field("k\"\n", other_type)));
+    auto other_batch =
+        RecordBatch::Make(other_schema, strings->length(), {other_strings});
+    ASSERT_OK_AND_ASSIGN(auto expected, ToNDJSON(*batch, WriteOptions::Defaults()));
+    AssertWritten(other_batch, expected);
+  }
+}
+
+TEST(WriterTest, Temporal) {
+  auto batch = RecordBatchFromJSON(
+      schema({field("d32", date32()), field("t", time32(TimeUnit::SECOND)),
+              field("ts", timestamp(TimeUnit::MILLI)),
+              field("utc", timestamp(TimeUnit::SECOND, "UTC")),
+              field("tz", timestamp(TimeUnit::SECOND, "America/Phoenix")),
+              field("dur", duration(TimeUnit::SECOND)), field("dec", decimal128(5, 2))}),
+      R"([{"d32": 0, "t": 3661, "ts": 1001, "utc": 1456767743, "tz": 1456767743,
+           "dur": -5, "dec": "123.45"},
+          {}])");
+  AssertWritten(batch,
+                R"({"d32":"1970-01-01","t":"01:01:01","ts":"1970-01-01 00:00:01.001",)"
+                R"("utc":"2016-02-29 17:42:23Z","tz":"2016-02-29 17:42:23Z",)"
+                R"("dur":-5,"dec":123.45})"
+                "\n"
+                R"({"d32":null,"t":null,"ts":null,"utc":null,"tz":null,"dur":null,)"
+                R"("dec":null})"
+                "\n");
+}
+
+TEST(WriterTest, Nested) {
+  auto point = struct_({field("x", int8()), field("y", utf8())});
+  auto batch = RecordBatchFromJSON(
+      schema({field("point", point), field("list", list(int16())),
+              field("fixed", fixed_size_list(boolean(), 2)),
+              field("map", map(utf8(), float64())),
+              field("dict", dictionary(int8(), utf8()))}),
+      R"([{"point": {"x": 1, "y": "a"}, "list": [1, null, 3], "fixed": [true, false],
+           "map": [["k", 1.5], ["l", null]], "dict": "foo"},
+          {"point": {"x": null}, "list": [], "map": [], "dict": "bar"},
+          {"list": null, "fixed": [null, true], "dict": "foo"}])");
+  AssertWritten(batch,
+                R"({"point":{"x":1,"y":"a"},"list":[1,null,3],"fixed":[true,false],)"
+                R"("map":{"k":1.5,"l":null},"dict":"foo"})"
+                "\n"
+                R"({"point":{"x":null,"y":null},"list":[],"fixed":null,"map":{},)"
+                R"("dict":"bar"})"
+                "\n"
+                R"({"point":null,"list":null,"fixed":[null,true],"map":null,)"
+                R"("dict":"foo"})"
+                "\n");
+
+  // Sliced nested arrays
+  AssertWritten(batch->Slice(1, 1),
+                R"({"point":{"x":null,"y":null},"list":[],"fixed":null,"map":{},)"
+                R"("dict":"bar"})"
+                "\n");
+}
+
+TEST(WriterTest, ThreadedSlicesCutThroughNestedValues) {
+  // Slices of 7 rows start and end in the middle of the list and map children, and
+  // all share the dictionaries of the dictionary-encoded values.
+  auto batch_schema =
+      schema({field("list", list(int32())),
+              field("map", map(utf8(), dictionary(int8(), utf8()))),
+              field("tags", list(dictionary(int16(), utf8())))});
+  auto batch = random::GenerateBatch(batch_schema->fields(), /*size=*/3000,
+                                     /*seed=*/0x75);
+
+  // Each row written on its own, one after the other
+  std::string expected;
+  for (int64_t i = 0; i < batch->num_rows(); ++i) {
+    ASSERT_OK_AND_ASSIGN(auto line,
+                         ToNDJSON(*batch->Slice(i, 1), WriteOptions::Defaults()));
+    expected += line;
+  }
+
+  ProxyMemoryPool pool(default_memory_pool());
+  auto options = WriteOptions::Defaults();
+  options.batch_size = 7;
+  options.use_threads = true;
+  options.io_context = io::IOContext(&pool);
+  ASSERT_OK_AND_ASSIGN(auto json, ToNDJSON(*batch, options));
+  EXPECT_EQ(json, expected);
+  // The lines are buffered in memory from the IO context's pool
+  EXPECT_GT(pool.total_bytes_allocated(), 0);
+
+  // Table chunks that don't line up with the slices
+  ASSERT_OK_AND_ASSIGN(auto table,
+                       Table::FromRecordBatches({batch->Slice(0, 1000),
+                                                 batch->Slice(1000, 5),
+                                                 batch->Slice(1005)}));
+  ASSERT_OK_AND_ASSIGN(json, ToNDJSON(*table, options));
+  EXPECT_EQ(json, expected);
+}
+
+TEST(WriterTest, Errors) {
+  ASSERT_OK_AND_ASSIGN(auto out, io::BufferOutputStream::Create());
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      NotImplemented, ::testing::HasSubstr("not supported for type binary"),
+      MakeNDJSONWriter(out, schema({field("a", int32()), field("b", binary())})));
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      NotImplemented, ::testing::HasSubstr("maps with string keys"),
+      MakeNDJSONWriter(out, schema({field("a", map(int32(), int32()))})));
+
+  auto options = WriteOptions::Defaults();
+  options.batch_size = 0;
+  EXPECT_RAISES_WITH_MESSAGE_THAT(Invalid, ::testing::HasSubstr("batch_size"),
+                                  MakeNDJSONWriter(out, schema({}), options));
+}
+
+}  // namespace json
+}  // namespace arrow
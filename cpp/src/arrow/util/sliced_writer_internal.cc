@@ -0,0 +1,118 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/sliced_writer_internal.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "arrow/record_batch.h"
+#include "arrow/result.h"
+#include "arrow/table.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
+
+namespace arrow {
+namespace internal {
+
+namespace {
+
+struct SliceIteratorFunctor {
+  Result<std::shared_ptr<RecordBatch>> Next() {
+    if (current_offset < batch->num_rows()) {
+      std::shared_ptr<RecordBatch> next = batch->Slice(current_offset, slice_size);
+      current_offset += slice_size;
+      return next;
+    }
+    return IterationTraits<std::shared_ptr<RecordBatch>>::End();
+  }
+  const RecordBatch* const batch;
+  const int64_t slice_size;
+  int64_t current_offset;
+};
+
+}  // namespace
+
+RecordBatchIterator RecordBatchSliceIterator(const RecordBatch& batch,
+                                             int64_t slice_size) {
+  SliceIteratorFunctor functor = {&batch, slice_size, /*offset=*/static_cast<int64_t>(0)};
+  return RecordBatchIterator(std::move(functor));
+}
+
+SliceEncoder::~SliceEncoder() = default;
+
+SlicedWriter::SlicedWriter(io::OutputStream* sink,
+                           std::vector<std::unique_ptr<SliceEncoder>> encoders,
+                           int64_t slice_size, bool use_threads)
+    : sink_(sink),
+      encoders_(std::move(encoders)),
+      slice_size_(slice_size),
+      use_threads_(use_threads) {
+  DCHECK(!encoders_.empty());
+  pending_.reserve(encoders_.size());
+}
+
+int SlicedWriter::NumEncoders(bool use_threads) {
+  return use_threads ? std::max(1, GetCpuThreadPool()->GetCapacity()) : 1;
+}
+
+Status SlicedWriter::WriteRecordBatch(const RecordBatch& batch) {
+  RecordBatchIterator iterator = RecordBatchSliceIterator(batch, slice_size_);
+  for (auto maybe_slice : iterator) {
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> slice, maybe_slice);
+    pending_.push_back(std::move(slice));
+    if (pending_.size() == encoders_.size()) {
+      RETURN_NOT_OK(EncodeAndWrite());
+    }
+  }
+  return EncodeAndWrite();
+}
+
+Status SlicedWriter::WriteTable(const Table& table, int64_t max_chunksize) {
+  TableBatchReader reader(table);
+  reader.set_chunksize(max_chunksize > 0 ? max_chunksize : slice_size_);
+  std::shared_ptr<RecordBatch> batch;
+  RETURN_NOT_OK(reader.ReadNext(&batch));
+  while (batch != nullptr) {
+    pending_.push_back(std::move(batch));
+    if (pending_.size() == encoders_.size()) {
+      RETURN_NOT_OK(EncodeAndWrite());
+    }
+    RETURN_NOT_OK(reader.ReadNext(&batch));
+  }
+  return EncodeAndWrite();
+}
+
+Status SlicedWriter::EncodeAndWrite() {
+  const int num_slices = static_cast<int>(pending_.size());
+  DCHECK_LE(pending_.size(), encoders_.size());
+  Status st = OptionalParallelFor(use_threads_ && num_slices > 1, num_slices, [&](int i) {
+    return encoders_[i]->Encode(*pending_[i]);
+  });
+  // Don't keep the slices (and the batches they view) alive past this call
+  pending_.clear();
+  RETURN_NOT_OK(st);
+  for (int i = 0; i < num_slices; ++i) {
+    RETURN_NOT_OK(encoders_[i]->WriteTo(sink_));
+    ++num_slices_written_;
+  }
+  return Status::OK();
+}
+
+}  // namespace internal
+}  // namespace arrow
@@ -0,0 +1,89 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "arrow/io/type_fwd.h"
+#include "arrow/record_batch.h"
+#include "arrow/status.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace internal {
+
+/// \brief Iterate over consecutive slices of at most slice_size rows of batch
+///
+/// The batch must outlive the iterator.
+ARROW_EXPORT
+RecordBatchIterator RecordBatchSliceIterator(const RecordBatch& batch,
+                                             int64_t slice_size);
+
+/// \brief Renders one slice of a record batch at a time into an output buffer
+class ARROW_EXPORT SliceEncoder {
+ public:
+  virtual ~SliceEncoder();
+
+  /// Render batch, replacing the output of the previous call.
+  virtual Status Encode(const RecordBatch& batch) = 0;
+
+  /// Write the output of the last Encode() call to sink.
+  virtual Status WriteTo(io::OutputStream* sink) = 0;
+};
+
+/// \brief Writes record batches and tables as slices rendered by SliceEncoders
+///
+/// Up to one slice per encoder is rendered at a time, concurrently on the CPU
+/// thread pool if use_threads is true, then the outputs are written to the sink in
+/// slice order.
+class ARROW_EXPORT SlicedWriter {
+ public:
+  SlicedWriter(io::OutputStream* sink,
+               std::vector<std::unique_ptr<SliceEncoder>> encoders, int64_t slice_size,
+               bool use_threads);
+
+  /// The number of encoders worth creating: one per CPU thread if use_threads is
+  /// true, otherwise one.
+  static int NumEncoders(bool use_threads);
+
+  Status WriteRecordBatch(const RecordBatch& batch);
+
+  /// Write the table in slices of max_chunksize rows, or of slice_size rows if
+  /// max_chunksize is not positive.
+  Status WriteTable(const Table& table, int64_t max_chunksize);
+
+  /// The number of slices written so far
+  int64_t num_slices_written() const { return num_slices_written_; }
+
+ private:
+  // Renders the pending slices, writes them in order and clears them.
+  Status EncodeAndWrite();
+
+  io::OutputStream* sink_;
+  std::vector<std::unique_ptr<SliceEncoder>> encoders_;
+  const int64_t slice_size_;
+  const bool use_threads_;
+  std::vector<std::shared_ptr<RecordBatch>> pending_;
+  int64_t num_slices_written_ = 0;
+};
+
+}  // namespace internal
+}  // namespace arrow
@@ -23,6 +23,7 @@
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <limits>
 #include <memory>
 #include <string>
@@ -32,6 +33,7 @@
 #include "arrow/type_traits.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/config.h"
+#include "arrow/util/endian.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/time.h"
 #include "arrow/util/visibility.h"
@@ -124,10 +126,8 @@ struct StringConverter<BooleanType> {
   }
 };
 
-// Ideas for faster float parsing:
-// - http://rapidjson.org/md_doc_internals.html#ParsingDouble
-// - https://github.com/google/double-conversion [used here]
-// - https://github.com/achan001/dtoa-fast
+// Floats are parsed using the Eisel-Lemire algorithm, as implemented by
+// https://github.com/fastfloat/fast_float (vendored)
 
 ARROW_EXPORT
 bool StringToFloat(const char* s, size_t length, char decimal_point, float* out);
@@ -184,6 +184,105 @@ struct StringConverter<HalfFloatType> {
 
 inline uint8_t ParseDecimalDigit(char c) { return static_cast<uint8_t>(c - '0'); }
 
+namespace detail {
+
+// SWAR ("SIMD within a register") helpers processing 8 characters at once,
+// see https://lemire.me/blog/2022/01/21/swar-explained-parsing-eight-digits/
+
+// Load 8 characters so that the first one is in the least significant byte
+inline uint64_t LoadEightChars(const char* s) {
+  uint64_t v;
+  std::memcpy(&v, s, sizeof(v));
+  return bit_util::FromLittleEndian(v);
+}
+
+// Whether all 8 characters are ASCII decimal digits
+inline bool AreEightDigits(uint64_t v) {
+  // For a digit, the high nibble is 3 and adding 6 doesn't carry into it
+  return ((v & 0xF0F0F0F0F0F0F0F0ULL) |
+          (((v + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) ==
+         0x3333333333333333ULL;
+}
+
+// Value of 8 ASCII decimal digits (which must have been validated)
+inline uint32_t ParseEightDigits(uint64_t v) {
+  v -= 0x3030303030303030ULL;
+  // Combine adjacent digits into 2-digit numbers, then 2-digit numbers into
+  // 4-digit numbers, then 4-digit numbers into the final value
+  v = v * 10 + (v >> 8);
+  v = (((v & 0x000000FF000000FFULL) * (100 + (1000000ULL << 32))) +
+       (((v >> 16) & 0x000000FF000000FFULL) * (1 + (10000ULL << 32)))) >>
+      32;
+  return static_cast<uint32_t>(v);
+}
+
+// Parse 8 characters made of 2-digit numbers and separators.
+// `separator_mask` has all bits set in the separator bytes, whose expected
+// values are given in `separators`.  On success, byte N of `*out` is the
+// value of the 2-digit number starting at character N.
+inline bool ParseTwoDigitGroups(const char* s, uint64_t separator_mask,
+                                uint64_t separators, uint64_t* out) {
+  const uint64_t v = LoadEightChars(s);
+  if (ARROW_PREDICT_FALSE((v & separator_mask) != separators)) {
+    return false;
+  }
+  // Replace separators with zeros, so that they don't contribute to the
+  // neighbouring numbers
+  const uint64_t digits =
+      (v & ~separator_mask) | (0x3030303030303030ULL & separator_mask);
+  if (ARROW_PREDICT_FALSE(!AreEightDigits(digits))) {
+    return false;
+  }
+  const uint64_t values = digits - 0x3030303030303030ULL;
+  *out = values * 10 + (values >> 8);
+  return true;
+}
+
+inline uint8_t GetByte(uint64_t v, int n) { return static_cast<uint8_t>(v >> (n * 8)); }
+
+// Parse numbers of 8 or more digits, 8 digits at a time
+template <typename C_TYPE>
+inline bool ParseUnsignedEightDigitsAtATime(const char* s, size_t length, C_TYPE* out) {
+  static_assert(sizeof(C_TYPE) <= sizeof(uint64_t), "");
+  constexpr auto kMaxValue = static_cast<uint64_t>(std::numeric_limits<C_TYPE>::max());
+  if (ARROW_PREDICT_FALSE(length > std::numeric_limits<C_TYPE>::digits10 + 1)) {
+    /* Too many digits */
+    return false;
+  }
+  uint64_t result = 0;
+  // Leading digits that don't make a full group of 8
+  for (size_t i = length % 8; i > 0; --i) {
+    const uint8_t digit = ParseDecimalDigit(*s++);
+    if (ARROW_PREDICT_FALSE(digit > 9U)) {
+      /* Non-digit */
+      return false;
+    }
+    result = result * 10U + digit;
+  }
+  for (length -= length % 8; length > 0; length -= 8, s += 8) {
+    const uint64_t chars = LoadEightChars(s);
+    if (ARROW_PREDICT_FALSE(!AreEightDigits(chars))) {
+      /* Non-digit */
+      return false;
+    }
+    const uint32_t group = ParseEightDigits(chars);
+    if (ARROW_PREDICT_FALSE(result > kMaxValue / 100000000U)) {
+      /* Overflow */
+      return false;
+    }
+    result *= 100000000U;
+    if (ARROW_PREDICT_FALSE(result > kMaxValue - group)) {
+      /* Overflow */
+      return false;
+    }
+    result += group;
+  }
+  *out = static_cast<C_TYPE>(result);
+  return true;
+}
+
+}  // namespace detail
+
 #define PARSE_UNSIGNED_ITERATION(C_TYPE)          \
   if (length > 0) {                               \
     uint8_t digit = ParseDecimalDigit(*s++);      \
@@ -248,6 +347,9 @@ inline bool ParseUnsigned(const char* s, size_t length, uint16_t* out) {
 }
 
 inline bool ParseUnsigned(const char* s, size_t length, uint32_t* out) {
+  if (length >= 8) {
+    return detail::ParseUnsignedEightDigitsAtATime(s, length, out);
+  }
   uint32_t result = 0;
   do {
     PARSE_UNSIGNED_ITERATION(uint32_t);
@@ -268,6 +370,9 @@ inline bool ParseUnsigned(const char* s, size_t length, uint32_t* out) {
 }
 
 inline bool ParseUnsigned(const char* s, size_t length, uint64_t* out) {
+  if (length >= 8) {
+    return detail::ParseUnsignedEightDigitsAtATime(s, length, out);
+  }
   uint64_t result = 0;
   do {
     PARSE_UNSIGNED_ITERATION(uint64_t);
@@ -520,21 +625,16 @@ static inline bool ParseHHMM(const char* s, Duration* out) {
 
 template <typename Duration>
 static inline bool ParseHH_MM_SS(const char* s, Duration* out) {
-  uint8_t hours = 0;
-  uint8_t minutes = 0;
-  uint8_t seconds = 0;
-  if (ARROW_PREDICT_FALSE(s[2] != ':') || ARROW_PREDICT_FALSE(s[5] != ':')) {
-    return false;
-  }
-  if (ARROW_PREDICT_FALSE(!ParseUnsigned(s + 0, 2, &hours))) {
-    return false;
-  }
-  if (ARROW_PREDICT_FALSE(!ParseUnsigned(s + 3, 2, &minutes))) {
-    return false;
-  }
-  if (ARROW_PREDICT_FALSE(!ParseUnsigned(s + 6, 2, &seconds))) {
+  // "hh:mm:ss" is exactly 8 characters, validate and parse them at once
+  uint64_t groups = 0;
+  if (ARROW_PREDICT_FALSE(!ParseTwoDigitGroups(
+          s, /*separator_mask=*/0x0000FF0000FF0000ULL,
+          /*separators=*/0x00003A00003A0000ULL, &groups))) {
     return false;
   }
+  const uint8_t hours = GetByte(groups, 0);
+  const uint8_t minutes = GetByte(groups, 3);
+  const uint8_t seconds = GetByte(groups, 6);
   if (ARROW_PREDICT_FALSE(hours >= 24)) {
     return false;
   }
@@ -633,18 +733,17 @@ static inline bool ParseSubSeconds(const char* s, size_t length, TimeUnit::type
 
 template <typename Duration>
 static inline bool ParseYYYY_MM_DD(const char* s, Duration* since_epoch) {
-  uint16_t year = 0;
-  uint8_t month = 0;
-  uint8_t day = 0;
-  if (ARROW_PREDICT_FALSE(s[4] != '-') || ARROW_PREDICT_FALSE(s[7] != '-')) {
-    return false;
-  }
-  if (ARROW_PREDICT_FALSE(!ParseUnsigned(s + 0, 4, &year))) {
-    return false;
-  }
-  if (ARROW_PREDICT_FALSE(!ParseUnsigned(s + 5, 2, &month))) {
+  // Validate and parse "YYYY-MM-" at once
+  uint64_t groups = 0;
+  if (ARROW_PREDICT_FALSE(!detail::ParseTwoDigitGroups(
+          s, /*separator_mask=*/0xFF0000FF00000000ULL,
+          /*separators=*/0x2D00002D00000000ULL, &groups))) {
     return false;
   }
+  const auto year = static_cast<uint16_t>(detail::GetByte(groups, 0) * 100 +
+                                          detail::GetByte(groups, 2));
+  const uint8_t month = detail::GetByte(groups, 5);
+  uint8_t day = 0;
   if (ARROW_PREDICT_FALSE(!ParseUnsigned(s + 8, 2, &day))) {
     return false;
   }
@@ -56,6 +56,25 @@ static std::vector<std::string> MakeIntStrings(int32_t num_items) {
   return strings;
 }
 
+// Integers of 8 digits or more
+template <typename c_int>
+static std::vector<std::string> MakeLongIntStrings(int32_t num_items) {
+  using c_int_limits = std::numeric_limits<c_int>;
+  std::vector<std::string> base_strings = {std::to_string(c_int_limits::max()),
+                                           std::to_string(c_int_limits::max() / 3),
+                                           std::to_string(c_int_limits::max() / 77),
+                                           "12345678", "98765432", "10000000"};
+  if (c_int_limits::is_signed) {
+    base_strings.push_back(std::to_string(c_int_limits::min()));
+    base_strings.push_back(std::to_string(c_int_limits::min() / 5));
+  }
+  std::vector<std::string> strings;
+  for (int32_t i = 0; i < num_items; ++i) {
+    strings.push_back(base_strings[i % base_strings.size()]);
+  }
+  return strings;
+}
+
 template <typename c_int>
 static std::vector<std::string> MakeHexStrings(int32_t num_items) {
   int32_t num_bytes = sizeof(c_int);
@@ -98,6 +117,18 @@ static std::vector<std::string> MakeTimestampStrings(int32_t num_items) {
   return strings;
 }
 
+static std::vector<std::string> MakeFractionalTimestampStrings(int32_t num_items) {
+  std::vector<std::string> base_strings = {
+      "2018-11-13T17:11:10.123", "2018-11-13T11:22:33.456Z", "2016-02-29T11:22:33.1",
+      "2021-07-01T00:00:00.999Z"};
+
+  std::vector<std::string> strings;
+  for (int32_t i = 0; i < num_items; ++i) {
+    strings.push_back(base_strings[i % base_strings.size()]);
+  }
+  return strings;
+}
+
 template <typename c_int, typename c_int_limits = std::numeric_limits<c_int>>
 static typename std::enable_if<c_int_limits::is_signed, std::vector<c_int>>::type
 MakeInts(int32_t num_items) {
@@ -143,6 +174,25 @@ static void IntegerParsing(benchmark::State& state) {  // NOLINT non-const refer
   state.SetItemsProcessed(state.iterations() * strings.size());
 }
 
+template <typename ARROW_TYPE, typename C_TYPE = typename ARROW_TYPE::c_type>
+static void LongIntegerParsing(benchmark::State& state) {  // NOLINT non-const reference
+  auto strings = MakeLongIntStrings<C_TYPE>(1000);
+
+  while (state.KeepRunning()) {
+    C_TYPE total = 0;
+    for (const auto& s : strings) {
+      C_TYPE value;
+      if (!ParseValue<ARROW_TYPE>(s.data(), s.length(), &value)) {
+        std::cerr << "Conversion failed for '" << s << "'";
+        std::abort();
+      }
+      total = static_cast<C_TYPE>(total + value);
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(state.iterations() * strings.size());
+}
+
 template <typename ARROW_TYPE, typename C_TYPE = typename ARROW_TYPE::c_type>
 static void HexParsing(benchmark::State& state) {  // NOLINT non-const reference
   auto strings = MakeHexStrings<C_TYPE>(1000);
@@ -182,12 +232,10 @@ static void FloatParsing(benchmark::State& state) {  // NOLINT non-const referen
 }
 
 static void BenchTimestampParsing(
-    benchmark::State& state, TimeUnit::type unit,
-    const TimestampParser& parser) {  // NOLINT non-const reference
+    benchmark::State& state, TimeUnit::type unit, const TimestampParser& parser,
+    const std::vector<std::string>& strings) {  // NOLINT non-const reference
   using c_type = TimestampType::c_type;
 
-  auto strings = MakeTimestampStrings(1000);
-
   for (auto _ : state) {
     c_type total = 0;
     for (const auto& s : strings) {
@@ -207,14 +255,21 @@ template <TimeUnit::type UNIT>
 static void TimestampParsingISO8601(
     benchmark::State& state) {  // NOLINT non-const reference
   auto parser = TimestampParser::MakeISO8601();
-  BenchTimestampParsing(state, UNIT, *parser);
+  BenchTimestampParsing(state, UNIT, *parser, MakeTimestampStrings(1000));
+}
+
+template <TimeUnit::type UNIT>
+static void TimestampParsingISO8601Fractional(
+    benchmark::State& state) {  // NOLINT non-const reference
+  auto parser = TimestampParser::MakeISO8601();
+  BenchTimestampParsing(state, UNIT, *parser, MakeFractionalTimestampStrings(1000));
 }
 
 template <TimeUnit::type UNIT>
 static void TimestampParsingStrptime(
     benchmark::State& state) {  // NOLINT non-const reference
   auto parser = TimestampParser::MakeStrptime("%Y-%m-%d %H:%M:%S");
-  BenchTimestampParsing(state, UNIT, *parser);
+  BenchTimestampParsing(state, UNIT, *parser, MakeTimestampStrings(1000));
 }
 
 struct DummyAppender {
@@ -269,6 +324,11 @@ BENCHMARK_TEMPLATE(IntegerParsing, UInt16Type);
 BENCHMARK_TEMPLATE(IntegerParsing, UInt32Type);
 BENCHMARK_TEMPLATE(IntegerParsing, UInt64Type);
 
+BENCHMARK_TEMPLATE(LongIntegerParsing, Int32Type);
+BENCHMARK_TEMPLATE(LongIntegerParsing, Int64Type);
+BENCHMARK_TEMPLATE(LongIntegerParsing, UInt32Type);
+BENCHMARK_TEMPLATE(LongIntegerParsing, UInt64Type);
+
 BENCHMARK_TEMPLATE(HexParsing, Int8Type);
 BENCHMARK_TEMPLATE(HexParsing, Int16Type);
 BENCHMARK_TEMPLATE(HexParsing, Int32Type);
@@ -285,6 +345,9 @@ BENCHMARK_TEMPLATE(TimestampParsingISO8601, TimeUnit::SECOND);
 BENCHMARK_TEMPLATE(TimestampParsingISO8601, TimeUnit::MILLI);
 BENCHMARK_TEMPLATE(TimestampParsingISO8601, TimeUnit::MICRO);
 BENCHMARK_TEMPLATE(TimestampParsingISO8601, TimeUnit::NANO);
+BENCHMARK_TEMPLATE(TimestampParsingISO8601Fractional, TimeUnit::MILLI);
+BENCHMARK_TEMPLATE(TimestampParsingISO8601Fractional, TimeUnit::MICRO);
+BENCHMARK_TEMPLATE(TimestampParsingISO8601Fractional, TimeUnit::NANO);
 BENCHMARK_TEMPLATE(TimestampParsingStrptime, TimeUnit::MILLI);
 
 BENCHMARK_TEMPLATE(IntegerFormatting, Int8Type);
@@ -438,6 +438,39 @@ TEST(StringConversion, ToUInt64) {
   AssertConversionFails<UInt64Type>("0x23512ak");
 }
 
+TEST(StringConversion, ToIntegerManyDigits) {
+  // Values of 8 digits or more are parsed 8 digits at a time
+  AssertConversion<UInt32Type>("12345678", 12345678UL);
+  AssertConversion<UInt32Type>("99999999", 99999999UL);
+  AssertConversion<UInt32Type>("100000000", 100000000UL);
+  AssertConversion<Int32Type>("-2147483648", -2147483647 - 1);
+  AssertConversion<UInt64Type>("1234567890123456", 1234567890123456ULL);
+  AssertConversion<UInt64Type>("10000000000000000000", 10000000000000000000ULL);
+  AssertConversion<Int64Type>("-12345678901234567", -12345678901234567LL);
+  AssertConversion<Int64Type>("000000000000000000000000001", 1);
+  AssertConversionFails<UInt64Type>("99999999999999999999");
+  AssertConversionFails<UInt64Type>("100000000000000000000");
+  AssertConversionFails<UInt32Type>("9999999999");
+
+  // A non-digit is detected at any position, including characters
+  // that are just outside of the digit range
+  const std::string digits = "12345678901234567";
+  for (size_t length = 8; length <= digits.size(); ++length) {
+    for (size_t pos = 0; pos < length; ++pos) {
+      for (char c : {'/', ':', ' ', 'a', '\xb0', '\0'}) {
+        auto s = digits.substr(0, length);
+        s[pos] = c;
+        ARROW_SCOPED_TRACE("'", s, "'");
+        AssertConversionFails<UInt64Type>(s);
+        AssertConversionFails<Int64Type>(s);
+        if (length <= 10) {
+          AssertConversionFails<UInt32Type>(s);
+        }
+      }
+    }
+  }
+}
+
 TEST(StringConversion, ToDate32) {
   AssertConversion<Date32Type>("1970-01-01", 0);
   AssertConversion<Date32Type>("1970-01-02", 1);
@@ -796,6 +829,25 @@ TEST(StringConversion, ToTimestampDateTime_ISO8601) {
   }
 }
 
+TEST(StringConversion, ToTimestampInvalidCharacter_ISO8601) {
+  TimestampType type{TimeUnit::NANO};
+  const std::string valid = "2018-11-13 17:11:10.123456789";
+  AssertConversion(type, valid, 1542129070123456789LL);
+
+  // Every character is validated
+  for (size_t pos = 0; pos < valid.size(); ++pos) {
+    for (char c : {'/', ':', '-', '.', 'a', '\0'}) {
+      if (valid[pos] == c) {
+        continue;
+      }
+      auto s = valid;
+      s[pos] = c;
+      ARROW_SCOPED_TRACE("'", s, "'");
+      AssertConversionFails(type, s);
+    }
+  }
+}
+
 TEST(TimestampParser, StrptimeParser) {
   std::string format = "%m/%d/%Y %H:%M:%S";
   auto parser = TimestampParser::MakeStrptime(format);
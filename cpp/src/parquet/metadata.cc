@@ -19,12 +19,15 @@
 
 #include <algorithm>
 #include <cinttypes>
+#include <list>
 #include <memory>
+#include <mutex>
 #include <ostream>
 #include <random>
 #include <sstream>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -1094,6 +1097,112 @@ void FileMetaData::WriteTo(::arrow::io::OutputStream* dst,
   return impl_->WriteTo(dst, encryptor);
 }
 
+// file metadata cache
+class FileMetaDataCache::Impl {
+ public:
+  explicit Impl(int64_t capacity) : capacity_(capacity) {}
+
+  std::shared_ptr<FileMetaData> Get(const std::string& key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = map_.find(key);
+    if (it == map_.end()) {
+      return nullptr;
+    }
+    // Move the entry to the front of the recency list
+    entries_.splice(entries_.begin(), entries_, it->second);
+    return it->second->metadata;
+  }
+
+  void Put(const std::string& key, std::shared_ptr<FileMetaData> metadata) {
+    // Metadata built in memory rather than decoded has no recorded size
+    int64_t charge = metadata->size();
+    if (charge == 0) {
+      charge = static_cast<int64_t>(metadata->SerializeToString().size());
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = map_.find(key);
+    if (it != map_.end()) {
+      Erase(it);
+    }
+    if (charge > capacity_) {
+      return;
+    }
+    while (size_ + charge > capacity_) {
+      Erase(map_.find(entries_.back().key));
+    }
+    entries_.push_front({key, std::move(metadata), charge});
+    map_.emplace(key, entries_.begin());
+    size_ += charge;
+  }
+
+  void Clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    map_.clear();
+    entries_.clear();
+    size_ = 0;
+  }
+
+  int64_t capacity() const { return capacity_; }
+
+  int64_t size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return size_;
+  }
+
+  int64_t num_entries() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return static_cast<int64_t>(map_.size());
+  }
+
+ private:
+  struct Entry {
+    std::string key;
+    std::shared_ptr<FileMetaData> metadata;
+    int64_t charge;
+  };
+  using EntryList = std::list<Entry>;
+  using EntryMap = std::unordered_map<std::string, EntryList::iterator>;
+
+  void Erase(EntryMap::iterator it) {
+    size_ -= it->second->charge;
+    entries_.erase(it->second);
+    map_.erase(it);
+  }
+
+  const int64_t capacity_;
+  mutable std::mutex mutex_;
+  // Most recently used first
+  EntryList entries_;
+  EntryMap map_;
+  int64_t size_ = 0;
+};
+
+FileMetaDataCache::FileMetaDataCache(int64_t capacity) : impl_(new Impl(capacity)) {}
+
+FileMetaDataCache::~FileMetaDataCache() = default;
+
+const std::shared_ptr<FileMetaDataCache>& FileMetaDataCache::Default() {
+  static const auto cache = std::make_shared<FileMetaDataCache>();
+  return cache;
+}
+
+std::shared_ptr<FileMetaData> FileMetaDataCache::Get(const std::string& key) {
+  return impl_->Get(key);
+}
+
+void FileMetaDataCache::Put(const std::string& key,
+                            std::shared_ptr<FileMetaData> metadata) {
+  impl_->Put(key, std::move(metadata));
+}
+
+void FileMetaDataCache::Clear() { impl_->Clear(); }
+
+int64_t FileMetaDataCache::capacity() const { return impl_->capacity(); }
+
+int64_t FileMetaDataCache::size() const { return impl_->size(); }
+
+int64_t FileMetaDataCache::num_entries() const { return impl_->num_entries(); }
+
 class FileCryptoMetaData::FileCryptoMetaDataImpl {
  public:
   FileCryptoMetaDataImpl() = default;
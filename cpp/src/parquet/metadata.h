@@ -395,6 +395,56 @@ class PARQUET_EXPORT FileMetaData {
   std::unique_ptr<FileMetaDataImpl> impl_;
 };
 
+/// \brief A thread-safe, size-bounded cache of parsed file footers.
+///
+/// Decoding the footer of a file with a wide schema or many row groups can cost
+/// as much as reading the data it describes, and scans that open the same files
+/// repeatedly pay it every time.  A cached FileMetaData can instead be passed to
+/// ParquetFileReader::Open (or FileReaderBuilder::Open) to skip reading and
+/// decoding the footer; it carries, among others, the page index and bloom
+/// filter offsets of every column chunk.
+///
+/// Entries are keyed by a caller-provided string, which must identify a given
+/// version of a file: along with the file path, it should include e.g. its size
+/// and modification time, or its ETag.  The cache is bounded by the total
+/// thrift-encoded size of the footers it holds and evicts the least recently
+/// used entries first.  Footers of files with encrypted metadata should not be
+/// cached, as readers sharing them would bypass decryption.
+class PARQUET_EXPORT FileMetaDataCache {
+ public:
+  /// The capacity of the process-wide cache, in bytes
+  static constexpr int64_t kDefaultCapacity = 64 << 20;
+
+  /// \brief Create a cache holding up to `capacity` bytes of encoded footers.
+  explicit FileMetaDataCache(int64_t capacity = kDefaultCapacity);
+  ~FileMetaDataCache();
+
+  /// \brief The process-wide cache.
+  static const std::shared_ptr<FileMetaDataCache>& Default();
+
+  /// \brief Return the metadata cached under key, or null if there is none.
+  std::shared_ptr<FileMetaData> Get(const std::string& key);
+
+  /// \brief Cache metadata under key, replacing any previous entry.
+  ///
+  /// Metadata larger than the capacity of the cache is not cached.
+  void Put(const std::string& key, std::shared_ptr<FileMetaData> metadata);
+
+  /// \brief Remove all entries.
+  void Clear();
+
+  /// The maximum total size of the cached footers, in bytes
+  int64_t capacity() const;
+  /// The total size of the cached footers, in bytes
+  int64_t size() const;
+  /// The number of cached footers
+  int64_t num_entries() const;
+
+ private:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
 class PARQUET_EXPORT FileCryptoMetaData {
  public:
   // API convenience to get a MetaData accessor
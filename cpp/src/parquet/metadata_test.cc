@@ -462,6 +462,99 @@ TEST(Metadata, TestSortingColumns) {
   EXPECT_EQ(sorting_columns, row_group_read_metadata->sorting_columns());
 }
 
+// Round-trip metadata through its thrift encoding, so that it records its size
+std::shared_ptr<FileMetaData> MakeEncodedMetaData(int num_columns) {
+  schema::NodeVector fields;
+  for (int i = 0; i < num_columns; ++i) {
+    fields.push_back(schema::Int32("col" + std::to_string(i), Repetition::REQUIRED));
+  }
+  SchemaDescriptor schema;
+  schema.Init(schema::GroupNode::Make("schema", Repetition::REPEATED, fields));
+  auto serialized = FileMetaDataBuilder::Make(&schema, default_writer_properties())
+                        ->Finish()
+                        ->SerializeToString();
+  auto length = static_cast<uint32_t>(serialized.size());
+  return FileMetaData::Make(serialized.data(), &length);
+}
+
+TEST(FileMetaDataCache, GetPut) {
+  auto metadata = MakeEncodedMetaData(/*num_columns=*/3);
+  ASSERT_GT(metadata->size(), 0u);
+
+  FileMetaDataCache cache(/*capacity=*/1 << 20);
+  ASSERT_EQ(nullptr, cache.Get("a"));
+  cache.Put("a", metadata);
+  ASSERT_EQ(metadata, cache.Get("a"));
+  ASSERT_EQ(nullptr, cache.Get("b"));
+  ASSERT_EQ(1, cache.num_entries());
+  ASSERT_EQ(metadata->size(), cache.size());
+
+  // Replacing an entry does not account for it twice
+  auto other = MakeEncodedMetaData(/*num_columns=*/5);
+  cache.Put("a", other);
+  ASSERT_EQ(other, cache.Get("a"));
+  ASSERT_EQ(1, cache.num_entries());
+  ASSERT_EQ(other->size(), cache.size());
+
+  // Metadata built in memory is accounted by its encoded size
+  SchemaDescriptor schema;
+  schema.Init(schema::GroupNode::Make(
+      "schema", Repetition::REPEATED, {schema::Int32("col", Repetition::REQUIRED)}));
+  std::shared_ptr<FileMetaData> built =
+      FileMetaDataBuilder::Make(&schema, default_writer_properties())->Finish();
+  ASSERT_EQ(0u, built->size());
+  cache.Put("b", built);
+  ASSERT_EQ(2, cache.num_entries());
+  ASSERT_EQ(other->size() + static_cast<int64_t>(built->SerializeToString().size()),
+            cache.size());
+
+  cache.Clear();
+  ASSERT_EQ(0, cache.num_entries());
+  ASSERT_EQ(0, cache.size());
+}
+
+TEST(FileMetaDataCache, EvictLeastRecentlyUsed) {
+  auto metadata = MakeEncodedMetaData(/*num_columns=*/4);
+  const int64_t charge = metadata->size();
+
+  FileMetaDataCache cache(/*capacity=*/3 * charge);
+  cache.Put("a", metadata);
+  cache.Put("b", metadata);
+  cache.Put("c", metadata);
+  ASSERT_EQ(3, cache.num_entries());
+  ASSERT_EQ(3 * charge, cache.size());
+
+  // Touch "a" so that "b" is evicted first
+  ASSERT_NE(nullptr, cache.Get("a"));
+  cache.Put("d", metadata);
+  ASSERT_EQ(3, cache.num_entries());
+  ASSERT_EQ(nullptr, cache.Get("b"));
+  ASSERT_NE(nullptr, cache.Get("a"));
+  ASSERT_NE(nullptr, cache.Get("c"));
+  ASSERT_NE(nullptr, cache.Get("d"));
+
+  // Larger metadata evicts as many entries as needed
+  auto large = MakeEncodedMetaData(/*num_columns=*/8);
+  ASSERT_GT(large->size(), charge);
+  ASSERT_LE(large->size(), 3 * charge);
+  cache.Put("e", large);
+  ASSERT_LE(cache.size(), cache.capacity());
+  ASSERT_EQ(large, cache.Get("e"));
+  ASSERT_EQ(nullptr, cache.Get("a"));
+
+  // Metadata larger than the cache is not cached
+  FileMetaDataCache small_cache(/*capacity=*/charge - 1);
+  small_cache.Put("a", metadata);
+  ASSERT_EQ(nullptr, small_cache.Get("a"));
+  ASSERT_EQ(0, small_cache.size());
+}
+
+TEST(FileMetaDataCache, Default) {
+  ASSERT_EQ(FileMetaDataCache::Default(), FileMetaDataCache::Default());
+  ASSERT_EQ(FileMetaDataCache::kDefaultCapacity,
+            FileMetaDataCache::Default()->capacity());
+}
+
 TEST(ApplicationVersion, Basics) {
   ApplicationVersion version("parquet-mr version 1.7.9");
   ApplicationVersion version1("parquet-mr version 1.8.0");